@@ -21,6 +21,17 @@
  * @since  3.2.1  [2026-07-25-05:00pm] Convert NTRIP keys from alpha to numeric.
  * @since  3.2.1  [2026-07-27-01:45pm] Add sendDataToBrowser(), refactor to consolidate JSON.
  * @since  3.2.1  [2026-07-28-04:45pm] Removed NMEA out switch & preference.
+ * @since  3.2.2  [2026-10-16-09:00am] RTCM3 framer (rtcm3Framer.h): length & CRC-24Q framing, bulk UART transfer in taskRtcmRelay().
+ * @since  3.2.2  [2026-10-16-11:00am] NMEA framer (nmeaFramer.h): checksum & length checked, bulk I2C write in DevUBLOXGNSS::processNMEA().
+ * @since  3.2.2  [2026-10-16-02:00pm] Compact telemetry (wsTelemetry.h): binary delta frames to browser, pooled WebSocket RX buffers.
+ * @since  3.2.2  [2026-10-16-04:00pm] Operate page reads a per epoch GNSS snapshot (auto NAV-PVT & NAV-HPPOSLLH callbacks), not getters.
+ * @since  3.2.2  [2026-10-16-06:00pm] NTRIP client (ntripClient.h): GhostRover FreeRTOS task taskNtripClient() feeds taskRtcmRelay().
+ * @since  3.2.2  [2026-10-16-08:00pm] SD session log (sessionLog.h): GhostRover FreeRTOS task taskSessionLogger() logs RTCM, NMEA & UBX.
+ * @since  3.2.2  [2026-10-16-10:00pm] Asset cache: pre-gzipped UI files (tools/gzipAssets.py) served from PSRAM with ETag & 304.
+ * @since  3.2.2  [2026-10-16-11:00pm] Metrics (metrics.h): seqlock snapshots, latency histograms, task CPU & stack. "/metrics", showMetrics, operate page.
+ * @since  3.2.2  [2026-10-16-11:30pm] NMEA rewriter (nmeaRewrite.h): instrument height & position/height lock applied to NMEA out.
+ * @since  3.2.2  [2026-10-17-12:00pm] Host simulator (tests/host/sim): this sketch on Linux, replays NMEA & RTCM captures & session logs.
+ * @since  3.2.2  [2026-10-17-03:30pm] Warning clean on the host build: size_t & uint64_t printf formats, "!" clears NUM_COMMANDS flags (not one past).
  * @see    https://github.com/doug-foster/DougFoster_Ghost_Rover.
  * @see    https://github.com/doug-foster/DougFoster_Ghost_Rover_BT_relay.
  * @see    https://github.com/doug-foster/DougFoster_Ghost_Rover_EVK_RTCM_relay.
@@ -113,16 +124,18 @@
  * --- Dev environment. ---
  *     -- IDE         VS Code & Arduino Maker Workshop 1.1.5 extension (uses Arduino CLI 1.2.0).
  *     -- Platform    https://github.com/espressif/arduino-esp32/releases/latest (Arduino Release v3.3.10 based on ESP-IDF v5.5.4).
+ *     -- Host tests  tests/host (CMake & ctest on Linux/macOS): the plain C++ headers (rtcm3Framer.h, ...) with benchmarks.
+ *     -- Host sim    tests/host/sim: this sketch against stand-in libraries, replays NMEA & RTCM captures (stage latency, heap & stack).
  * 
  * --- Caveats. ---
  *     -- SoftwareSerial library is not supported on ESP32-S3 (does work on ESP32-C6).
  *     -- 0.5.1 -> 0.6.1 builds: Moved BLE relay from primary MCU to secondary MCU since BleSerial library is a space pig.
  *
  * --- TODO: ---
- *     1. Add NTRIP client (use credential preferences).
+ *     1. Done: Add NTRIP client (use credential preferences).
  *     2. Add RTCM page.
- *     3. Offset height/NMEA by instrument height.
- *     4. Button lock (laser/height/position).
+ *     3. Done: Offset height/NMEA by instrument height (NMEA out only, nmeaRewrite.h).
+ *     4. Done: Button lock (laser/height/position). Operate page buttons, the GNSS lock button is still not wired.
  *     5. Update RTKEverywhere for base station.
  *     6. Verify RTK-FIX.
  *     7. Operate.js/operate.html page - add ability to select coordinates (lat/lon, ECEF, UTM northing & easting)  
@@ -141,6 +154,7 @@
  *  --- Include libraries. ---
  *      -- Core.
  *      -- Additional.
+ *      -- Ghost Rover.
  *  --- Global vars.---
  *      -- Pin assignments.
  *      -- LED.
@@ -157,10 +171,25 @@
  *      -- Test.
  *  --- General functions. ---
  *      -- statusLedOn()               - Turn on status LED.
+ *      -- prefNtripSet()              - Set an NTRIP preference global var.
  *      -- prefUtility()               - Preference utility.
+ *      -- ntripLoadCaster()           - Load active NTRIP caster profile.
  *      -- buildOperData()             - Build data for operate page.
  *      -- sendDataToBrowser()         - Send data to browser.
- *      -- rtcm3GetMessageType()       - Return RTCM3 message type to taskRtcmRelay().
+ *      -- sendTelemetryToBrowser()    - Send compact telemetry to browser.
+ *      -- wsClientAdd()               - Track a connected WebSocket client.
+ *      -- wsClientRemove()            - Stop tracking a WebSocket client.
+ *      -- wsClientsSync()             - Bring wsClients[] up to date.
+ *      -- wsClientFind()              - Find a WebSocket client's telemetry state.
+ *      -- assetCacheSwap()            - Publish an asset cache table.
+ *      -- assetCacheLoad()            - Load pre-gzipped UI assets into PSRAM.
+ *      -- assetCacheFind()            - Find a cached asset.
+ *      -- assetCacheDrop()            - Drop a cached asset (file uploaded).
+ *      -- metricsReadRelay()          - Consistent copy of metricsRelay.
+ *      -- metricsReadLoop()           - Consistent copy of metricsLoop.
+ *      -- metricsSampleLoop()         - Record loop() time, sample task CPU & stack.
+ *      -- metricsPrint()              - Print metrics (Prometheus text format).
+ *      -- metricsToBrowser()          - Add metrics to the operate page JSON.
  *  --- Setup functions. ---
  *      -- showBuild()                 - Display build & processor info. Status LED is xxx.
  *      -- startSerial()               - Start serial interfaces.
@@ -177,14 +206,18 @@
  *      -- preLoop()                   - Prepare for loop().
  *  --- GhostRover FreeRTOS functions. ---
  *      -- taskLoopStatusLed()         - GhostRover FreeRTOS task - Set Loop() status LED to blink or solid.
- *      -- taskRtcmRelay()             - GhostRover FreeRTOS task - Relay RTCM from Serial1 (HC-12) to -> Serial2 (ZED UART2).
+ *      -- taskRtcmRelay()             - GhostRover FreeRTOS task - Relay RTCM from Serial1 (HC-12) or NTRIP to -> Serial2 (ZED UART2).
+ *      -- taskNtripClient()           - GhostRover FreeRTOS task - NTRIP client, caster -> taskRtcmRelay().
+ *      -- taskSessionLogger()         - GhostRover FreeRTOS task - Session log, RTCM/NMEA/UBX rings -> SD files.
  *  --- Event handlers for core/additional library processes. ---
  *      -- onWiFiEvent()               - <WiFi.h> & <WiFiAP.h> WiFi event handler (WiFiEvent_t).
  *      -- onHttpFileUpload()          - <ESPAsyncWebServer.h> HTTP endpoint ("/upload") event handler (AsyncWebServerRequest).
  *      -- onWebSocketEvent()          - <ESPAsyncWebServer.h> WebSocket event handler (AsyncWebSocket).
  *      -- DevUBLOXGNSS::processNMEA() - <SparkFun_u-blox_GNSS_v3.h> DevUBLOXGNSS::processNMEA event handler (char incoming).
+ *      -- onNavPvt()                  - <SparkFun_u-blox_GNSS_v3.h> auto NAV-PVT callback (UBX_NAV_PVT_data_t).
+ *      -- onNavHpposllh()             - <SparkFun_u-blox_GNSS_v3.h> auto NAV-HPPOSLLH callback (UBX_NAV_HPPOSLLH_data_t).
  *  --- Loop functions. ---
- *      -- checkZedTriggerUpdate()     - Check ZED to trigger DevUBLOXGNSS::processNMEA().
+ *      -- checkZedTriggerUpdate()     - Check ZED to trigger DevUBLOXGNSS::processNMEA(), onNavPvt() & onNavHpposllh().
  *      -- processJsonActivity()       - Process queued WS messages & pending status updates. All JSON activity lives here.
  *      -- checkSerialUSB()            - Check serial USB for input.
  *      -- // checkGnssLockButton()    - Check GNSS lock button (upPosition or downPosition). // ToDo: Implement.
@@ -219,6 +252,7 @@
  *     startWiFi()                    // Start WiFi.
  *     startSD()                      // Start & test microSD card reader.
  *     startHttpServer()              // Start HTTP server.
+ *        - assetCacheLoad()          // /assets.txt & *.gz (tools/gzipAssets.py) -> PSRAM. Served with ETag, 304 if unchanged.
  *     startWebSocketServer()         // Start WebSocket server.
  *     startAndConfigGNSS()           // Start GNSS, config ZED settings.
  *     startQueues()                  // Start GhostRover FreeRTOS queues.
@@ -231,23 +265,40 @@
  *     // checkGnssLockButton()       // Check GNSS lock button.
  *     ws.cleanupClients()            // HTTP WebSocket cleanup.
  *     debug()                        // Display debug.
+ *     metricsSampleLoop()            // metrics.h - loop() time histogram, task CPU & stack every METRICS_TASK_INTERVAL.
  * --- GhostRover FreeRTOS functions. ---
  *     taskLoopStatusLed()            // GhostRover FreeRTOS task - Set Loop() status LED to blink or solid.
- *     taskRtcmRelay()                // GhostRover FreeRTOS task - Relay RTCM from Serial1 (HC-12) to -> Serial2 (ZED UART2).
- *     rtcm3GetMessageType()          // Called by taskRtcmRelay - return RTCM3 message type.
+ *     taskRtcmRelay()                // GhostRover FreeRTOS task - Relay RTCM from Serial1 (HC-12) or NTRIP to -> Serial2 (ZED UART2).
+ *        - rtcm3FramerPush()         // rtcm3Framer.h - bulk copy received bytes into the framer ring buffer.
+ *        - rtcm3FramerNext()         // rtcm3Framer.h - pull next length-framed, CRC-24Q valid RTCM3 frame.
+ *        - rtcm3TypeStatsRecord()    // rtcm3Framer.h - per message type count, size & inter-arrival time.
+ *        - logGatePush()             // sessionLog.h - copy relayed RTCM into the session log ring (never blocks).
+ *        - metricHistRecord()        // metrics.h - RX -> ZED latency, status published in metricsRelay (seqlock).
+ *     taskNtripClient()              // GhostRover FreeRTOS task - NTRIP client, caster -> taskRtcmRelay().
+ *        - ntripBuildRequest()       // ntripClient.h - NTRIP v1/v2 GET request for the active caster profile.
+ *        - ntripReceive()            // ntripClient.h - strip response header & v2 chunked encoding, RTCM -> ntripRtcmBuffer.
+ *        - ntripBackoffMs()          // ntripClient.h - reconnect delay.
+ *     taskSessionLogger()            // GhostRover FreeRTOS task - Session log, RTCM/NMEA/UBX rings -> SD files.
+ *        - logStreamWrite()          // sessionLog.h - ring -> 8 KB block -> SD file, sector aligned writes.
+ *        - logStreamOffset()         // sessionLog.h - stream offsets for the ".idx" time index.
  * --- Event handlers for core/additional library processes. ---
  *     -- onWiFiEvent()               // <WiFi.h> & <WiFiAP.h> WiFi event handler (WiFiEvent_t).
  *        - if commandFlag[DEBUG_WIFI]), print WiFi status.
  *     -- onHttpFileUpload()          // <ESPAsyncWebServer.h> HTTP endpoint ("/upload") event handler (AsyncWebServerRequest).
  *        - write file to SD, print upload status.
+ *        - drop the file's cached asset (assetCacheDrop()), reload the asset cache if /assets.txt was uploaded.
  *     -- onWebSocketEvent()          // <ESPAsyncWebServer.h> WebSocket event handler (AsyncWebSocket).
  *        - cases: WS_EVT_CONNECT, WS_EVT_DISCONNECT,WS_EVT_DATA,WS_EVT_PONG,WS_EVT_ERROR.
  *        - print status, set LED color.
- *        - if WS_EVT_DATA, push (xQueueSend) JSON struct (data & length) into GhostRover FreeRTOS QueueHandle_t wsRxQueue.
+ *        - if WS_EVT_DATA, take a pooled buffer handle (wsRxFreeQueue), copy JSON text into wsRxPool[handle],
+ *          push handle (xQueueSend) into GhostRover FreeRTOS QueueHandle_t wsRxQueue.
  *     -- DevUBLOXGNSS::processNMEA() // <SparkFun_u-blox_GNSS_v3.h> DevUBLOXGNSS::processNMEA event handler (char incoming).
- *        - Gather NMEA bytes into sentences, send NMEA sentence over I2C (Wire1) to GR-MCU2.
+ *        - Gather NMEA bytes into sentences (nmeaFramerPush() in nmeaFramer.h), send NMEA sentence over I2C (Wire1) to GR-MCU2.
+ *        - Rewrite sentence in place (nmeaRewrite() in nmeaRewrite.h): altitude - instrument height, locked position/height.
+ *        - Copy NMEA sentence into the session log ring (logGatePush() in sessionLog.h) while a session log is open.
  *        - Track counts of NMEA sentences (all & each type) for operate page, status section.
  *        - Set status LED red if I2C (Wire1) is down, call startI2C() to restart.
+ *        - Record sentence framed -> I2C ack latency & I2C restarts in metricsLoop (metrics.h).
  */
 
 /**
@@ -268,11 +319,13 @@
  *        - solid    RED: startWiFi() error,
  *                        startSD() error,
  *                        startAndConfigGNSS() error.
- *     -- loop(). --  
+ *     -- loop(). --  (taskLoopStatusLed() sets the color from the status, see below.)
  *        - solid   BLUE: loop running ok with no websocket connection.
- *        - solid  GREEN: loop running ok with onWebSocketEvent(WS_EVT_CONNECT) connection.
- *        - blink  GREEN: relaySerial1toSerial2() RTCM in Serial1 out Serial2.
- *        - solid    RED: DevUBLOXGNSS::processNMEA() GRMCU1 <--> GRMCU2 I2C (NMEAout) error.
+ *        - solid  GREEN: loop running ok with a websocket connection (wsClientIds[]) or RTCM in (RTCMin).
+ *        - blink  GREEN: taskRtcmRelay() RTCM in Serial1 (or NTRIP) out Serial2 (metricsRelay.bytesIn grew).
+ *        - solid    RED: DevUBLOXGNSS::processNMEA() GRMCU1 <--> GRMCU2 I2C (i2cUp) error.
+ *   Owner: setup() writes ws2812LedColor & ws2812LedBlink until preLoop() sets inLoop, then only
+ *   taskLoopStatusLed() does. Other tasks publish status (i2cUp, wsClientIds[], metricsRelay) instead.
  * --- GR-MCU2 ----
  * @see DougFoster_Ghost_Rover_BT_relay.ino. 
  * 
@@ -341,6 +394,15 @@
  * @since 3.1.1   [2026-06-25-02:00pm] Updated library <ArduinoJson.h>             from 7.4.2  to 7.4.3.
  * @since 3.1.1   [2026-06-25-02:00pm] Updated library <SparkFun_u-blox_GNSS_v3.h> from 3.1.13 to 3.1.14.
  * @since 3.1.2   [2026-07-15-04:45pm] Add NTRIP preferences.
+ * @since 3.2.2   [2026-10-16-09:00am] Add rtcm3Framer.h.
+ * @since 3.2.2   [2026-10-16-11:00am] Add nmeaFramer.h.
+ * @since 3.2.2   [2026-10-16-02:00pm] Add wsTelemetry.h.
+ * @since 3.2.2   [2026-10-16-06:00pm] Add ntripClient.h, <freertos/message_buffer.h>.
+ * @since 3.2.2   [2026-10-16-08:00pm] Add sessionLog.h.
+ * @since 3.2.2   [2026-10-16-10:00pm] Add <memory>, <mbedtls/sha256.h>.
+ * @since 3.2.2   [2026-10-16-11:00pm] Add metrics.h.
+ * @since 3.2.2   [2026-10-16-11:30pm] Add nmeaRewrite.h.
+ * @since 3.2.2   [2026-10-17-12:30pm] METRIC_READ_YIELD() for metrics.h.
  * @link  Arduino https://docs.arduino.cc/libraries/.
  * @link  ESP32   https://docs.espressif.com/projects/arduino-esp32/en/latest/libraries.html.
  */
@@ -357,6 +419,9 @@
 #include <esp_system.h>                                    // https://github.com/pycom/pycom-esp-idf.
 #include <esp_chip_info.h>                                 // https://github.com/pycom/pycom-esp-idf.
 #include <Preferences.h>                                   // https://github.com/espressif/arduino-esp32/tree/master/libraries/Preferences/.
+#include <freertos/message_buffer.h>                       // https://www.freertos.org/Documentation/02-Kernel/04-API-references/10-Message-buffers/00-Message-buffers.
+#include <mbedtls/sha256.h>                                // https://github.com/espressif/esp-idf/tree/master/components/mbedtls.
+#include <memory>                                          // std::shared_ptr (asset cache).
 
 // --- Additional. ---                  
 #include <AsyncTCP.h>                                      // https://github.com/ESP32Async/AsyncTCP (3.4.10).
@@ -365,6 +430,16 @@
 #include <SparkFun_MAX1704x_Fuel_Gauge_Arduino_Library.h>  // https://github.com/sparkfun/SparkFun_MAX1704x_Fuel_Gauge_Arduino_Library (1.0.4).
 #include <SparkFun_u-blox_GNSS_v3.h>                       // https://github.com/sparkfun/SparkFun_u-blox_GNSS_v3 (3.1.13).
 
+// --- Ghost Rover. ---
+#include "rtcm3Framer.h"                                   // RTCM3 length & CRC-24Q framing, per message type stats. No Arduino dependencies.
+#include "nmeaFramer.h"                                    // NMEA checksum & length checked framing, sentence type table. No Arduino dependencies.
+#include "nmeaRewrite.h"                                   // NMEA instrument height & position/height lock rewrite. No Arduino dependencies.
+#include "wsTelemetry.h"                                   // Compact (binary, delta encoded) WebSocket telemetry frames. No Arduino dependencies.
+#include "ntripClient.h"                                   // NTRIP v1/v2 request & response (header, chunked) parsing. No Arduino dependencies.
+#include "sessionLog.h"                                    // Session log rings, sector aligned block writer & time index. No Arduino dependencies.
+#define  METRIC_READ_YIELD() taskYIELD()                    // metricRead(): let a same core writer finish between tries.
+#include "metrics.h"                                       // Latency histograms & seqlock snapshots. No Arduino dependencies.
+
 /**
  * =========================================================================
  *  Global vars.
@@ -381,6 +456,22 @@
  * @since 3.1.2  [2026-07-16-10:00am] Moved MAJOR, MINOR, PATCH from showBuild() to "Operation" section.
  * @since 3.2.1  [2026-07-24-03:30pm] Refactor JSON.
  * @since  3.2.1  [2026-07-28-04:45pm] Removed NMEA out switch & preference.
+ * @since  3.2.2  [2026-10-16-09:00am] Add rtcmFramer, RTCM_CRC_ONLY & SHOW_RTCM_STATS commands.
+ * @since  3.2.2  [2026-10-17-09:00am] Framer counters & type stats copied into MetricsRelay.
+ * @since  3.2.2  [2026-10-16-11:00am] Replace nmeaBuffer with nmeaFramer, nmeaCountXXX with nmeaCount[NmeaType].
+ * @since  3.2.2  [2026-10-16-02:00pm] Replace WsQueueItem with wsRxPool[] & handles, add compact telemetry.
+ * @since  3.2.2  [2026-10-17-10:00am] Compact telemetry state per client (wsClients[], wsClientIds[]), WsRxBuffer.client.
+ * @since  3.2.2  [2026-10-16-04:00pm] Add gnssEpoch, gnssEpochTow, BATTERY_READ_INTERVAL, GNSS_EPOCH_TIMEOUT.
+ * @since  3.2.2  [2026-10-16-06:00pm] Add NTRIP section, DEBUG_NTRIP command, ntripCasterProfile.ggaInterval.
+ * @since  3.2.2  [2026-10-17-10:30am] Add prfNtripMux. ntripReconnects counts successful reconnects only.
+ * @since  3.2.2  [2026-10-16-08:00pm] Add Session log section, LOG_SESSION & SHOW_LOG_STATS commands.
+ * @since  3.2.2  [2026-10-17-11:00am] Replace logSessionOpen with logSession (LogGate: open & busy producers).
+ * @since  3.2.2  [2026-10-17-11:30am] Asset cache: AssetCacheTable published through assetCache & assetCacheMux.
+ * @since  3.2.2  [2026-10-16-10:00pm] Add asset cache (HTTP section).
+ * @since  3.2.2  [2026-10-16-11:00pm] Add Metrics section, SHOW_METRICS command.
+ * @since  3.2.2  [2026-10-16-11:30pm] Add nmeaRewriter.
+ * @since  3.2.2  [2026-10-17-01:00pm] Add nmeaLockConfirm.
+ * @since  3.2.2  [2026-10-17-12:30pm] LED: one writer after setup() (taskLoopStatusLed()).
  */
 
 // --- Pin assignments. ---
@@ -388,6 +479,7 @@ const uint8_t HC12_SET    = 7;                            // HC-12 SET {blue wir
 const uint8_t LSR_TRIGGER = 15;                           // KY-008 trigger pin {yellow wire}.
 
 // --- LED. ---
+// Written by setup() until inLoop, then only by taskLoopStatusLed(). @see Board LED status.
 bool  ws2812LedBlink     = false;
 const uint8_t LED_BRIGHT = 50;                            // 0-255. taskLoopStatusLed()
 enum  ws2812_LED_COLOR {                                  // WS2812 RGB STAT LED.
@@ -411,9 +503,27 @@ const char     WEBSOCKET_SERVER_NAME[] = "/ghostRover";
 uint8_t        clientId                = 0;               // HTTP WebSocket client ID # (+1 for each new connection).
 AsyncWebServer httpServer(80);                            // HTTP AsyncWebServer object on port 80.
 AsyncWebSocket ws(WEBSOCKET_SERVER_NAME);                 // HTTP WebSocket object.
+const uint8_t  ASSET_CACHE_MAX         = 24;              // Max # of cached assets. Match tools/gzipAssets.py.
+const char     ASSET_MANIFEST[]        = "/assets.txt";   // tools/gzipAssets.py: "name hash gzipBytes rawBytes" per line.
+const char     ASSET_CACHE_CONTROL[]   = "no-cache";      // Browser keeps its copy but revalidates (ETag -> 304). Page names aren't hashed, so no max-age.
+struct AssetCacheEntry {                                  // One pre-gzipped asset. @see assetCacheLoad().
+    char                     path[33];                    // e.g. "/operate.js" ("/" + ASSET_MANIFEST name, 31 max).
+    char                     etag[20];                    // "\"hash\"" (quoted) from ASSET_MANIFEST, checked against the bytes.
+    const char*              type;                        // Content type.
+    std::shared_ptr<uint8_t> data;                        // Gzip bytes (PSRAM). Shared: a response still sending keeps them after a drop or reload.
+    size_t                   len;
+};
+struct AssetCacheTable {                                  // A complete cache. Never changed once published: load & drop build a new one.
+    uint8_t         count;                                // # of entries loaded (dropped entries have no data).
+    AssetCacheEntry entries[ASSET_CACHE_MAX];
+};
+std::shared_ptr<AssetCacheTable> assetCache;              // Published table (NULL = none). Read & swapped only under assetCacheMux.
+portMUX_TYPE    assetCacheMux          = portMUX_INITIALIZER_UNLOCKED;  // Guards assetCache (the pointer, not the table).
 
 // --- WebSocket. ---
-const uint8_t WS_RX_QUEUE_LEN     = 5;                    // Max # of WebSocket queued incoming messages.
+const uint8_t WS_RX_QUEUE_LEN     = 5;                    // Max # of WebSocket queued incoming messages (= # of pooled buffers).
+const size_t  WS_RX_BUFFER_SIZE   = 2048;                 // Pooled buffer size. 2x jsonBuffer[1024]. Escaped NTRIP JSON attributes can run larger than outbound buffer.
+const int64_t WS_TLM_KEYFRAME_INTERVAL = 5000000;         // Compact telemetry: time between keyframes (us).
 bool         browserUpdatePending = false;                // Flag: update ready to send to browser page (operate, nmea, ...).
 char         lastNmea[120]      = {'\0'};                 // Snapshot of last complete NMEA sentence. @see DevUBLOXGNSS::processNMEA(), sendDataToBrowser().
 char         jsonBuffer[1024];                            // @see processJsonActivity().  // ToDo: Move to local var?
@@ -422,18 +532,149 @@ size_t       jsonPairNum;                                 // Track number of JSO
 JsonDocument jsonDocToBrowser;                            // JSON document - send to browser. Used in processJsonActivity(), buildOperData(), & DevUBLOXGNSS::processNMEA().
 JsonDocument jsonDocFromBrowser;                          // JSON document - received from browser. Used in processJsonActivity(). 
 JsonDocument JsonDocNtrip;                                // JSON document - JSON NTRIP data inside jsonDocToBrowser or jsonDocFromBrowser.
-struct WsQueueItem {                                      // Queued incoming WebSocket message.
-    char   data[2048];                                    // Raw JSON text 2x jsonBuffer[1024]. Escaped NTRIP JSON attributes can run larger than outbound buffer.
-    size_t len;                                           // Length of raw JSON data (not just null-terminated).
+struct WsRxBuffer {                                       // Pooled incoming WebSocket message. Queued by handle (index into wsRxPool[]), never copied.
+    char*    data;                                        // Raw JSON text, WS_RX_BUFFER_SIZE bytes (PSRAM if available). @see startQueues().
+    size_t   len;                                         // Length of raw JSON data (not just null-terminated).
+    uint32_t client;                                      // Sender, AsyncWebSocketClient::id().
 };
+WsRxBuffer   wsRxPool[WS_RX_QUEUE_LEN];                   // Incoming WebSocket message buffers. @see onWebSocketEvent(), processJsonActivity().
+const uint8_t WS_MAX_CLIENTS      = 8;                    // Tracked WebSocket clients. ws.cleanupClients() closes the oldest above DEFAULT_MAX_WS_CLIENTS.
+struct WsClient {                                         // Telemetry state for one WebSocket client. Only touched in loop(). @see wsClientsSync().
+    uint32_t     id;                                      // AsyncWebSocketClient::id(), 0 = free slot. Mirrors wsClientIds[].
+    bool         compact;                                 // Client asked for compact (binary) telemetry.
+    bool         keyframePending;                         // Next compact telemetry frame to this client is a keyframe.
+    int64_t      lastKeyframe;                            // Time of last keyframe (us).
+    WsTlmEncoder encoder;                                 // Compact telemetry delta reference, sequence # & stats.
+};
+portMUX_TYPE wsClientsMux         = portMUX_INITIALIZER_UNLOCKED;   // Guards wsClientIds[] (onWebSocketEvent() -> loop()).
+uint32_t     wsClientIds[WS_MAX_CLIENTS] = {};            // Connected client IDs, 0 = free. Written by onWebSocketEvent() (AsyncTCP task).
+WsClient     wsClients[WS_MAX_CLIENTS];                   // Per client telemetry state. @see sendDataToBrowser(), processJsonActivity().
 
 // --- GNSS. ---
 SFE_UBLOX_GNSS roverGNSS;                                 // GNSS object (uses I2C-1).
+NmeaFramer     nmeaFramer;                                // NMEA sentence buffer & framer. @see DevUBLOXGNSS::processNMEA().
+NmeaRewriter   nmeaRewriter      = {};                    // NMEA lock state (set by processJsonActivity()) & rewrite stats. Only touched in loop().
+uint8_t        nmeaLockConfirm   = 0;                     // NmeaLock bits captured, "locked" reply not sent yet. Only touched in loop().
+struct GnssEpoch {                                        // One navigation epoch. Filled by onNavPvt() & onNavHpposllh(), read by buildOperData().
+    uint32_t pvtTow;                                      // NAV-PVT GPS time of week (ms).
+    uint8_t  numSv;                                       // NAV-PVT # of satellites used.
+    uint8_t  fixType;                                     // NAV-PVT fix type (3 = 3D).
+    uint8_t  carrSoln;                                    // NAV-PVT carrier solution (1 = RTK-float, 2 = RTK-fix).
+    uint32_t hpTow;                                       // NAV-HPPOSLLH GPS time of week (ms).
+    int32_t  lat;                                         // NAV-HPPOSLLH degrees * 10^-7.
+    int32_t  lon;
+    int8_t   latHp;                                       // NAV-HPPOSLLH high precision component: degrees * 10^-9.
+    int8_t   lonHp;
+    int32_t  height;                                      // NAV-HPPOSLLH ellipsoid height (mm).
+    int32_t  hMsl;                                        // NAV-HPPOSLLH orthometric height (mm).
+    int8_t   heightHp;                                    // NAV-HPPOSLLH high precision component: mm * 10^-1.
+    int8_t   hMslHp;
+    uint32_t hAcc;                                        // NAV-HPPOSLLH accuracy: mm * 10^-1.
+    uint32_t vAcc;
+    bool     ready;                                       // NAV-PVT & NAV-HPPOSLLH from the same epoch arrived, not yet read.
+};
+GnssEpoch      gnssEpoch    = {};                         // Latest epoch. Only touched in loop() (callbacks run in roverGNSS.checkCallbacks()).
+uint32_t       gnssEpochTow = 0;                          // GPS time of week (ms) of the epoch the operate page values come from.
+const int64_t  GNSS_EPOCH_TIMEOUT    = 2000000;           // No epoch for this long (us): publish status anyway, GNSS shown as down.
+const int64_t  BATTERY_READ_INTERVAL = 10000000;          // Time between MAX17048 reads (us).
 
 // --- FreeRTOS handles. ---
 TaskHandle_t taskLoopStatusLedHandle;                     // GhostRover FreeRTOS task: Loop status LED.
 TaskHandle_t taskRtcmRelayHandle;                         // GhostRover FreeRTOS task: RTCM relay, Serial1 -> Serial2.
-QueueHandle_t wsRxQueue;                                  // GhostRover FreeRTOS queue: AsyncTCP task -> loop().
+TaskHandle_t taskNtripClientHandle;                       // GhostRover FreeRTOS task: NTRIP client, caster -> ntripRtcmBuffer.
+TaskHandle_t taskSessionLoggerHandle;                     // GhostRover FreeRTOS task: Session log, logStream[] rings -> SD.
+MessageBufferHandle_t ntripRtcmBuffer;                    // GhostRover FreeRTOS message buffer: taskNtripClient() -> taskRtcmRelay(). NtripChunk messages.
+QueueHandle_t wsRxQueue;                                  // GhostRover FreeRTOS queue: AsyncTCP task -> loop(). wsRxPool[] handles (uint8_t).
+QueueHandle_t wsRxFreeQueue;                              // GhostRover FreeRTOS queue: loop() -> AsyncTCP task. Free wsRxPool[] handles (uint8_t).
+
+// --- RTCM. ---
+Rtcm3Framer rtcmFramer;                                   // RTCM3 ring buffer, framer & per message type stats. Only touched by taskRtcmRelay(),
+                                                          // other tasks read the copy in metricsRelay.
+
+// --- NTRIP. ---
+const size_t   NTRIP_CHUNK_MAX        = 512;              // Max RTCM bytes per ntripRtcmBuffer message.
+const size_t   NTRIP_BUFFER_SIZE      = 8192;             // ntripRtcmBuffer size (bytes). Several seconds of RTCM if taskRtcmRelay() stalls.
+const uint16_t NTRIP_GGA_INTERVAL_DEF = 10;               // Default time between GGA uploads (s), caster profile key "53".
+struct NtripChunk {                                       // One ntripRtcmBuffer message. Only rxTime + the used part of data is sent.
+    int64_t rxTime;                                       // Time (us) the bytes came off the caster socket.
+    uint8_t data[NTRIP_CHUNK_MAX];                        // RTCM bytes (response header & chunked encoding already removed).
+};
+portMUX_TYPE   ntripGgaMux            = portMUX_INITIALIZER_UNLOCKED;   // Guards ntripGga (DevUBLOXGNSS::processNMEA() -> taskNtripClient()).
+char           ntripGga[NMEA_MAX_LEN] = {'\0'};           // Latest GGA sentence for the caster.
+int64_t        ntripGgaTime           = 0;                // Time (us) ntripGga was saved.
+volatile bool  ntripGgaWanted         = false;            // Caster connected & profile sendGga set: keep polling the ZED for GGA.
+volatile bool  ntripRestart           = false;            // Preferences changed: drop the connection & reload the active caster profile.
+bool           ntripUp                = false;            // Caster accepted the request, RTCM streaming.
+uint32_t       ntripReconnects        = 0;                // # of times RTCM streaming resumed after a lost connection.
+uint32_t       ntripBytesPerSec       = 0;                // RTCM bytes/s from the caster (1 sec average).
+uint32_t       ntripBytesDropped      = 0;                // RTCM bytes dropped, ntripRtcmBuffer full.
+float          ntripLatencyMs         = 0;                // Caster socket -> ZED UART2 (ms), max over 1 sec.
+
+// --- Session log. ---
+const uint32_t LOG_RING_SIZE[LOG_NUM_STREAMS] = {         // Ring sizes (bytes, power of 2, PSRAM); match LogStreamId. Several seconds of SD stall each.
+    32768, 65536, 131072                                  // RTCM, NMEA, UBX.
+};
+const uint16_t LOG_UBX_BUFFER_SIZE    = 16384;            // roverGNSS file buffer (RXM-RAWX & RXM-SFRBX). @see startAndConfigGNSS().
+const int64_t  LOG_INDEX_INTERVAL     = 5000000;          // Time (us) between ".idx" entries.
+const int64_t  LOG_SYNC_INTERVAL      = 10000000;         // Time (us) between sector writes + flush, max data lost on power off.
+const int64_t  LOG_ROTATE_TIME        = 3600000000LL;     // New set of files after this long (us) ...
+const uint32_t LOG_ROTATE_BYTES       = 67108864;         // ... or once any stream file reaches this size (64 MB).
+LogStream      logStream[LOG_NUM_STREAMS] = {};           // Rings (producers -> taskSessionLogger()), blocks & file positions.
+LogGate        logSession             = {};               // open: files open, producers push (logGatePush()). busy: producers mid-push.
+uint16_t       logSessionNumber       = 0;                // NNNN in "/logNNNN.rtcm", ".nmea", ".ubx", ".idx".
+uint32_t       logWriteMaxMs          = 0;                // Slowest SD write pass (ms).
+bool           logUbxOn               = false;            // RXM-RAWX & RXM-SFRBX enabled & logged by roverGNSS. Only touched in loop().
+
+// --- Metrics (metrics.h). ---
+// One snapshot per producer, one writer each, read through its seqlock (metricsReadRelay(), metricsReadLoop()),
+// so a reader on the other core never sees a half updated set (e.g. RTCMin from one pass, rtcmKbps from the next).
+const int64_t  METRICS_TASK_INTERVAL  = 1000000;          // Time (us) between task CPU & stack samples.
+const int64_t  METRICS_PAGE_INTERVAL  = 2000000;          // Time (us) between operate page metrics ("57" - "62"), p95 over this window.
+const uint8_t  METRICS_MAX_TASKS      = 8;                // Tasks sampled by metricsSampleLoop().
+enum MetricsStage {                                       // Latency histograms; order must match METRICS_STAGE[].
+    METRICS_RTCM_TO_ZED,                                  // 0. metricsRelay.rxToZed.
+    METRICS_NMEA_TO_I2C,                                  // 1. metricsLoop.nmeaToI2c.
+    METRICS_EPOCH_TO_WS,                                  // 2. metricsLoop.epochToWs.
+    METRICS_LOOP,                                         // 3. metricsLoop.loopTime.
+    METRICS_NUM_STAGES                                    // 4 = automatic array length.
+};
+const char METRICS_STAGE[METRICS_NUM_STAGES][16] = {      // Stage names ("/metrics" label, showMetrics); match MetricsStage.
+    "rtcm_rx_to_zed", "nmea_to_i2c", "epoch_to_ws", "loop"
+};
+struct MetricsTask {                                      // One task sample.
+    char     name[16];                                    // configMAX_TASK_NAME_LEN.
+    uint32_t stackFree;                                   // Stack high water mark: least free stack so far (bytes).
+    int16_t  cpuPermille;                                 // Share of one core over METRICS_TASK_INTERVAL (0.1 %), -1 = no run time stats.
+};
+struct MetricsRelay {                                     // Writer: taskRtcmRelay() (core 0).
+    bool            rtcmIn;                               // RTCMin.
+    float           kbps;                                 // rtcmKbps.
+    uint32_t        frames;                               // rtcmFramer.framesOk (rtcmSentenceCount).
+    uint32_t        crcBad;                               // rtcmFramer.framesCrcBad.
+    uint32_t        falseStarts;                          // rtcmFramer.framesFalseStart.
+    uint32_t        bytesIn;                              // rtcmFramer.bytesIn.
+    uint32_t        bytesDiscarded;                       // rtcmFramer.bytesDiscarded.
+    uint32_t        bytesOverflow;                        // rtcmFramer.bytesOverflow.
+    uint8_t         numTypes;                             // rtcmFramer.numTypes.
+    Rtcm3TypeStats  types[RTCM3_MAX_TYPES];               // rtcmFramer.types (showRtcmStats).
+    float           ntripLatencyMs;                       // ntripLatencyMs.
+    MetricHistogram rxToZed;                              // Serial1 RX event (radio) or chunk queued (NTRIP) -> ZED UART2 write (us).
+};
+struct MetricsLoop {                                      // Writer: loop() (core 1), incl. DevUBLOXGNSS::processNMEA() & callbacks.
+    MetricHistogram nmeaToI2c;                            // Sentence framed -> Wire1 ack from GR-MCU2 (us).
+    MetricHistogram epochToWs;                            // Epoch complete (onNavPvt() & onNavHpposllh()) -> WebSocket send (us).
+    MetricHistogram loopTime;                             // loop() pass (us).
+    uint32_t        i2cRestarts;                          // Wire1 write failed, startI2C() re-run from DevUBLOXGNSS::processNMEA().
+    uint8_t         numTasks;
+    MetricsTask     task[METRICS_MAX_TASKS];
+};
+MetricSeqlock  metricsRelayLock       = {};
+MetricsRelay   metricsRelay           = {};
+MetricsRelay   metricsRelayCopy       = {};               // Last consistent copy for loop(). @see sendDataToBrowser(), debug().
+MetricSeqlock  metricsLoopLock        = {};
+MetricsLoop    metricsLoop            = {};
+volatile uint32_t rtcmRxEventUs       = 0;                // Serial1 RX event time (us, low 32 bits, never 0), 0 = taken by taskRtcmRelay().
+int64_t        gnssEpochTime          = 0;                // Time (us) the latest epoch completed, 0 = already sent. Only touched in loop().
 
 // --- Operation. ---
 enum CommandIndex {                                       //  Readable index for command array.
@@ -453,7 +694,13 @@ enum CommandIndex {                                       //  Readable index for
     DEBUG_NMEA_HEX,                                       // 13.
     DEBUG_NMEA_COUNTS,                                    // 14.
     DEBUG_PREFS,                                          // 15.
-    NUM_COMMANDS                                          // 16 = automatic array length.
+    RTCM_CRC_ONLY,                                        // 16.
+    SHOW_RTCM_STATS,                                      // 17.
+    DEBUG_NTRIP,                                          // 18.
+    LOG_SESSION,                                          // 19.
+    SHOW_LOG_STATS,                                       // 20.
+    SHOW_METRICS,                                         // 21.
+    NUM_COMMANDS                                          // 22 = automatic array length.
 };     
 const char* COMMAND[NUM_COMMANDS] = {                     // Command strings; match CommandIndex.
     "testRad",                                            // TEST_RAD.
@@ -471,7 +718,13 @@ const char* COMMAND[NUM_COMMANDS] = {                     // Command strings; ma
     "debugTemp",                                          // DEBUG_TEMP.
     "debugNMEAhex",                                       // DEBUG_NMEA_HEX.
     "debugNMEAcounts",                                    // DEBUG_NMEA_COUNTS.
-    "debugPrefs"                                          // DEBUG_PREFS.
+    "debugPrefs",                                         // DEBUG_PREFS.
+    "rtcmCrcOnly",                                        // RTCM_CRC_ONLY.
+    "showRtcmStats",                                      // SHOW_RTCM_STATS.
+    "debugNtrip",                                         // DEBUG_NTRIP.
+    "logSession",                                         // LOG_SESSION.
+    "showLogStats",                                       // SHOW_LOG_STATS.
+    "showMetrics"                                         // SHOW_METRICS.
 };     
 const bool    RW_MODE                   = false;          // Open preference name space as read/write.
 const bool    RO_MODE                   = true;           // Open preference name space as read only.
@@ -497,7 +750,6 @@ char          debugTemp[250]            = {'\0'};         // Various debug scena
 char          whichPage[10]             = {'\0'};         // Current browser page served by startHttpServer().
 char          buildString[40]           = {'\0'};         // Build string (build version on date at time). e.g. 3.0.12 - Feb 19 2026 @ 12:23:13
 char          serialState[4];                             // Serial state: [USB] [S0] [S1] [S2]; value = u, d, or -.
-char          nmeaBuffer[120]           = {'\0'};         // Buffer for NMEA sentence. @see DevUBLOXGNSS::processNMEA().  // ToDo: Move to local var?
 char          operBuffer[24]            = {'\0'};         // Buffer for Operate data.
 size_t        wsSendCount               = 0;              // # of WebSocket messages sent.
 size_t        rtcmSentenceCount         = 0;              // # of RTCM sentences in.
@@ -522,6 +774,7 @@ char           prfHotSsi[20];                             // WiFi hotspot client
 char           prfHotPas[30];                             // WiFi hotspot client: password.
 char           prfNtripCastAttr[4][NTRIP_CAST_ATTR_LEN];  // 2D Array of (4) NTRIP caster attribute profiles (each is in JSON format).
 char           prfNtripCastAct[2];                        // Which # NTRIP caster attribute profile is being used.
+portMUX_TYPE   prfNtripMux = portMUX_INITIALIZER_UNLOCKED;  // Guards prfNtripCastAttr[0-2] & prfNtripCastAct (loop() writes, taskNtripClient() reads).
 uint8_t        prfGnsNavRat;                              // ZED: OUTPUT every X (e.g. 5) MEASURE intervals every (e.g. 5*100=500) ms.
 
 uint16_t       prfGnsMsrInt;                              // ZED: MEASURE every Y (e.g. 100) ms.
@@ -545,18 +798,13 @@ struct         ntripCasterProfile {                       // NTRIP caster attrib
     uint8_t  id;
     uint8_t  version;
     uint16_t port;
+    uint16_t ggaInterval;                                 // Time between GGA uploads (s).
 };
 ntripCasterProfile ntripCaster = {};                      // NTRIP caster attribute profile being used.
 
 // --- Oper status. ---
 size_t  nmeaCountAll       = 0;
-size_t  nmeaCountGGA       = 0;
-size_t  nmeaCountRMC       = 0;
-size_t  nmeaCountGSA       = 0;
-size_t  nmeaCountGSV       = 0;
-size_t  nmeaCountGST       = 0;
-size_t  nmeaCountTXT       = 0;
-size_t  nmeaCountOther     = 0;
+size_t  nmeaCount[NMEA_NUM_TYPES] = {0};                  // NMEA out sentence count per NmeaType (GGA, RMC, ... , other).
 int64_t lastGGAsendTime    = 0; 
 int64_t nmeaRate           = 0;
 
@@ -571,11 +819,33 @@ int64_t nmeaRate           = 0;
  * @since 3.0.12 [2026-02-06-04:00pm] New.
  * @since 3.2.1  [2026-07-25-11:00am] Removed wsKey().
  * @since 3.2.1  [2026-07-26-09:00am] Add sendDataToBrowser().
+ * @since 3.2.2  [2026-10-16-02:00pm] Add sendTelemetryToBrowser().
+ * @since 3.2.2  [2026-10-16-06:00pm] Add ntripLoadCaster().
+ * @since 3.2.2  [2026-10-16-10:00pm] Add assetCacheLoad(), assetCacheFind(), assetCacheDrop().
+ * @since 3.2.2  [2026-10-16-11:00pm] Add metricsReadRelay(), metricsReadLoop(), metricsSampleLoop(), metricsPrint(), metricsToBrowser().
+ * @since 3.2.2  [2026-10-17-10:00am] Add wsClientAdd(), wsClientRemove(), wsClientsSync(), wsClientFind().
+ * @since 3.2.2  [2026-10-17-10:30am] Add prefNtripSet().
+ * @since 3.2.2  [2026-10-17-11:30am] Add assetCacheSwap().
  * @see   statusLedOn()           - Turn on status LED.
+ * @see   prefNtripSet()          - Set an NTRIP preference global var.
  * @see   prefUtility()           - Preference utility.
+ * @see   ntripLoadCaster()       - Load active NTRIP caster profile.
  * @see   buildOperData()         - Build data for operate page.
  * @see   sendDataToBrowser()     - Send jsonDocToBrowser.
- * @see   rtcm3GetMessageType()   - Return RTCM3 message type to taskRtcmRelay().
+ * @see   sendTelemetryToBrowser() - Send compact telemetry frame.
+ * @see   wsClientAdd()           - Track a connected WebSocket client.
+ * @see   wsClientRemove()        - Stop tracking a WebSocket client.
+ * @see   wsClientsSync()         - Bring wsClients[] up to date.
+ * @see   wsClientFind()          - Find a WebSocket client's telemetry state.
+ * @see   assetCacheSwap()        - Publish an asset cache table.
+ * @see   assetCacheLoad()        - Load pre-gzipped UI assets into PSRAM.
+ * @see   assetCacheFind()        - Find a cached asset.
+ * @see   assetCacheDrop()        - Drop a cached asset (file uploaded).
+ * @see   metricsReadRelay()      - Consistent copy of metricsRelay.
+ * @see   metricsReadLoop()       - Consistent copy of metricsLoop.
+ * @see   metricsSampleLoop()     - Record loop() time, sample task CPU & stack.
+ * @see   metricsPrint()          - Print metrics (Prometheus text format).
+ * @see   metricsToBrowser()      - Add metrics to the operate page JSON.
  */
 
 /**
@@ -604,9 +874,33 @@ void statusLedOn() {
         case WHITE:
             rgbLedWrite(LED_BUILTIN, LED_BRIGHT, LED_BRIGHT, LED_BRIGHT);
             break;
+        case OFF:                                               // statusLedOff().
+            break;
     }
 }
 
+/**
+ * -------------------------------------------------------------------------
+ *  Set an NTRIP preference global var.
+ * -------------------------------------------------------------------------
+ *
+ * prfNtripCastAttr[0-2] & prfNtripCastAct are written by loop() & parsed by taskNtripClient() (ntripLoadCaster())
+ * on the other core, so both sides copy under prfNtripMux. NVS reads go to a scratch buffer first: flash access
+ * isn't allowed inside a critical section.
+ *
+ * @param  array  dest    prfNtripCastAttr[0-2] or prfNtripCastAct.
+ * @param  size_t destLen sizeof(dest).
+ * @param  array  value   New value.
+ * @return void   No output is returned.
+ * @since  3.2.2  [2026-10-17-10:30am] New.
+ * @see    prefUtility(), processJsonActivity(), ntripLoadCaster().
+ */
+void prefNtripSet(char* dest, size_t destLen, const char* value) {
+    portENTER_CRITICAL(&prfNtripMux);
+    strlcpy(dest, value, destLen);
+    portEXIT_CRITICAL(&prfNtripMux);
+}
+
 /**
  * -------------------------------------------------------------------------
  *  Preference utility.
@@ -630,6 +924,8 @@ void statusLedOn() {
  * @since  3.1.2  [2026-07-20-03:15pm] NTRIP.
  * @since  3.2.1  [2026-07-24-03:30pm] Refactor JSON.
  * @since  3.2.1  [2026-07-28-04:45pm] Removed NMEA out switch & preference.
+ * @since  3.2.2  [2026-10-17-10:30am] NTRIP caster profiles & prfNtripCastAct set through prefNtripSet() (prfNtripMux).
+ * @since  3.2.2  [2026-10-17-10:45am] PREF_RESET stores the defaults. PREF_PRINT: NVS strings as c_str().
  * 
  * @see    Global vars: Preference defaults, setup().
  * @link   https://docs.espressif.com/projects/arduino-esp32/en/latest/tutorials/preferences.html.
@@ -643,9 +939,9 @@ void prefUtility(prefAction action, const char* key = NULL, const char* value =
     const char      DEF_RTC_IN[]            = "radio";          // Default control RTCM in: off/radio/ntrip.                                         2 - Matching global var: char     prfRtcIn[6].
     const char      DEF_HOT_SSI[]           = "ssid";           // Default WiFi hotspot client: network SSID.                                        4 - Matching global var: char     prfHotSsi[20].
     const char      DEF_HOT_PASS[]          = "pass";           // Default WiFi hotspot client: password.                                            5 - Matching global var: char     prfHotPas[30].
-    const char      DEF_NTRIP_CAST_ATTR_1[] = "{\"43\":\"1\",\"44\":\"name 1\",\"45\":\"x.com\",\"46\":\"ABC\",\"47\":\"2101\",\"48\":\"1\",\"49\":\"user1\",\"50\":\"pass1\",\"51\":\"1\"}";
-    const char      DEF_NTRIP_CAST_ATTR_2[] = "{\"43\":\"2\",\"44\":\"name 2\",\"45\":\"y.com\",\"46\":\"DEF\",\"47\":\"2101\",\"48\":\"1\",\"49\":\"user2\",\"50\":\"pass2\",\"51\":\"1\"}";
-    const char      DEF_NTRIP_CAST_ATTR_3[] = "{\"43\":\"3\",\"44\":\"name 3\",\"45\":\"z.com\",\"46\":\"GHI\",\"47\":\"2101\",\"48\":\"1\",\"49\":\"user3\",\"50\":\"pass3\",\"51\":\"1\"}";
+    const char      DEF_NTRIP_CAST_ATTR_1[] = "{\"43\":\"1\",\"44\":\"name 1\",\"45\":\"x.com\",\"46\":\"ABC\",\"47\":\"2101\",\"48\":\"1\",\"49\":\"user1\",\"50\":\"pass1\",\"51\":\"1\",\"53\":\"10\"}";
+    const char      DEF_NTRIP_CAST_ATTR_2[] = "{\"43\":\"2\",\"44\":\"name 2\",\"45\":\"y.com\",\"46\":\"DEF\",\"47\":\"2101\",\"48\":\"1\",\"49\":\"user2\",\"50\":\"pass2\",\"51\":\"1\",\"53\":\"10\"}";
+    const char      DEF_NTRIP_CAST_ATTR_3[] = "{\"43\":\"3\",\"44\":\"name 3\",\"45\":\"z.com\",\"46\":\"GHI\",\"47\":\"2101\",\"48\":\"1\",\"49\":\"user3\",\"50\":\"pass3\",\"51\":\"1\",\"53\":\"10\"}";
                                                                 // Default NTRIP caster attribute profile 1.                                         6 - Matching global var: char     prfNtripCastAttr[0].
                                                                 // Default NTRIP caster attribute profile 2.                                         7 - Matching global var: char     prfNtripCastAttr[1].
                                                                 // Default NTRIP caster attribute profile 3.                                         8 - Matching global var: char     prfNtripCastAttr[2].
@@ -654,7 +950,6 @@ void prefUtility(prefAction action, const char* key = NULL, const char* value =
     const uint16_t  DEF_GNS_MSR_INT         = 100;              // Default ZED interval (ms): CREATE a new solution.                                11 - Matching global var: uint16_t prfGnsMsrInt.
     const uint16_t  DEF_INSTR_HGT           = 128;              // Default instrument height (mm - includes rover height [128] + pole height [0]).  12 - Matching global var: uint16_t prfInstrHgt.
     const uint16_t  NUM_PREFS               = 12;               // Number of preferences being used.
-    bool            hasKey                  = false;
 
     // --- Which action? ---
     switch (action) {
@@ -670,7 +965,7 @@ void prefUtility(prefAction action, const char* key = NULL, const char* value =
 
             // -- Close name space. --
             roverPrefs.end();
-            Serial.printf("NVS namespace %s using %u entries with %u available.\n", NAMESPACE, NUM_PREFS, roverPrefs.freeEntries());
+            Serial.printf("NVS namespace %s using %u entries with %zu available.\n", NAMESPACE, NUM_PREFS, roverPrefs.freeEntries());
             break;
 
         case PREF_READ:
@@ -683,10 +978,14 @@ void prefUtility(prefAction action, const char* key = NULL, const char* value =
             roverPrefs.getString("prfRtcIn",        prfRtcIn,            sizeof(prfRtcIn));
             roverPrefs.getString("prfHotSsi",       prfHotSsi,           sizeof(prfHotSsi));
             roverPrefs.getString("prfHotPas",       prfHotPas,           sizeof(prfHotPas));
-            roverPrefs.getString("prfNtripCaster1", prfNtripCastAttr[0], NTRIP_CAST_ATTR_LEN);
-            roverPrefs.getString("prfNtripCaster2", prfNtripCastAttr[1], NTRIP_CAST_ATTR_LEN);
-            roverPrefs.getString("prfNtripCaster3", prfNtripCastAttr[2], NTRIP_CAST_ATTR_LEN);
-            roverPrefs.getString("prfNtripCastAct", prfNtripCastAct,     sizeof(prfNtripCastAct));
+            roverPrefs.getString("prfNtripCaster1", prfNtripCastAttr[3], NTRIP_CAST_ATTR_LEN);   // Read into scratch profile [3] (loop() only),
+            prefNtripSet(prfNtripCastAttr[0], NTRIP_CAST_ATTR_LEN, prfNtripCastAttr[3]);                                        // then copy under prfNtripMux.
+            roverPrefs.getString("prfNtripCaster2", prfNtripCastAttr[3], NTRIP_CAST_ATTR_LEN);
+            prefNtripSet(prfNtripCastAttr[1], NTRIP_CAST_ATTR_LEN, prfNtripCastAttr[3]);
+            roverPrefs.getString("prfNtripCaster3", prfNtripCastAttr[3], NTRIP_CAST_ATTR_LEN);
+            prefNtripSet(prfNtripCastAttr[2], NTRIP_CAST_ATTR_LEN, prfNtripCastAttr[3]);
+            roverPrefs.getString("prfNtripCastAct", prfNtripCastAttr[3], sizeof(prfNtripCastAct));
+            prefNtripSet(prfNtripCastAct,     sizeof(prfNtripCastAct), prfNtripCastAttr[3]);
             prfGnsNavRat    = roverPrefs.getUShort("prfGnsNavRat");           
             prfGnsMsrInt    = roverPrefs.getUShort("prfGnsMsrInt");
             prfInstrHgt     = roverPrefs.getUShort("prfInstrHgt");
@@ -726,17 +1025,18 @@ void prefUtility(prefAction action, const char* key = NULL, const char* value =
             strlcpy(prfRtcIn,            DEF_RTC_IN,            sizeof(prfRtcIn));
             strlcpy(prfHotSsi,           DEF_HOT_SSI,           sizeof(prfHotSsi));
             strlcpy(prfHotPas,           DEF_HOT_PASS,          sizeof(prfHotPas));
-            strlcpy(prfNtripCastAttr[0], DEF_NTRIP_CAST_ATTR_1, NTRIP_CAST_ATTR_LEN);
-            strlcpy(prfNtripCastAttr[1], DEF_NTRIP_CAST_ATTR_2, NTRIP_CAST_ATTR_LEN);
-            strlcpy(prfNtripCastAttr[2], DEF_NTRIP_CAST_ATTR_3, NTRIP_CAST_ATTR_LEN);
-            strlcpy(prfNtripCastAct,     DEF_NTRIP_CAST_ACT,    sizeof(prfNtripCastAct));
+            prefNtripSet(prfNtripCastAttr[0], NTRIP_CAST_ATTR_LEN, DEF_NTRIP_CAST_ATTR_1);
+            prefNtripSet(prfNtripCastAttr[1], NTRIP_CAST_ATTR_LEN, DEF_NTRIP_CAST_ATTR_2);
+            prefNtripSet(prfNtripCastAttr[2], NTRIP_CAST_ATTR_LEN, DEF_NTRIP_CAST_ATTR_3);
+            prefNtripSet(prfNtripCastAct,     sizeof(prfNtripCastAct), DEF_NTRIP_CAST_ACT);
             prfGnsNavRat               = DEF_GNS_NAV_RAT;
             prfGnsMsrInt               = DEF_GNS_MSR_INT;
             prfInstrHgt                = DEF_INSTR_HGT;
 
-            // -- Close name space. --
+            // -- Close name space, store defaults (PREF_READ, e.g. sendPrefs, reads NVS). --
             roverPrefs.end();
             Serial.println("Resetting all preferences.");
+            prefUtility(PREF_SET);
             break;
 
         case PREF_PRINT:
@@ -746,13 +1046,13 @@ void prefUtility(prefAction action, const char* key = NULL, const char* value =
 
             // -- Print values. --
             Serial.println("---                    Default, Global, NVS. ---");
-            Serial.printf( "prfUnt                 \"%s\", \"%s\", \"%s\"\n", DEF_UNT,            prfUnt,          roverPrefs.getString("prfUnt"));
-            Serial.printf( "prfRtcIn               \"%s\", \"%s\", \"%s\"\n", DEF_RTC_IN,         prfRtcIn,        roverPrefs.getString("prfRtcIn"));
-            Serial.printf( "prfHotSsi              \"%s\", \"%s\", \"%s\"\n", DEF_HOT_SSI,        prfHotSsi,       roverPrefs.getString("prfHotSsi"));
-            Serial.printf( "prfHotPas              \"%s\", \"%s\", \"%s\"\n", DEF_HOT_PASS,       prfHotPas,       roverPrefs.getString("prfHotPas"));
+            Serial.printf( "prfUnt                 \"%s\", \"%s\", \"%s\"\n", DEF_UNT,            prfUnt,          roverPrefs.getString("prfUnt").c_str());
+            Serial.printf( "prfRtcIn               \"%s\", \"%s\", \"%s\"\n", DEF_RTC_IN,         prfRtcIn,        roverPrefs.getString("prfRtcIn").c_str());
+            Serial.printf( "prfHotSsi              \"%s\", \"%s\", \"%s\"\n", DEF_HOT_SSI,        prfHotSsi,       roverPrefs.getString("prfHotSsi").c_str());
+            Serial.printf( "prfHotPas              \"%s\", \"%s\", \"%s\"\n", DEF_HOT_PASS,       prfHotPas,       roverPrefs.getString("prfHotPas").c_str());
             Serial.printf( "prfGnsNavRat           %u, %u, %u\n",             DEF_GNS_NAV_RAT,    prfGnsNavRat,    roverPrefs.getUShort("prfGnsNavRat"));
             Serial.printf( "prfGnsMsrInt           %u, %u, %u\n",             DEF_GNS_MSR_INT,    prfGnsMsrInt,    roverPrefs.getUShort("prfGnsMsrInt"));
-            Serial.printf( "prfNtripCastAct        \"%s\", \"%s\", \"%s\"\n", DEF_NTRIP_CAST_ACT, prfNtripCastAct, roverPrefs.getString("prfNtripCastAct"));
+            Serial.printf( "prfNtripCastAct        \"%s\", \"%s\", \"%s\"\n", DEF_NTRIP_CAST_ACT, prfNtripCastAct, roverPrefs.getString("prfNtripCastAct").c_str());
             Serial.printf( "DEF_NTRIP_CAST_ATTR_1  \"%s\"\n", DEF_NTRIP_CAST_ATTR_1);
             Serial.printf( "prfNtripCastAttr[0]    \"%s\"\n", prfNtripCastAttr[0]);
             roverPrefs.getString("prfNtripCaster1", prfNtripCastAttr[3], NTRIP_CAST_ATTR_LEN);
@@ -795,30 +1095,109 @@ void prefUtility(prefAction action, const char* key = NULL, const char* value =
     }
 }
 
+/**
+ * -------------------------------------------------------------------------
+ *  Load active NTRIP caster profile.
+ * -------------------------------------------------------------------------
+ *
+ * Parses prfNtripCastAttr[prfNtripCastAct - 1] (JSON, all values are strings) for taskNtripClient().
+ * The global ntripCaster is the profile last saved on the config page, not necessarily the active one.
+ * loop() writes the profiles on the other core (prefNtripSet()), so the active one is copied under prfNtripMux
+ * & the copy is parsed.
+ *
+ * @param  ntripCasterProfile* caster Output.
+ * @return bool  true if the profile has a caster URL & mount point.
+ * @since  3.2.2 [2026-10-16-06:00pm] New.
+ * @since  3.2.2 [2026-10-17-10:30am] Parse a copy taken under prfNtripMux.
+ * @see    taskNtripClient(), prefUtility(), prefNtripSet().
+ */
+bool ntripLoadCaster(ntripCasterProfile* caster) {
+
+    // --- Local vars. ---
+    static char  attr[NTRIP_CAST_ATTR_LEN];                                 // Copy of the active profile (only taskNtripClient() calls this).
+    JsonDocument doc;
+    uint8_t      which = 0;
+
+    // --- Copy the active profile (loop() may be writing it), parse the copy. ---
+    portENTER_CRITICAL(&prfNtripMux);
+    which = atoi(prfNtripCastAct);
+    if ((which >= 1) && (which <= 3)) {
+        memcpy(attr, prfNtripCastAttr[which - 1], NTRIP_CAST_ATTR_LEN);
+    }
+    portEXIT_CRITICAL(&prfNtripMux);
+    attr[NTRIP_CAST_ATTR_LEN - 1] = '\0';
+    if ((which < 1) || (which > 3) || deserializeJson(doc, attr)) {
+        return false;
+    }
+    memset(caster, 0, sizeof(ntripCasterProfile));
+    strlcpy(caster->name,  doc["44"] | "", sizeof(caster->name));
+    strlcpy(caster->url,   doc["45"] | "", sizeof(caster->url));
+    strlcpy(caster->mount, doc["46"] | "", sizeof(caster->mount));
+    strlcpy(caster->user,  doc["49"] | "", sizeof(caster->user));
+    strlcpy(caster->pass,  doc["50"] | "", sizeof(caster->pass));
+    caster->id          = which;
+    caster->port        = atoi(doc["47"] | "2101");
+    caster->version     = atoi(doc["48"] | "1");
+    caster->sendGga     = (atoi(doc["51"] | "0") != 0);
+    caster->ggaInterval = atoi(doc["53"] | "0");
+    if (caster->ggaInterval == 0) {
+        caster->ggaInterval = NTRIP_GGA_INTERVAL_DEF;                       // Profile saved before key "53" existed.
+    }
+    return (caster->url[0] != '\0') && (caster->mount[0] != '\0');
+}
+
 /**
  * -------------------------------------------------------------------------
  *  Build data for operate page.
  * -------------------------------------------------------------------------
  *
+ * Reads only the gnssEpoch snapshot (filled by onNavPvt() & onNavHpposllh()), so every value comes from
+ * one epoch (gnssEpochTow) & no I2C getter polls compete with NMEA forwarding on Wire1.
+ * Publishes once per epoch, or every GNSS_EPOCH_TIMEOUT with GNSS down if epochs stop.
+ * The fuel gauge is read every BATTERY_READ_INTERVAL.
+ *
  * @return void  No output is returned.
  * @since  3.0.10 [2026-01-08-01:30pm] New
  * @since  3.0.12 [2026-02-18-11:00pm] Shorten RTCM & NMEA status.
  * @since  3.2.1  [2026-07-26-06:30pm] Refactor.
- * @see    Global vars: WebSockets, setup().
+ * @since  3.2.2  [2026-10-16-04:00pm] Read gnssEpoch snapshot, not roverGNSS getters. Rate limit battery reads.
+ * @see    Global vars: WebSockets, GNSS, setup().
+ * @see    onNavPvt(), onNavHpposllh().
  */
  void buildOperData() {
 
-    // -- Satellites in view. --
-    numSatInView = roverGNSS.getSIV();
+    // --- Local vars. ---
+    static int64_t lastPublish     = 0;
+    static int64_t lastBatteryRead = -BATTERY_READ_INTERVAL;                // Read on first call.
+    int64_t        now             = esp_timer_get_time();
+
+    // -- Battery. Independent of fix. --
+    if ((now - lastBatteryRead) >= BATTERY_READ_INTERVAL) {
+        batterySoc        = lipo.getSOC();
+        batteryChangeRate = lipo.getChangeRate();
+        lastBatteryRead   = now;
+    }
+
+    // -- New epoch? --
+    if (gnssEpoch.ready) {
+        gnssEpoch.ready = false;
+        gnssEpochTow    = gnssEpoch.hpTow;
+        numSatInView    = gnssEpoch.numSv;                                  // Satellites in view.
+    } else if ((now - lastPublish) >= GNSS_EPOCH_TIMEOUT) {
+        numSatInView    = 0;                                                // No epochs: GNSS down.
+    } else {
+        return;                                                             // Nothing new.
+    }
+    lastPublish = now;
 
     if (numSatInView > MIN_SATELLITE_THRESHHOLD) {                          // Enough satellites?
 
         // -- Fix type. --
-        if (roverGNSS.getFixType() == 3) {
+        if (gnssEpoch.fixType == 3) {
             fixType = 1;                                                    // Single.
-        } else if (roverGNSS.getCarrierSolutionType() == 1 ) {
+        } else if (gnssEpoch.carrSoln == 1 ) {
             fixType = 2;                                                    // RTK-float.
-        } else if (roverGNSS.getCarrierSolutionType() == 2 ) {
+        } else if (gnssEpoch.carrSoln == 2 ) {
             fixType = 3;                                                    // RTK-fix.
         }
 
@@ -833,45 +1212,33 @@ void prefUtility(prefAction action, const char* key = NULL, const char* value =
          */
 
         // -- Height - ellipsoid (h). --
-        int32_t ellipsoid     = roverGNSS.getElipsoid();                    // mm
-        int8_t ellipsoidHp    = roverGNSS.getElipsoidHp();                  // mm * 10^-1.
-        heightEllipsoid = (ellipsoid * 10 + ellipsoidHp) / 10000.0;         // Convert to meters.
+        heightEllipsoid   = (gnssEpoch.height * 10 + gnssEpoch.heightHp) / 10000.0;    // mm & mm * 10^-1. Convert to meters.
 
         // -- Height - orthometric (H). --
-        int32_t msl               = roverGNSS.getMeanSeaLevel();            // a.k.a getAltitudeMSL()?
-        int8_t  mslHp             = roverGNSS.getMeanSeaLevelHp();
-        heightOrthometric = (msl * 10 + mslHp) / 10000.0;
+        heightOrthometric = (gnssEpoch.hMsl * 10 + gnssEpoch.hMslHp) / 10000.0;
 
         // -- Latitude. --
-        int32_t latitude   = roverGNSS.getHighResLatitude();                // Degrees * 10^-7.
-        int8_t  latitudeHp = roverGNSS.getHighResLatitudeHp();              // High precision component: degrees * 10^-9.
-        lat  = latitude / 10000000.0;                                       // Convert to to 64 bit double - degrees (8 decimal places).
-        lat += latitudeHp / 1000000000.0;                                   // Add high precision component.
+        lat  = gnssEpoch.lat / 10000000.0;                                  // Convert to to 64 bit double - degrees (8 decimal places).
+        lat += gnssEpoch.latHp / 1000000000.0;                              // Add high precision component.
 
         // -- Longitude. --
-        int32_t longitude   = roverGNSS.getHighResLongitude();
-        int8_t  longitudeHp = roverGNSS.getHighResLongitudeHp();
-        lon  = longitude / 10000000.0;
-        lon += longitudeHp / 1000000000.0;
+        lon  = gnssEpoch.lon / 10000000.0;
+        lon += gnssEpoch.lonHp / 1000000000.0;
 
         // -- Horizontal & vertical accuracy. --
-        accuracyHorizontal = roverGNSS.getHorizontalAccuracy() / 10000.0;
-        accuracyVertical   = roverGNSS.getVerticalAccuracy() / 10000.0;
+        accuracyHorizontal = gnssEpoch.hAcc / 10000.0;
+        accuracyVertical   = gnssEpoch.vAcc / 10000.0;
 
         // -- RTCM & BT status. --
         // @see sendDataToBrowser().
-
-        // -- Battery. --
-        batterySoc        = lipo.getSOC();
-        batteryChangeRate = lipo.getChangeRate();
-
-        // -- Status. --
-        int32_t seconds = (esp_timer_get_time() - startTime)/1000000;
-        int32_t minutes = seconds / 60;
-        int32_t hours = minutes / 60;
-        snprintf(uptime, sizeof(uptime), "%uh %um %us", hours % 24, minutes % 60, seconds % 60);
     }
 
+    // -- Status. --
+    int32_t seconds = (now - startTime)/1000000;
+    int32_t minutes = seconds / 60;
+    int32_t hours = minutes / 60;
+    snprintf(uptime, sizeof(uptime), "%uh %um %us", hours % 24, minutes % 60, seconds % 60);
+
     // -- Flag pending browser update. Global vars are sent as JSON by processJsonActivity(). --
     browserUpdatePending = true;
 }
@@ -884,116 +1251,722 @@ void prefUtility(prefAction action, const char* key = NULL, const char* value =
  * @return void No output is returned.
  * @since  3.2.1 [2026-07-26-06:30pm] New.
  * @since  3.2.1 [2026-07-30-10:30am] jsonDocToBrowser["NMEA"] '= lastNmea' was '= nmeaBuffer'.
+ * @since  3.2.2 [2026-10-16-02:00pm] Compact telemetry (sendTelemetryToBrowser()). Removed memset() before each snprintf().
+ * @since  3.2.2 [2026-10-16-11:00pm] RTCM status from metricsRelayCopy (seqlock), metricsToBrowser(), epoch -> WebSocket latency.
+ * @since  3.2.2 [2026-10-17-10:00am] Compact or JSON per client (wsClients[]). Compact clients get ws.text()/ws.binary() by id.
+ * @since  3.2.2 [2026-10-17-02:30pm] GNSS down: zero WS_TLM_JSON_KEY[0 - 7] ("14" was left, "2" & "3" zeroed), status fields still sent.
  * @see    checkZedTriggerUpdate(), processJsonActivity(), DevUBLOXGNSS::processNMEA().
  * @see    processJsonActivity() for description of exchange protocol.
  */
 void sendDataToBrowser() {
 
+    // --- Local vars. ---
+    uint8_t numCompact = 0;                         // Clients that asked for compact telemetry.
+    uint8_t numJson    = 0;                         // Other clients.
+    bool    sendJson   = false;                     // Full JSON update goes out.
+    size_t  jsonLen    = 0;
+
+    // --- RTCM status: consistent copy from taskRtcmRelay() (core 0). Keeps the last copy if the relay was mid update. ---
+    metricsReadRelay(&metricsRelayCopy);
+
+    // --- Clients. ---
+    wsClientsSync();
+    for (uint8_t i = 0; i < WS_MAX_CLIENTS; i++) {
+        if (wsClients[i].id != 0) {
+            wsClients[i].compact ? numCompact++ : numJson++;
+        }
+    }
+    sendJson = (numJson > 0) || (numCompact == 0);  // No compact client: JSON to all, as before compact telemetry.
+
+    // --- Operate page metrics ("57" - "62"), JSON in both modes. ---
+    if (strcmp(whichPage, "operate") == 0) {
+        metricsToBrowser();
+    }
+
+    // --- Compact clients: responses & metrics as JSON (preferences, e.g. units, first), then GNSS STATUS & NMEA SENTENCE as binary frames. ---
+    if (numCompact > 0) {
+        if (jsonDocToBrowser.size() > 0) {          // Compact periodic update has no JSON (except metrics).
+            jsonLen = serializeJson(jsonDocToBrowser, jsonBuffer, sizeof(jsonBuffer));    // serializeJson() always terminates.
+        }
+        for (uint8_t i = 0; i < WS_MAX_CLIENTS; i++) {
+            if ((wsClients[i].id == 0) || (!wsClients[i].compact)) {
+                continue;
+            }
+            if (jsonLen > 0) {
+                ws.text(wsClients[i].id, jsonBuffer, jsonLen);
+                wsSendCount++;
+            }
+            sendTelemetryToBrowser(&wsClients[i]);
+        }
+    }
+
     // --- NMEA page. ---
-    if (strcmp(whichPage, "nmea") == 0) {
+    if (sendJson && (strcmp(whichPage, "nmea") == 0)) {
         jsonDocToBrowser["NMEA"] = lastNmea;
     }
 
     // --- Operate page. ---
-    if (strcmp(whichPage, "operate") == 0) {
+    if (sendJson && (strcmp(whichPage, "operate") == 0)) {
         if (numSatInView < MIN_SATELLITE_THRESHHOLD) {
 
-            // --GNSS down. --
-            jsonDocToBrowser["8"]  = 0;
-            jsonDocToBrowser["9"]  = 0;
-            jsonDocToBrowser["12"] = 0;
-            jsonDocToBrowser["13"] = 0;
-            jsonDocToBrowser["10"] = 0;
-            jsonDocToBrowser["11"] = 0;
-            jsonDocToBrowser["15"] = 0;
-            jsonDocToBrowser["2"]  = 0;
-            jsonDocToBrowser["3"]  = 0;
+            // --GNSS down. Same fields as compact (wsTlmGnssDown()). --
+            for (uint8_t i = 0; i < WS_TLM_NUM_GNSS; i++) {
+                jsonDocToBrowser[WS_TLM_JSON_KEY[i]] = 0;
+            }
         } else {
             jsonDocToBrowser["8"] = fixType;
             jsonDocToBrowser["9"] = numSatInView;
-            memset(operBuffer, '\0', sizeof(operBuffer));
-            snprintf(operBuffer, sizeof(operBuffer), "%.2f", heightEllipsoid);
+            snprintf(operBuffer, sizeof(operBuffer), "%.2f", heightEllipsoid);     // snprintf() always terminates.
             jsonDocToBrowser["10"] = operBuffer;
-            memset(operBuffer, '\0', sizeof(operBuffer));
             snprintf(operBuffer, sizeof(operBuffer), "%.2f", heightOrthometric);
             jsonDocToBrowser["11"] = operBuffer;
-            memset(operBuffer, '\0', sizeof(operBuffer));
             snprintf(operBuffer, sizeof(operBuffer), "%.8f", lat);
             jsonDocToBrowser["12"] = operBuffer;
-            memset(operBuffer, '\0', sizeof(operBuffer));
             snprintf(operBuffer, sizeof(operBuffer), "%.8f", lon);
             jsonDocToBrowser["13"] = operBuffer;
-            memset(operBuffer, '\0', sizeof(operBuffer));
             snprintf(operBuffer, sizeof(operBuffer), "%.3f", accuracyHorizontal);
             jsonDocToBrowser["14"] = operBuffer;
-            memset(operBuffer, '\0', sizeof(operBuffer));
             snprintf(operBuffer, sizeof(operBuffer), "%.3f", accuracyVertical);
             jsonDocToBrowser["15"] = operBuffer;
-            jsonDocToBrowser["16"] = (RTCMin)  ? "u" : "d";         // Up, down. @see relaySerial1toSerial2().
-            jsonDocToBrowser["17"] = (NMEAout) ? "u" : "d";         // Up, down. @see DevUBLOXGNSS::processNMEA().
-            memset(operBuffer, '\0', sizeof(operBuffer));
-            snprintf(operBuffer, sizeof(operBuffer), "%.2f", batterySoc);
-            jsonDocToBrowser["18"] = operBuffer;
-            memset(operBuffer, '\0', sizeof(operBuffer));
-            snprintf(operBuffer, sizeof(operBuffer), "%.1f", batteryChangeRate);
-            jsonDocToBrowser["19"] = operBuffer;
-            jsonDocToBrowser["20"] = uptime;
-            jsonDocToBrowser["23"] = nmeaCountGGA;
-            jsonDocToBrowser["24"] = nmeaCountRMC;
-            jsonDocToBrowser["25"] = nmeaCountGSA;
-            jsonDocToBrowser["26"] = nmeaCountGSV;
-            jsonDocToBrowser["27"] = nmeaCountGST;
-            jsonDocToBrowser["28"] = nmeaCountTXT;
-            jsonDocToBrowser["29"] = nmeaCountOther;
-            jsonDocToBrowser["30"] = nmeaCountAll;
-            jsonDocToBrowser["31"] = nmeaRate;
-            jsonDocToBrowser["32"] = operMode;
-            jsonDocToBrowser["33"] = localIp;
-            jsonDocToBrowser["34"] = hotspotIp;
-            jsonDocToBrowser["37"] = rtcmSentenceCount;
-            jsonDocToBrowser["38"] = rtcmKbps;
-        }
-    }
-
-    // --- All pages. ---
-    memset(jsonBuffer, '\0', sizeof(jsonBuffer));
-    serializeJson(jsonDocToBrowser, jsonBuffer, sizeof(jsonBuffer));
-    ws.textAll(jsonBuffer);                         // Send WebSocket message.
+        }
+        jsonDocToBrowser["16"] = (metricsRelayCopy.rtcmIn) ? "u" : "d";   // Up, down. @see taskRtcmRelay().
+        jsonDocToBrowser["17"] = (NMEAout) ? "u" : "d";         // Up, down. @see DevUBLOXGNSS::processNMEA().
+        snprintf(operBuffer, sizeof(operBuffer), "%.2f", batterySoc);
+        jsonDocToBrowser["18"] = operBuffer;
+        snprintf(operBuffer, sizeof(operBuffer), "%.1f", batteryChangeRate);
+        jsonDocToBrowser["19"] = operBuffer;
+        jsonDocToBrowser["20"] = uptime;
+        jsonDocToBrowser["23"] = nmeaCount[NMEA_TYPE_GGA];
+        jsonDocToBrowser["24"] = nmeaCount[NMEA_TYPE_RMC];
+        jsonDocToBrowser["25"] = nmeaCount[NMEA_TYPE_GSA];
+        jsonDocToBrowser["26"] = nmeaCount[NMEA_TYPE_GSV];
+        jsonDocToBrowser["27"] = nmeaCount[NMEA_TYPE_GST];
+        jsonDocToBrowser["28"] = nmeaCount[NMEA_TYPE_TXT];
+        jsonDocToBrowser["29"] = nmeaCountAll - nmeaCount[NMEA_TYPE_GGA] - nmeaCount[NMEA_TYPE_RMC] - nmeaCount[NMEA_TYPE_GSA]
+                                              - nmeaCount[NMEA_TYPE_GSV] - nmeaCount[NMEA_TYPE_GST] - nmeaCount[NMEA_TYPE_TXT];   // GLL, VTG, ZDA, GNS & other.
+        jsonDocToBrowser["30"] = nmeaCountAll;
+        jsonDocToBrowser["31"] = nmeaRate;
+        jsonDocToBrowser["32"] = operMode;
+        jsonDocToBrowser["33"] = localIp;
+        jsonDocToBrowser["34"] = hotspotIp;
+        jsonDocToBrowser["37"] = metricsRelayCopy.frames;
+        jsonDocToBrowser["38"] = metricsRelayCopy.kbps;
+        jsonDocToBrowser["52"] = gnssEpochTow;
+        jsonDocToBrowser["54"] = metricsRelayCopy.ntripLatencyMs;
+        jsonDocToBrowser["55"] = ntripBytesPerSec;
+        jsonDocToBrowser["56"] = ntripReconnects;
+    }
+
+    // --- JSON clients, all pages. ---
+    if (sendJson) {
+        jsonLen = serializeJson(jsonDocToBrowser, jsonBuffer, sizeof(jsonBuffer));     // serializeJson() always terminates.
+        if (numCompact == 0) {
+            ws.textAll(jsonBuffer, jsonLen);        // Send WebSocket message.
+        } else {
+            for (uint8_t i = 0; i < WS_MAX_CLIENTS; i++) {
+                if ((wsClients[i].id != 0) && (!wsClients[i].compact)) {
+                    ws.text(wsClients[i].id, jsonBuffer, jsonLen);
+                }
+            }
+        }
+        wsSendCount++;
+    }
+    if (jsonLen > 0) {
+        if (commandFlag[DEBUG_WS]) {                // Debug.
+            Serial.printf("WS #%u: browser <-- %s\n\n", clientId, jsonBuffer);
+        } else {
+            if (response[0] != '\0') {
+                Serial.println(response);
+            }
+        }
+    }
+
+    // --- Metrics: epoch -> WebSocket send. ---
+    if ((gnssEpochTime != 0) && (strcmp(whichPage, "operate") == 0)) {
+        metricWriteBegin(&metricsLoopLock);
+        metricHistRecord(&metricsLoop.epochToWs, esp_timer_get_time() - gnssEpochTime);
+        metricWriteEnd(&metricsLoopLock);
+        gnssEpochTime = 0;
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Send compact telemetry to browser.
+ * -------------------------------------------------------------------------
+ *
+ * Operate page: snapshot the GNSS STATUS values (same values & precision as the JSON keys), send a binary
+ * keyframe or a delta frame with only the changed fields. NMEA page: send lastNmea as a raw binary frame.
+ * Frames are built on the stack, nothing is allocated. Each client has its own encoder, so a delta is always
+ * against what that client was sent.
+ *
+ * @param  WsClient* client Compact telemetry client.
+ * @return void      No output is returned.
+ * @since  3.2.2 [2026-10-16-02:00pm] New.
+ * @since  3.2.2 [2026-10-16-11:00pm] RTCM status from metricsRelayCopy.
+ * @since  3.2.2 [2026-10-17-10:00am] One client (encoder, keyframe state), ws.binary() by id instead of ws.binaryAll().
+ * @since  3.2.2 [2026-10-17-02:30pm] GNSS down through wsTlmGnssDown().
+ * @see    sendDataToBrowser(), wsTelemetry.h, telemetryDecode() in global.js.
+ */
+void sendTelemetryToBrowser(WsClient* client) {
+
+    // --- Local vars. ---
+    uint8_t frame[WS_TLM_MAX_FRAME];
+    size_t  frameLen = 0;
+
+    // --- NMEA page. ---
+    if (strcmp(whichPage, "nmea") == 0) {
+        frameLen = wsTlmEncodeNmea(&client->encoder, lastNmea, strlen(lastNmea), frame);
+    }
+
+    // --- Operate page. ---
+    if (strcmp(whichPage, "operate") == 0) {
+        WsTelemetry now = client->encoder.last;     // Fields not updated below are unchanged.
+        IPAddress ip;
+        now.value[WS_TLM_FIX]                = fixType;
+        now.value[WS_TLM_SIV]                = numSatInView;
+        now.value[WS_TLM_HEIGHT_ELLIPSOID]   = llround(heightEllipsoid    * 100.0);
+        now.value[WS_TLM_HEIGHT_ORTHOMETRIC] = llround(heightOrthometric  * 100.0);
+        now.value[WS_TLM_LAT]                = llround(lat                * 100000000.0);
+        now.value[WS_TLM_LON]                = llround(lon                * 100000000.0);
+        now.value[WS_TLM_ACCURACY_H]         = llround(accuracyHorizontal * 1000.0);
+        now.value[WS_TLM_ACCURACY_V]         = llround(accuracyVertical   * 1000.0);
+        if (numSatInView < MIN_SATELLITE_THRESHHOLD) {
+            wsTlmGnssDown(&now);                    // GNSS down: same fields as the JSON path.
+        }
+        now.value[WS_TLM_RTCM_IN]            = metricsRelayCopy.rtcmIn;     // Copied by sendDataToBrowser().
+        now.value[WS_TLM_NMEA_OUT]           = NMEAout;
+        now.value[WS_TLM_BATTERY_SOC]        = llround(batterySoc        * 100.0);
+        now.value[WS_TLM_BATTERY_RATE]       = llround(batteryChangeRate * 10.0);
+        now.value[WS_TLM_UPTIME]             = (esp_timer_get_time() - startTime) / 1000000;
+        for (uint8_t i = 0; i <= NMEA_TYPE_TXT; i++) {
+            now.value[WS_TLM_NMEA_GGA + i]   = nmeaCount[i];
+        }
+        now.value[WS_TLM_NMEA_OTHER]         = nmeaCountAll - nmeaCount[NMEA_TYPE_GGA] - nmeaCount[NMEA_TYPE_RMC] - nmeaCount[NMEA_TYPE_GSA]
+                                                            - nmeaCount[NMEA_TYPE_GSV] - nmeaCount[NMEA_TYPE_GST] - nmeaCount[NMEA_TYPE_TXT];
+        now.value[WS_TLM_NMEA_ALL]           = nmeaCountAll;
+        now.value[WS_TLM_NMEA_RATE]          = nmeaRate;
+        now.value[WS_TLM_OPER_MODE]          = operMode[0];
+        now.value[WS_TLM_LOCAL_IP]           = ip.fromString(localIp)   ? (uint32_t)ip : 0;
+        now.value[WS_TLM_HOTSPOT_IP]         = ip.fromString(hotspotIp) ? (uint32_t)ip : 0;
+        now.value[WS_TLM_RTCM_COUNT]         = metricsRelayCopy.frames;
+        now.value[WS_TLM_RTCM_KBPS]          = llround(metricsRelayCopy.kbps * 100.0);
+        now.value[WS_TLM_EPOCH]              = gnssEpochTow;
+        now.value[WS_TLM_NTRIP_LATENCY]      = llround(metricsRelayCopy.ntripLatencyMs * 10.0);
+        now.value[WS_TLM_NTRIP_BPS]          = ntripBytesPerSec;
+        now.value[WS_TLM_NTRIP_RECONNECTS]   = ntripReconnects;
+
+        // -- Keyframe first, periodically & on request, otherwise delta. --
+        if ((esp_timer_get_time() - client->lastKeyframe) > WS_TLM_KEYFRAME_INTERVAL) {
+            client->keyframePending = true;
+        }
+        frameLen = wsTlmEncode(&client->encoder, &now, client->keyframePending, frame);
+        if ((frameLen > 0) && (frame[0] == WS_TLM_KEYFRAME)) {
+            client->keyframePending = false;
+            client->lastKeyframe    = esp_timer_get_time();
+        }
+    }
+
+    // --- Send. ---
+    if (frameLen == 0) {                            // Nothing changed.
+        return;
+    }
+    ws.binary(client->id, frame, frameLen);         // Send WebSocket message (looks the client up under the AsyncWebSocket lock).
     wsSendCount++;
     if (commandFlag[DEBUG_WS]) {                    // Debug.
-        Serial.printf("WS #%u: browser <-- %s\n\n", clientId, jsonBuffer);
-    } else {
-        if (response[0] != '\0') {
-            Serial.println(response);
+        Serial.printf("WS #%lu: browser <-- [%c #%u, %zu bytes] (keyframes=%lu, deltas=%lu, total=%" PRIu64 " bytes).\n",
+            (unsigned long)client->id, frame[0], frame[1], frameLen, (unsigned long)client->encoder.keyframes,
+            (unsigned long)client->encoder.deltas, client->encoder.bytesOut);
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Track a connected WebSocket client.
+ * -------------------------------------------------------------------------
+ *
+ * Called from onWebSocketEvent() (AsyncTCP task). Only the ID is shared; loop() picks it up in wsClientsSync().
+ *
+ * @param  uint32_t id AsyncWebSocketClient::id().
+ * @return void     No output is returned. A client that finds no free slot gets JSON (textAll) only.
+ * @since  3.2.2 [2026-10-17-10:00am] New.
+ * @see    wsClientRemove(), wsClientsSync().
+ */
+void wsClientAdd(uint32_t id) {
+    portENTER_CRITICAL(&wsClientsMux);
+    for (uint8_t i = 0; i < WS_MAX_CLIENTS; i++) {
+        if (wsClientIds[i] == 0) {
+            wsClientIds[i] = id;
+            break;
         }
     }
+    portEXIT_CRITICAL(&wsClientsMux);
 }
 
 /**
  * -------------------------------------------------------------------------
- *  Return RTCM3 message type to taskRtcmRelay().
+ *  Stop tracking a WebSocket client.
  * -------------------------------------------------------------------------
- * 
- * RTCM3 message structure:
- *   Byte 0: Preamble (0xD3).
- *   Byte 1-2: Reserved (6 bits) + Message length (10 bits).
- *   Byte 3-4: Message type (12 bits) + rest of message.
- *      - Message type starts at bit 24 (byte 3) and is 12 bits long.
- *      - It occupies the upper 8 bits of byte 3 and upper 4 bits of byte 4.
- *
- * @param  array RTCM3 sentence.
- * @return uint16_t Message type.
- * @since  0.8.7 [2025-12-16-06:00pm] New.
- * @see    checkRTCMtoRadio().
- * @link   https://portal.u-blox.com/s/question/0D52p0000C7MwDfCQK/can-you-find-out-the-message-type-of-a-given-rtcm3-message.
- */
-uint16_t rtcm3GetMessageType(const char* rtcmSentence) {
-    // Serial.printf("[%02x] [%02x] [%02x] [%02x] [%02x]\n", rtcmSentence[0],  rtcmSentence[1], rtcmSentence[2], rtcmSentence[3], rtcmSentence[3]);
-    if (rtcmSentence[0] != 0xD3) {    // Check if preamble is correct
-        return 0;               // Invalid preamble.
-    }
-    uint16_t message_type = ((uint16_t)rtcmSentence[3] << 4) | (rtcmSentence[4] >> 4);
-    return message_type;
+ *
+ * @param  uint32_t id AsyncWebSocketClient::id().
+ * @return void     No output is returned.
+ * @since  3.2.2 [2026-10-17-10:00am] New.
+ * @see    wsClientAdd(), wsClientsSync().
+ */
+void wsClientRemove(uint32_t id) {
+    portENTER_CRITICAL(&wsClientsMux);
+    for (uint8_t i = 0; i < WS_MAX_CLIENTS; i++) {
+        if (wsClientIds[i] == id) {
+            wsClientIds[i] = 0;
+        }
+    }
+    portEXIT_CRITICAL(&wsClientsMux);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Bring wsClients[] up to date.
+ * -------------------------------------------------------------------------
+ *
+ * A slot whose ID changed (connect, disconnect, reuse) starts over: JSON until the client asks for compact,
+ * keyframe first, new encoder.
+ *
+ * @return void No output is returned.
+ * @since  3.2.2 [2026-10-17-10:00am] New.
+ * @see    sendDataToBrowser(), processJsonActivity().
+ */
+void wsClientsSync() {
+    uint32_t ids[WS_MAX_CLIENTS];
+    portENTER_CRITICAL(&wsClientsMux);
+    memcpy(ids, wsClientIds, sizeof(ids));
+    portEXIT_CRITICAL(&wsClientsMux);
+    for (uint8_t i = 0; i < WS_MAX_CLIENTS; i++) {
+        if (wsClients[i].id != ids[i]) {
+            wsClients[i]                 = {};
+            wsClients[i].id              = ids[i];
+            wsClients[i].keyframePending = true;
+        }
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Find a WebSocket client's telemetry state.
+ * -------------------------------------------------------------------------
+ *
+ * @param  uint32_t  id AsyncWebSocketClient::id().
+ * @return WsClient*    Client, NULL if not tracked.
+ * @since  3.2.2 [2026-10-17-10:00am] New.
+ * @see    processJsonActivity().
+ */
+WsClient* wsClientFind(uint32_t id) {
+    wsClientsSync();
+    for (uint8_t i = 0; i < WS_MAX_CLIENTS; i++) {
+        if ((id != 0) && (wsClients[i].id == id)) {
+            return &wsClients[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Publish an asset cache table.
+ * -------------------------------------------------------------------------
+ *
+ * Only the pointer swap is under assetCacheMux. The old table is released after the lock, so its
+ * buffers are never freed inside the critical section.
+ *
+ * @param  shared_ptr table New table (NULL = no cache).
+ * @return void       No output is returned.
+ * @since  3.2.2 [2026-10-17-11:30am] New.
+ * @see    assetCacheLoad(), assetCacheDrop().
+ */
+void assetCacheSwap(std::shared_ptr<AssetCacheTable> table) {
+    portENTER_CRITICAL(&assetCacheMux);
+    assetCache.swap(table);
+    portEXIT_CRITICAL(&assetCacheMux);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Load pre-gzipped UI assets into PSRAM.
+ * -------------------------------------------------------------------------
+ *
+ * Reads ASSET_MANIFEST & each "<name>.gz" written by tools/gzipAssets.py. An asset is only cached if the
+ * SHA-256 of its .gz bytes matches the manifest hash, so a stale .gz (uploaded without a new manifest)
+ * is never served under the wrong ETag; it is served from SD instead. No manifest, no PSRAM: no cache,
+ * serveStatic() serves everything from SD as before.
+ *
+ * The new table is built aside while the old one keeps serving, then swapped in (assetCacheSwap()).
+ * Responses still sending from the old table keep their buffers (shared_ptr) until they finish.
+ *
+ * @return void No output is returned.
+ * @since  3.2.2 [2026-10-16-10:00pm] New.
+ * @since  3.2.2 [2026-10-17-11:30am] Build aside & swap in, no in place changes.
+ * @see    startHttpServer(), onHttpFileUpload(), tools/gzipAssets.py.
+ */
+void assetCacheLoad() {
+
+    // --- Local vars. ---
+    char          line[96];
+    char          name[32];
+    char          hash[17];
+    char          gzPath[40];
+    char          digestHex[17];
+    uint8_t       digest[32];
+    unsigned long gzLen   = 0;
+    unsigned long rawLen  = 0;
+    size_t        gzTotal = 0;
+    size_t        rawTotal = 0;
+    std::shared_ptr<AssetCacheTable> table = std::make_shared<AssetCacheTable>();   // Built aside.
+
+    // --- Manifest. ---
+    File manifest = SD.open(ASSET_MANIFEST, "r");
+    if (!manifest) {
+        Serial.printf("Asset cache: no %s, serving from SD.\n", ASSET_MANIFEST);
+        assetCacheSwap(NULL);
+        return;
+    }
+    while (manifest.available() && (table->count < ASSET_CACHE_MAX)) {
+        line[manifest.readBytesUntil('\n', line, sizeof(line) - 1)] = '\0';
+        if (sscanf(line, "%31s %16s %lu %lu", name, hash, &gzLen, &rawLen) != 4) {
+            continue;
+        }
+
+        // -- Load .gz. --
+        snprintf(gzPath, sizeof(gzPath), "/%s.gz", name);
+        File gzFile = SD.open(gzPath, "r");
+        if ((!gzFile) || (gzFile.size() != gzLen)) {
+            Serial.printf("Asset cache: %s missing or stale, serving from SD.\n", gzPath);
+            gzFile.close();
+            continue;
+        }
+        uint8_t* buffer = (uint8_t*)heap_caps_malloc(gzLen, MALLOC_CAP_SPIRAM);
+        if (buffer == NULL) {
+            Serial.println("Asset cache: out of PSRAM.");
+            break;
+        }
+        size_t bytesRead = gzFile.read(buffer, gzLen);
+        gzFile.close();
+        if (bytesRead != gzLen) {
+            free(buffer);
+            continue;
+        }
+
+        // -- Check content hash. --
+        mbedtls_sha256(buffer, gzLen, digest, 0);
+        for (uint8_t i = 0; i < 8; i++) {
+            snprintf(&digestHex[i * 2], 3, "%02x", digest[i]);
+        }
+        if (strcmp(digestHex, hash) != 0) {
+            Serial.printf("Asset cache: %s hash mismatch, serving from SD.\n", gzPath);
+            free(buffer);
+            continue;
+        }
+
+        // -- Add. --
+        AssetCacheEntry* asset = &table->entries[table->count++];
+        const char*      ext   = strrchr(name, '.');
+        snprintf(asset->path, sizeof(asset->path), "/%s", name);
+        snprintf(asset->etag, sizeof(asset->etag), "\"%s\"", hash);
+        asset->type = (ext == NULL)              ? "application/octet-stream" :
+                      (strcmp(ext, ".html") == 0) ? "text/html" :
+                      (strcmp(ext, ".css")  == 0) ? "text/css" :
+                      (strcmp(ext, ".js")   == 0) ? "text/javascript" : "application/octet-stream";
+        asset->data = std::shared_ptr<uint8_t>(buffer, free);
+        asset->len  = gzLen;
+        gzTotal    += gzLen;
+        rawTotal   += rawLen;
+    }
+    manifest.close();
+    Serial.printf("Asset cache: %u files, %zu bytes gzip (%zu raw) in PSRAM.\n", table->count, gzTotal, rawTotal);
+    assetCacheSwap(table);
+}
+
+
+/**
+ * -------------------------------------------------------------------------
+ *  Find a cached asset.
+ * -------------------------------------------------------------------------
+ *
+ * Takes a reference to the published table under assetCacheMux & copies the entry out, so a drop or reload
+ * that swaps the table while a response is sending can't change or free what the response uses.
+ *
+ * @param  const char*      path  Request path (e.g. "/operate.js").
+ * @param  AssetCacheEntry* asset Output (may be NULL: only check). Holds a reference to the data.
+ * @return bool                   true if cached, false if not cached (or dropped).
+ * @since  3.2.2 [2026-10-16-10:00pm] New.
+ * @since  3.2.2 [2026-10-17-11:30am] Copy out of the published table, was a pointer into it.
+ * @see    startHttpServer(), assetCacheSwap().
+ */
+bool assetCacheFind(const char* path, AssetCacheEntry* asset) {
+    std::shared_ptr<AssetCacheTable> table;
+    portENTER_CRITICAL(&assetCacheMux);
+    table = assetCache;
+    portEXIT_CRITICAL(&assetCacheMux);
+    if (table == NULL) {
+        return false;
+    }
+    for (uint8_t i = 0; i < table->count; i++) {
+        if (table->entries[i].data && (strcmp(table->entries[i].path, path) == 0)) {
+            if (asset != NULL) {
+                *asset = table->entries[i];
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Drop a cached asset (file uploaded).
+ * -------------------------------------------------------------------------
+ *
+ * "name" or "name.gz" uploaded: the cached copy is out of date, serve from SD until the next assetCacheLoad().
+ * Copies the published table without the entry & swaps the copy in. Writers (setup(), onHttpFileUpload())
+ * all run before the server starts or on the AsyncTCP task, so two never interleave.
+ *
+ * @param  const char* filename Uploaded file name (no leading "/").
+ * @return bool        true if an entry was dropped.
+ * @since  3.2.2 [2026-10-16-10:00pm] New.
+ * @since  3.2.2 [2026-10-17-11:30am] Copy & swap, no in place change.
+ * @see    onHttpFileUpload(), assetCacheSwap().
+ */
+bool assetCacheDrop(const char* filename) {
+
+    // --- Local vars. ---
+    char   path[40];
+    size_t len = strlen(filename);
+
+    // --- Find & drop. ---
+    if ((len > 3) && (strcmp(&filename[len - 3], ".gz") == 0)) {
+        len -= 3;                                           // "name.gz" -> "name".
+    }
+    snprintf(path, sizeof(path), "/%.*s", (int)len, filename);
+    portENTER_CRITICAL(&assetCacheMux);
+    std::shared_ptr<AssetCacheTable> current = assetCache;
+    portEXIT_CRITICAL(&assetCacheMux);
+    if ((current == NULL) || (!assetCacheFind(path, NULL))) {
+        return false;
+    }
+    std::shared_ptr<AssetCacheTable> table = std::make_shared<AssetCacheTable>(*current);
+    for (uint8_t i = 0; i < table->count; i++) {
+        if (strcmp(table->entries[i].path, path) == 0) {
+            table->entries[i].data.reset();
+        }
+    }
+    assetCacheSwap(table);
+    Serial.printf("Asset cache: %s dropped.\n", path);
+    return true;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Consistent copy of metricsRelay.
+ * -------------------------------------------------------------------------
+ *
+ * @param  MetricsRelay* copy Output. Unchanged (last good copy) if taskRtcmRelay() kept writing.
+ * @return bool          true if copied.
+ * @since  3.2.2 [2026-10-16-11:00pm] New.
+ * @see    metrics.h.
+ */
+bool metricsReadRelay(MetricsRelay* copy) {
+    MetricsRelay scratch;
+    return metricRead(&metricsRelayLock, &metricsRelay, copy, sizeof(MetricsRelay), &scratch);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Consistent copy of metricsLoop.
+ * -------------------------------------------------------------------------
+ *
+ * Only needed off loop(): loop() is the writer & reads metricsLoop directly.
+ *
+ * @param  MetricsLoop* copy Output. Unchanged (last good copy) if loop() kept writing.
+ * @return bool         true if copied.
+ * @since  3.2.2 [2026-10-16-11:00pm] New.
+ * @see    metrics.h.
+ */
+bool metricsReadLoop(MetricsLoop* copy) {
+    MetricsLoop scratch;
+    return metricRead(&metricsLoopLock, &metricsLoop, copy, sizeof(MetricsLoop), &scratch);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Record loop() time, sample task CPU & stack.
+ * -------------------------------------------------------------------------
+ *
+ * Called once per loop() pass. Task CPU needs FreeRTOS run time stats (configGENERATE_RUN_TIME_STATS),
+ * cpuPermille is -1 without them & on a task's first sample. Tasks are sampled outside the seqlock write, so readers only ever
+ * wait for a copy.
+ *
+ * @return void No output is returned.
+ * @since  3.2.2 [2026-10-16-11:00pm] New.
+ * @since  3.2.2 [2026-10-17-04:30pm] No CPU figure on a slot's first sample (task started after the first pass).
+ * @see    loop(), metricsPrint().
+ * @link   https://www.freertos.org/Documentation/02-Kernel/04-API-references/03-Task-utilities/00-Task-utilities.
+ */
+void metricsSampleLoop() {
+
+    // --- Local vars. ---
+    static int64_t     lastPass   = esp_timer_get_time();
+    static int64_t     lastSample = 0;
+#if (configGENERATE_RUN_TIME_STATS == 1)
+    static uint32_t    lastRun[METRICS_MAX_TASKS] = {0};  // Run time counters at lastSample, by handle[] slot.
+    static bool        seen[METRICS_MAX_TASKS]    = {0};  // lastRun[] holds a sample (the slot's task was started).
+    static uint32_t    lastTotal  = 0;
+#endif
+    static MetricsTask sample[METRICS_MAX_TASKS];
+           int64_t     now        = esp_timer_get_time();
+           uint8_t     numTasks   = 0;
+
+    // --- Tasks. ---
+    if ((now - lastSample) >= METRICS_TASK_INTERVAL) {
+        TaskHandle_t handle[METRICS_MAX_TASKS] = {
+            xTaskGetCurrentTaskHandle(), taskRtcmRelayHandle, taskNtripClientHandle, taskSessionLoggerHandle,
+            taskLoopStatusLedHandle, xTaskGetHandle("async_tcp"), NULL, NULL
+        };
+#if (configGENERATE_RUN_TIME_STATS == 1)
+        uint32_t total = (uint32_t)portGET_RUN_TIME_COUNTER_VALUE();
+#endif
+        for (uint8_t i = 0; i < METRICS_MAX_TASKS; i++) {
+            if (handle[i] == NULL) {                        // Not started.
+                continue;
+            }
+            MetricsTask* task = &sample[numTasks++];
+            strlcpy(task->name, pcTaskGetName(handle[i]), sizeof(task->name));
+            task->stackFree   = uxTaskGetStackHighWaterMark(handle[i]);   // Bytes on ESP-IDF.
+            task->cpuPermille = -1;
+#if (configGENERATE_RUN_TIME_STATS == 1)
+            uint32_t run = (uint32_t)ulTaskGetRunTimeCounter(handle[i]);
+            if (seen[i] && (total != lastTotal)) {            // First sample of a slot: no lastRun[] yet, CPU unknown.
+                task->cpuPermille = (int16_t)(((uint64_t)(run - lastRun[i]) * 1000) / (total - lastTotal));
+            }
+            lastRun[i] = run;
+            seen[i]    = true;
+#endif
+        }
+#if (configGENERATE_RUN_TIME_STATS == 1)
+        lastTotal = total;
+#endif
+        lastSample = now;
+    }
+
+    // --- Publish. ---
+    metricWriteBegin(&metricsLoopLock);
+    metricHistRecord(&metricsLoop.loopTime, now - lastPass);
+    if (numTasks > 0) {
+        memcpy(metricsLoop.task, sample, sizeof(sample));
+        metricsLoop.numTasks = numTasks;
+    }
+    metricWriteEnd(&metricsLoopLock);
+    lastPass = now;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Print metrics (Prometheus text format).
+ * -------------------------------------------------------------------------
+ *
+ * Latency histograms are cumulative since boot (le = bucket upper bound, us), so any scraper can
+ * compute rates & percentiles over its own window.
+ *
+ * @param  Print& out Output ("/metrics" response stream).
+ * @return void   No output is returned.
+ * @since  3.2.2 [2026-10-16-11:00pm] New.
+ * @see    startHttpServer().
+ * @link   https://prometheus.io/docs/instrumenting/exposition_formats/.
+ */
+void metricsPrint(Print& out) {
+
+    // --- Local vars. Last good copies, only called from the AsyncTCP task. ---
+    static MetricsRelay relay     = {};
+    static MetricsLoop  loopStats = {};
+    metricsReadRelay(&relay);
+    metricsReadLoop(&loopStats);
+    const MetricHistogram* hist[METRICS_NUM_STAGES] = {&relay.rxToZed, &loopStats.nmeaToI2c, &loopStats.epochToWs, &loopStats.loopTime};
+
+    // --- Status. ---
+    out.printf("gr_rtcm_in %u\n", relay.rtcmIn ? 1 : 0);
+    out.printf("gr_rtcm_kbps %.2f\n", relay.kbps);
+    out.printf("gr_rtcm_frames_total %lu\n", (unsigned long)relay.frames);
+    out.printf("gr_rtcm_crc_bad_total %lu\n", (unsigned long)relay.crcBad);
+    out.printf("gr_ntrip_latency_ms %.1f\n", relay.ntripLatencyMs);
+    out.printf("gr_i2c_restarts_total %lu\n", (unsigned long)loopStats.i2cRestarts);
+    out.printf("gr_heap_free_bytes %lu\n", (unsigned long)ESP.getFreeHeap());
+    out.printf("gr_psram_free_bytes %lu\n", (unsigned long)ESP.getFreePsram());
+
+    // --- Latency. ---
+    out.print("# TYPE gr_latency_us histogram\n");
+    for (uint8_t stage = 0; stage < METRICS_NUM_STAGES; stage++) {
+        uint32_t count = 0;
+        for (uint8_t i = 0; i < METRIC_BUCKETS - 1; i++) {
+            count += hist[stage]->bucket[i];
+            out.printf("gr_latency_us_bucket{stage=\"%s\",le=\"%lu\"} %lu\n", METRICS_STAGE[stage],
+                (unsigned long)metricHistBucketMax(i), (unsigned long)count);
+        }
+        out.printf("gr_latency_us_bucket{stage=\"%s\",le=\"+Inf\"} %lu\n", METRICS_STAGE[stage], (unsigned long)hist[stage]->count);
+        out.printf("gr_latency_us_sum{stage=\"%s\"} %" PRIu64 "\n", METRICS_STAGE[stage], hist[stage]->sumUs);
+        out.printf("gr_latency_us_count{stage=\"%s\"} %lu\n", METRICS_STAGE[stage], (unsigned long)hist[stage]->count);
+        out.printf("gr_latency_us_max{stage=\"%s\"} %lu\n", METRICS_STAGE[stage], (unsigned long)hist[stage]->maxUs);
+    }
+
+    // --- Tasks. ---
+    for (uint8_t i = 0; i < loopStats.numTasks; i++) {
+        out.printf("gr_task_stack_free_bytes{task=\"%s\"} %lu\n", loopStats.task[i].name, (unsigned long)loopStats.task[i].stackFree);
+        if (loopStats.task[i].cpuPermille >= 0) {
+            out.printf("gr_task_cpu_permille{task=\"%s\"} %d\n", loopStats.task[i].name, loopStats.task[i].cpuPermille);
+        }
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Add metrics to the operate page JSON.
+ * -------------------------------------------------------------------------
+ *
+ * Every METRICS_PAGE_INTERVAL: p95 of each stage over the interval (ms), I2C restarts & the task with the
+ * least free stack. Sent as JSON in compact mode too (no free compact telemetry field left).
+ *
+ * @return void No output is returned.
+ * @since  3.2.2 [2026-10-16-11:00pm] New.
+ * @see    sendDataToBrowser(), operateMessage() in operate.js.
+ */
+void metricsToBrowser() {
+
+    // --- Local vars. ---
+    static int64_t      lastSend  = 0;
+    static MetricsRelay relayPrev = {};                     // Copies at lastSend (window start).
+    static MetricsLoop  loopPrev  = {};
+    const  MetricsTask* lowest    = NULL;
+    char                stackText[32];                      // "name bytes" (name is configMAX_TASK_NAME_LEN max).
+
+    // --- Throttle. ---
+    if ((esp_timer_get_time() - lastSend) < METRICS_PAGE_INTERVAL) {
+        return;
+    }
+    lastSend = esp_timer_get_time();
+
+    // --- Window p95 (ms). loop() is the metricsLoop writer, read directly. ---
+    jsonDocToBrowser["57"] = metricHistPercentile(&metricsRelayCopy.rxToZed, &relayPrev.rxToZed, 95) / 1000.0f;
+    jsonDocToBrowser["58"] = metricHistPercentile(&metricsLoop.nmeaToI2c, &loopPrev.nmeaToI2c, 95) / 1000.0f;
+    jsonDocToBrowser["59"] = metricHistPercentile(&metricsLoop.epochToWs, &loopPrev.epochToWs, 95) / 1000.0f;
+    jsonDocToBrowser["60"] = metricHistPercentile(&metricsLoop.loopTime,  &loopPrev.loopTime,  95) / 1000.0f;
+    jsonDocToBrowser["61"] = metricsLoop.i2cRestarts;
+    for (uint8_t i = 0; i < metricsLoop.numTasks; i++) {
+        if ((lowest == NULL) || (metricsLoop.task[i].stackFree < lowest->stackFree)) {
+            lowest = &metricsLoop.task[i];
+        }
+    }
+    if (lowest != NULL) {
+        snprintf(stackText, sizeof(stackText), "%s %lu", lowest->name, (unsigned long)lowest->stackFree);
+        jsonDocToBrowser["62"] = stackText;
+    }
+    relayPrev = metricsRelayCopy;
+    loopPrev  = metricsLoop;
 }
 
 /**
@@ -1040,7 +2013,7 @@ void showBuild() {
     // --- Local vars. ---
     const char      NAME[]           = "Ghost Rover 3";
     const uint32_t  SERIAL_USB_SPEED = 115200;   // Serial USB speed.
-    const uint64_t  START_DELAY      = 4000000;  // 4 second startup delay.
+    const int64_t   START_DELAY      = 4000000;  // 4 second startup delay.
     esp_chip_info_t chip_info;
 
     // --- Run. ---
@@ -1059,7 +2032,7 @@ void showBuild() {
     // Serial.print("\033[2J");   // Clear screen before displaying boot messages.
     Serial.println('\n');         // Empty lines before displaying boot messages.
     Serial.printf("%s\n%s\n", NAME, buildString);
-    Serial.printf("Using %s, Rev %d, %d core(s), ID (MAC) %012llX.\n", ESP.getChipModel(), chip_info.revision, chip_info.cores, ESP.getEfuseMac());
+    Serial.printf("Using %s, Rev %d, %d core(s), ID (MAC) %012" PRIX64 ".\n", ESP.getChipModel(), chip_info.revision, chip_info.cores, ESP.getEfuseMac());
     Serial.println("setup() started.");
     Serial.printf("Serial (USB) started @ %u bps.\n", SERIAL_USB_SPEED);
 }
@@ -1145,8 +2118,7 @@ void initPins() {
 void startI2C() {
 
     // --- Local vars. ---
-    const uint8_t  I2C0_SDA   =  6;       // Primary I2C bus - data.
-    const uint8_t  I2C0_SCL   =  7;       // Primary I2C bus - clock.
+    // Primary I2C bus (Wire): board default pins, data 6 & clock 7.
     const uint8_t  I2C1_SDA   = 14;       // Secondary I2C bus - data.
     const uint8_t  I2C1_SCL   = 10;       // Secondary I2C bus - clock.
     const uint16_t RETRY      = 500;      // Try restarting I2C interfaces.
@@ -1272,7 +2244,7 @@ void startWiFi() {
                 delay(1000);                            // Try again.
             }
             if (numTrys == maxTrys) {
-                Serial.printf(", max trys exceeded, not connected.\n", prfHotSsi);
+                Serial.printf(", max trys exceeded, not connected.\n");
                 strlcpy(hotspotIp, " ", sizeof(hotspotIp));
             }
         }
@@ -1357,11 +2329,25 @@ void startSD() {
  * -------------------------------------------------------------------------
  *
  * Set endpoints & start.
+ *
+ * Session log files (taskSessionLogger()) can also be downloaded by time range, seconds since the file was opened:
+ *   /download?file=log0003.ubx&from=600&to=900
+ * Byte offsets come from the matching ".idx" file (logIndexFind() in sessionLog.h). Either end may be left off.
+ *
+ * Asset cache: GETs for a cached asset (assetCacheFind()) from a gzip capable browser are answered from PSRAM
+ * with ETag & Cache-Control, or 304 if the browser's If-None-Match is current. No SD read either way.
+ * Everything else (not cached, dropped, images, log files) falls through to serveStatic() on SD. An asset
+ * dropped between the filter & the handler is sent from SD (or 404). tools/ttfbLoad.py measures TTFB under load.
  * 
  * @return void  No output is returned.
  * @since  3.0.7 [2025-11-11-06:15pm].
  * @since  3.0.10 [2026-01-07-11:30am] Local vars.
- * @see    setup(), onHttpFileUpload().
+ * @since  3.2.2  [2026-10-16-08:00pm] Session log time range download ("from", "to").
+ * @since  3.2.2  [2026-10-16-10:00pm] Asset cache route (PSRAM, gzip, ETag, 304) ahead of serveStatic().
+ * @since  3.2.2  [2026-10-16-11:00pm] "/metrics" (metricsPrint()).
+ * @since  3.2.2  [2026-10-17-11:00am] Session log range: 500 if the log file won't open, close the index file on errors.
+ * @since  3.2.2  [2026-10-17-11:30am] Asset route: entry copied out (assetCacheFind()), dropped since the filter -> SD or 404.
+ * @see    setup(), onHttpFileUpload(), taskSessionLogger(), assetCacheLoad(), metricsPrint().
  * @link   https://github.com/ESP32Async/ESPAsyncWebServer/wiki#get-post-and-file-parameters.
  * @link   https://github.com/ESP32Async/AsyncTCP.
  * @link   https://github.com/ESP32Async/ESPAsyncWebServer.
@@ -1390,16 +2376,113 @@ void startHttpServer() {
         if (request->hasParam("file")) {                    // Process request.
             String filename = request->getParam("file")->value();
             String filepath = "/" + filename;
-            if (SD.exists(filepath)) {
+            if (SD.exists(filepath) && (request->hasParam("from") || request->hasParam("to"))) {
+
+                // -- Session log time range. --
+                String   extension = filepath.substring(filepath.lastIndexOf('.') + 1);
+                File     indexFile = SD.open(filepath.substring(0, filepath.lastIndexOf('.') + 1) + "idx", "r");
+                int8_t   stream    = -1;
+                uint32_t start     = 0;
+                uint32_t end       = UINT32_MAX;
+                for (uint8_t i = 0; i < LOG_NUM_STREAMS; i++) {
+                    if (extension == LOG_EXTENSION[i]) {
+                        stream = i;
+                    }
+                }
+                if ((stream < 0) || (!indexFile) || (indexFile.size() < sizeof(LogIndexEntry))) {
+                    indexFile.close();
+                    request->send(400, "text/plain", "Not a session log file");
+                    return;
+                }
+                size_t count = indexFile.size() / sizeof(LogIndexEntry);
+                LogIndexEntry* entries = (LogIndexEntry*)heap_caps_malloc(count * sizeof(LogIndexEntry), MALLOC_CAP_SPIRAM);
+                if (entries == NULL) {
+                    entries = (LogIndexEntry*)malloc(count * sizeof(LogIndexEntry));
+                }
+                if (entries == NULL) {
+                    indexFile.close();
+                    request->send(500, "text/plain", "Out of memory");
+                    return;
+                }
+                count = indexFile.read((uint8_t*)entries, count * sizeof(LogIndexEntry)) / sizeof(LogIndexEntry);
+                indexFile.close();
+                if (request->hasParam("from")) {
+                    start = logIndexFind(entries, count, (uint32_t)request->getParam("from")->value().toInt() * 1000, stream, false);
+                }
+                if (request->hasParam("to")) {
+                    end   = logIndexFind(entries, count, (uint32_t)request->getParam("to")->value().toInt() * 1000, stream, true);
+                }
+                free(entries);
+
+                // -- Send bytes [start, end). --
+                File logFile = SD.open(filepath, "r");
+                if (!logFile) {
+                    request->send(500, "text/plain", "File open failed");
+                    Serial.printf("httpServer - File open failed: %s\n", filename.c_str());
+                    return;
+                }
+                end   = (end > logFile.size()) ? logFile.size() : end;
+                start = (start > end) ? end : start;
+                logFile.seek(start);
+                size_t rangeLen = end - start;
+                AsyncWebServerResponse *response = request->beginResponse("application/octet-stream", rangeLen,
+                    [logFile, rangeLen](uint8_t *buffer, size_t maxLen, size_t index) mutable -> size_t {
+                        return logFile.read(buffer, ((rangeLen - index) < maxLen) ? (rangeLen - index) : maxLen);
+                    });
+                response->addHeader("Content-Disposition", "attachment; filename=\"" + filename + "\"");
+                request->send(response);
+                Serial.printf("httpServer - Downloading file: %s bytes %lu-%lu\n", filename.c_str(), (unsigned long)start, (unsigned long)end);
+            } else if (SD.exists(filepath)) {
                 request->send(SD, filepath, "application/octet-stream", true);
                 Serial.printf("httpServer - Downloading file: %s\n", filename.c_str());
             } else {
                 request->send(404, "text/plain", "File not found");
-                Serial.printf("File not found: %s\n", filename.c_str());
+                Serial.printf("File not found: %s\n", filename.c_str());
+            }
+        } else {
+            request->send(400, "text/plain", "File parameter required");
+        }
+    });
+
+    // --- Route: metrics (Prometheus text format). ---
+    httpServer.on("/metrics", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("text/plain; version=0.0.4");
+        response->addHeader("Cache-Control", "no-store");
+        metricsPrint(*response);
+        request->send(response);
+    });
+
+    // --- Route: cached assets. Filter picks cached paths only, misses go on to serveStatic(). ---
+    assetCacheLoad();
+    httpServer.on("/*", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AssetCacheEntry         asset;
+        AsyncWebServerResponse* response;
+        if (!assetCacheFind(request->url().c_str(), &asset)) {
+            if (SD.exists(request->url()) || SD.exists(request->url() + ".gz")) {   // Dropped since the filter ran: serve from SD.
+                request->send(SD, request->url());
+            } else {
+                request->send(404, "text/plain", "File not found");
             }
+            return;
+        }
+        if (request->hasHeader("If-None-Match") && (request->header("If-None-Match").indexOf(asset.etag) >= 0)) {
+            response = request->beginResponse(304);         // Browser copy is current.
         } else {
-            request->send(400, "text/plain", "File parameter required");
+            std::shared_ptr<uint8_t> data = asset.data;     // Keeps the buffer while sending, even after a drop or reload.
+            size_t                   len  = asset.len;
+            response = request->beginResponse(asset.type, len, [data, len](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+                size_t chunk = ((len - index) < maxLen) ? (len - index) : maxLen;
+                memcpy(buffer, data.get() + index, chunk);
+                return chunk;
+            });
+            response->addHeader("Content-Encoding", "gzip");
         }
+        response->addHeader("ETag", asset.etag);
+        response->addHeader("Cache-Control", ASSET_CACHE_CONTROL);
+        request->send(response);
+    }).setFilter([](AsyncWebServerRequest *request) {
+        return assetCacheFind(request->url().c_str(), NULL) &&
+               request->hasHeader("Accept-Encoding") && (request->header("Accept-Encoding").indexOf("gzip") >= 0);
     });
 
     // --- Start server. ---
@@ -1445,6 +2528,9 @@ void startWebSocketServer() {
  * @since  3.0.11 [2026-01-14-10:45am] Cleanup.
  * @since  3.0.11 [2026-01-26-04:15pm] Rework config, see wiring diagram.
  * @since  3.0.12 [2026-02-01-12:15pm] Changed to prfGnsNavRat & prfGnsMsrInt.
+ * @since  3.2.2  [2026-10-16-04:00pm] Auto NAV-PVT & NAV-HPPOSLLH callbacks.
+ * @since  3.2.2  [2026-10-16-08:00pm] File buffer for the UBX session log.
+ * @since  3.2.2  [2026-10-17-12:30pm] Freeze from loop() (setPrefs) takes the LED back from taskLoopStatusLed().
  * @see    Global vars: GNSS, prefUtility(), startSerial(), beginI2C().
  * @link   https://github.com/sparkfun/SparkFun_u-blox_GNSS_v3/blob/main/examples/Example1_PositionVelocityTime/Example1_PositionVelocityTime.ino.
  * @link   https://github.com/sparkfun/SparkFun_u-blox_GNSS_v3/blob/main/src/u-blox_config_keys.h.
@@ -1459,8 +2545,14 @@ void startWebSocketServer() {
 void startAndConfigGNSS() {
 
     // --- Start GNSS interface on I2C-1. ---
+    roverGNSS.setFileBufferSize(LOG_UBX_BUFFER_SIZE);              // UBX session log. Must be set before begin().
+    logUbxOn = false;                                               // Reset clears RXM-RAWX & RXM-SFRBX. @see checkZedTriggerUpdate().
     if (roverGNSS.begin() == false) {
         Serial.println("Start roverGNSS failed. Freezing ...");     // Something is wrong, freeze.
+        if (inLoop) {                                               // From setPrefs: take the LED back from taskLoopStatusLed().
+            inLoop = false;
+            delay(50);                                              // > one taskLoopStatusLed() pass.
+        }
         ws2812LedColor = RED;
         ws2812LedBlink = false;
         statusLedOn();
@@ -1510,6 +2602,10 @@ void startAndConfigGNSS() {
     // --- Send the config. ---
     roverGNSS.sendCfgValset() ? Serial.println("roverGNSS configured using valset keys.") : Serial.println("roverGNSS config failed!");
 
+    // --- Operate page snapshot: auto NAV-PVT & NAV-HPPOSLLH, handled by roverGNSS.checkCallbacks(). ---
+    roverGNSS.setAutoPVTcallbackPtr(&onNavPvt, VAL_LAYER_RAM);              // Fix type, carrier solution, # satellites.
+    roverGNSS.setAutoHPPOSLLHcallbackPtr(&onNavHpposllh, VAL_LAYER_RAM);    // High precision position, heights & accuracy.
+
     // --- Not used. ---
     // roverGNSS.newCfgValset(VAL_LAYER_RAM_BBR);
     // roverGNSS.addCfgValset(UBLOX_CFG_MSGOUT_UBX_NAV_PVT_I2C, 1); // Output solutions periodically on I2C.
@@ -1527,19 +2623,72 @@ void startAndConfigGNSS() {
  * -------------------------------------------------------------------------
  *
  * @return void No output is returned.
+ * Incoming WebSocket messages are passed by handle (uint8_t index into wsRxPool[]), not copied by value:
+ *   wsRxFreeQueue (all handles at start) -> onWebSocketEvent() fills buffer -> wsRxQueue -> processJsonActivity() -> wsRxFreeQueue.
+ *
+ * @return void No output is returned.
  * @since  3.2.2 [2026-07-29] New. Threadsafe queues shared by FreeRTOS tasks and loop() functions.
+ * @since  3.2.2 [2026-10-16-02:00pm] wsRxPool[] & wsRxFreeQueue. Queue handles, not 2 KB structs.
+ * @since  3.2.2 [2026-10-16-06:00pm] ntripRtcmBuffer.
+ * @since  3.2.2 [2026-10-16-08:00pm] Session log rings (PSRAM) & blocks (DMA capable).
+ * @since  3.2.2 [2026-10-17-11:00am] Free the session log rings & blocks if one allocation fails.
  * @see    setup(), onWebSocketEvent(), processJsonActivity().
  */
 void startQueues() {
-    wsRxQueue = xQueueCreate(WS_RX_QUEUE_LEN, sizeof(WsQueueItem));
-    if (wsRxQueue == NULL) {
+    wsRxQueue     = xQueueCreate(WS_RX_QUEUE_LEN, sizeof(uint8_t));
+    wsRxFreeQueue = xQueueCreate(WS_RX_QUEUE_LEN, sizeof(uint8_t));
+    if ((wsRxQueue == NULL) || (wsRxFreeQueue == NULL)) {
         Serial.println("Failed to create wsRxQueue. Freezing.");
         ws2812LedColor = RED;
         ws2812LedBlink = false;
         statusLedOn();
         while (true);
     }
+
+    // --- Buffer pool. PSRAM if available, else internal RAM. ---
+    for (uint8_t handle = 0; handle < WS_RX_QUEUE_LEN; handle++) {
+        wsRxPool[handle].data = (char*)heap_caps_malloc(WS_RX_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+        if (wsRxPool[handle].data == NULL) {
+            wsRxPool[handle].data = (char*)malloc(WS_RX_BUFFER_SIZE);
+        }
+        if (wsRxPool[handle].data == NULL) {
+            Serial.println("Failed to allocate wsRxPool. Freezing.");
+            ws2812LedColor = RED;
+            ws2812LedBlink = false;
+            statusLedOn();
+            while (true);
+        }
+        wsRxPool[handle].len = 0;
+        xQueueSend(wsRxFreeQueue, &handle, 0);
+    }
     Serial.println("GhostRover FreeRTOS queue \"wsRxQueue\" created.");
+
+    // --- NTRIP RTCM message buffer. ---
+    ntripRtcmBuffer = xMessageBufferCreate(NTRIP_BUFFER_SIZE);
+    if (ntripRtcmBuffer == NULL) {
+        Serial.println("GhostRover FreeRTOS message buffer \"ntripRtcmBuffer\" failed.");
+        return;
+    }
+    Serial.println("GhostRover FreeRTOS message buffer \"ntripRtcmBuffer\" created.");
+
+    // --- Session log rings & blocks. Rings PSRAM only (224 KB), no session log without it. ---
+    for (uint8_t stream = 0; stream < LOG_NUM_STREAMS; stream++) {
+        uint8_t* ring = (uint8_t*)heap_caps_malloc(LOG_RING_SIZE[stream], MALLOC_CAP_SPIRAM);
+        logStream[stream].block = (uint8_t*)heap_caps_malloc(LOG_BLOCK_SIZE, MALLOC_CAP_DMA);
+        if ((ring == NULL) || (logStream[stream].block == NULL)) {
+            Serial.println("Session log rings failed (no PSRAM?). Session log disabled.");
+            free(ring);                                                     // Free this stream & the ones before it.
+            for (uint8_t i = 0; i <= stream; i++) {
+                free(logStream[i].ring.buf);
+                free(logStream[i].block);
+                logRingInit(&logStream[i].ring, NULL, 1);                   // No storage = logging off.
+                logStream[i].block = NULL;
+            }
+            return;
+        }
+        logRingInit(&logStream[stream].ring, ring, LOG_RING_SIZE[stream]);
+    }
+    Serial.println("Session log rings created.");
 }
 
 /**
@@ -1551,6 +2700,10 @@ void startQueues() {
  * @since  3.0.7  [2025-11-14-04:30pm].
  * @since  3.0.11 [2026-01-08-10:30am] Remove taskSendGnss() & taskSendBatteryStatus().
  * @since  3.1.2  [2026-07-03-07:30pm] xTaskCreatePinnedToCore from 4096 to 8192.
+ * @since  3.2.2  [2026-10-16-09:00am] Serial1.onReceive() wakes taskRtcmRelay().
+ * @since  3.2.2  [2026-10-16-06:00pm] Add taskNtripClient().
+ * @since  3.2.2  [2026-10-16-08:00pm] Add taskSessionLogger().
+ * @since  3.2.2  [2026-10-16-11:00pm] Serial1.onReceive() stamps rtcmRxEventUs (metrics).
  * @see    Global vars: FreeRTOS handles.
  * @see    setup().
  * @link   https://www.freertos.org/Documentation/02-Kernel/04-API-references/01-Task-creation/01-xTaskCreate.
@@ -1566,7 +2719,26 @@ void startTasks() {
     // Arduino-ESP32 core 1 defaults: Arduino loop(), WiFi/I2C.
     // Pin taskRtcmRelay() to core 0 for parallel execution instead of round-robin in loop() since I2C calls block and don't yield.
     xTaskCreatePinnedToCore(taskRtcmRelay, "RTCM_Relay", 8192, NULL, 2, &taskRtcmRelayHandle, 0);
+    Serial1.onReceive([]() {                                        // Wake taskRtcmRelay() on UART RX (FIFO full or RX timeout) instead of polling.
+        if (rtcmRxEventUs == 0) {
+            rtcmRxEventUs = (uint32_t)esp_timer_get_time() | 1;     // Oldest RX not yet relayed (metrics).
+        }
+        xTaskNotifyGive(taskRtcmRelayHandle);
+    });
     Serial.println("GhostRover FreeRTOS task \"RTCM relay\" started.");
+
+    // --- NTRIP client. ---
+    // Core 0 with WiFi, below taskRtcmRelay() priority. Socket calls block this task only, never loop() or the relay.
+    xTaskCreatePinnedToCore(taskNtripClient, "NTRIP_Client", 6144, NULL, 1, &taskNtripClientHandle, 0);
+    Serial.println("GhostRover FreeRTOS task \"NTRIP client\" started.");
+
+    // --- Session log. ---
+    // Core 0, lowest priority. SD writes block this task only; producers keep filling the rings meanwhile.
+    if (logStream[LOG_NUM_STREAMS - 1].ring.buf == NULL) {           // startQueues() stops at the first failed stream.
+        return;
+    }
+    xTaskCreatePinnedToCore(taskSessionLogger, "Session_Logger", 6144, NULL, 1, &taskSessionLoggerHandle, 0);
+    Serial.println("GhostRover FreeRTOS task \"Session logger\" started.");
 }
 
 /**
@@ -1592,10 +2764,13 @@ void preLoop() {
  * =========================================================================
  *
  * @since 3.0.11 [2026-01-08-10:30am] Browser initiated updates.
+ * @since 3.2.2  [2026-10-16-06:00pm] Add taskNtripClient().
+ * @since 3.2.2  [2026-10-16-08:00pm] Add taskSessionLogger().
  * @see   startTasks()          - Start GhostRover FreeRTOS tasks in setup().
  * @see   taskLoopStatusLed()   - GhostRover FreeRTOS task - Set Loop() status LED to blink or solid.
- * @see   rtcm3GetMessageType() - Return RTCM3 message type to taskRtcmRelay().
- * @see   taskRtcmRelay()       - GhostRover FreeRTOS task - Relay RTCM from Serial1 (HC-12) to -> Serial2 (ZED UART2).
+ * @see   taskRtcmRelay()       - GhostRover FreeRTOS task - Relay RTCM from Serial1 (HC-12) or NTRIP to -> Serial2 (ZED UART2).
+ * @see   taskNtripClient()     - GhostRover FreeRTOS task - NTRIP client, caster -> taskRtcmRelay().
+ * @see   taskSessionLogger()   - GhostRover FreeRTOS task - Session log, RTCM/NMEA/UBX rings -> SD files.
  */
 
 /**
@@ -1608,12 +2783,20 @@ void preLoop() {
  *   GPIO  2 - WS2812 LED.
  *   GPIO 23 - RGB BUILTIN LED.
  *
+ * Until preLoop() sets inLoop, shows what setup() set. Then the only writer of ws2812LedColor & ws2812LedBlink:
+ * each pass derives them from status other tasks publish, so no two cores write the LED state.
+ *   RED   - i2cUp false (DevUBLOXGNSS::processNMEA(), loop()).
+ *   GREEN - a WebSocket client is connected (wsClientIds[], onWebSocketEvent()) or RTCMin (metricsRelay.rtcmIn).
+ *   BLUE  - otherwise.
+ *   Blink - metricsRelay.bytesIn grew since the last pass (taskRtcmRelay() relayed RTCM).
+ *
  * @param  void  * pvParameters Pointer to FreeRTOS task parameters.
  * @return void  No output is returned.
  * @since  3.0.3  [2025-11-09-10:30am] New.
  * @since  3.0.10 [2026-01-07-09:00am] Local vars.
  * @since  3.0.11 [2026-01-08-02:30pm] Remove debug.
  * @since  3.0.12 [2026-02-10-10:45pm] Status LED changes.
+ * @since  3.2.2  [2026-10-17-12:30pm] Sole LED writer after setup(): color & blink derived from i2cUp, wsClientIds[], metricsRelay.
  * @see    startTasks().
  * @link   https://www.freertos.org/Documentation/02-Kernel/04-API-references/02-Task-control/06-vTaskSuspend.
  */
@@ -1621,21 +2804,43 @@ void taskLoopStatusLed(void * pvParameters) {
 
     // --- Local vars. ---
     const TickType_t DELAY      = 40/portTICK_PERIOD_MS;            // Timer (ms) =  0.04 seconds.
+    bool             rtcmIn     = false;                            // metricsRelay.rtcmIn.
+    uint32_t         bytesIn    = 0;                                // metricsRelay.bytesIn, this pass.
+    uint32_t         lastBytes  = 0;                                // ... last pass.
+    bool             connected;                                     // A WebSocket client is connected.
+    bool             scratchIn;                                     // metricRead() work buffers.
+    uint32_t         scratchBytes;
 
     // --- Loop. ---
     while(true) {
+
+        // -- Derive color & blink (after setup()). A failed read keeps the last copy. --
+        if (inLoop) {
+            metricRead(&metricsRelayLock, &metricsRelay.rtcmIn,  &rtcmIn,  sizeof(rtcmIn),  &scratchIn);
+            metricRead(&metricsRelayLock, &metricsRelay.bytesIn, &bytesIn, sizeof(bytesIn), &scratchBytes);
+            connected = false;
+            portENTER_CRITICAL(&wsClientsMux);
+            for (uint8_t i = 0; i < WS_MAX_CLIENTS; i++) {
+                connected = connected || (wsClientIds[i] != 0);
+            }
+            portEXIT_CRITICAL(&wsClientsMux);
+            ws2812LedColor = (!i2cUp) ? RED : ((connected || rtcmIn) ? GREEN : BLUE);
+            ws2812LedBlink = (i2cUp) && (bytesIn != lastBytes);
+            lastBytes      = bytesIn;
+        }
+
+        // -- Show. --
         statusLedOn();
         vTaskDelay(DELAY);
         if (ws2812LedBlink == true) {
             rgbLedWrite(LED_BUILTIN, 0, 0, 0);                      // LED off.
-            ws2812LedBlink = false;
         }
     }
 }
 
 /**
  * -------------------------------------------------------------------------
- *  GhostRover FreeRTOS task - Relay RTCM from Serial1 (HC-12) to -> Serial2 (ZED UART2).
+ *  GhostRover FreeRTOS task - Relay RTCM from Serial1 (HC-12) or NTRIP to -> Serial2 (ZED UART2).
  * -------------------------------------------------------------------------
  *
  * RTCM preamble = '11010011 000000xx' = 0xd3 0x00.
@@ -1649,13 +2854,47 @@ void taskLoopStatusLed(void * pvParameters) {
  * on every wake so any backlog from a stall clears immediately instead of
  * trickling out one byte per loop() pass.
  *
+ * Sleeps until the Serial1 onReceive() callback (registered in startTasks()) notifies it,
+ * or RTCM_IDLE_WAIT passes so RTCMin can still time out. Bytes move in bulk (Serial1.read(buffer)
+ * -> Serial2.write(buffer)) and are framed by rtcm3Framer.h using the 10 bit length & CRC-24Q,
+ * so a 0xD3 inside a payload is no longer counted as a new sentence.
+ *
+ *  -- Source (prfRtcIn). --
+ *     radio: Serial1 (HC-12).
+ *     ntrip: ntripRtcmBuffer, filled by taskNtripClient(), which also wakes this task. Radio bytes are
+ *            drained & dropped so a switch back to radio starts fresh. The framer, Serial2, RTCMin &
+ *            rtcmKbps stay owned by this task for both sources.
+ *
+ *  -- Forwarding. --
+ *     rtcmCrcOnly disabled (default): bytes are written to the ZED as soon as they're read, framing is only for stats.
+ *     rtcmCrcOnly enabled:            only CRC-valid frames are written to the ZED, each one when its last byte arrives.
+ *                                     After corruption a false 0xD3 can carry a length of up to 1023, which would hold
+ *                                     every frame behind it until 1029 bytes arrive (~1 s at 9600 baud). The framer
+ *                                     drops such a candidate as soon as a complete CRC-valid frame is found behind it
+ *                                     (rtcm3FramerLookahead()), so the extra hold is bounded by the next good frame.
+ *     Each chunk (Serial1 read or NtripChunk) is framed before the next one is read. A drain pass can be longer than
+ *     the framer ring (RTCM3_RING_SIZE, ntripRtcmBuffer holds NTRIP_BUFFER_SIZE), but the ring only ever holds one
+ *     chunk plus an incomplete frame, so nothing is lost to bytesOverflow.
+ *
+ *  -- Metrics (metrics.h). --
+ *     One sample per pass: oldest Serial1 RX event (rtcmRxEventUs) or chunk queue time (NTRIP) -> last ZED write.
+ *     RTCMin, rtcmKbps, frame counts & ntripLatencyMs are published together in metricsRelay (seqlock) each pass.
+ *
  * @param  void * pvParameters Pointer to FreeRTOS task parameters.
  * @return void   No output is returned (infinite loop).
  * @since  3.1.2  [2026-07-03-06:15pm] New, replaced relaySerial1toSerial2() in loop().
  * @since  3.1.2  Added if (byteCount < sizeof(rtcmSentence) - 1) to check for rtcmSentence overflow.
  * @since  3.2.1  [2026-07-29-09:30am] Added guard to prevent rtcmKbps form calculating as null.
- * @see    startTasks().
- * @see    rtcm3GetMessageType().
+ * @since  3.2.2  [2026-10-16-09:00am] rtcm3Framer.h framing, bulk transfer, wake on UART RX, RTCM_CRC_ONLY.
+ *                RTCM_TIMEOUT was uint16_t (truncated 3 sec to ~51 ms).
+ * @since  3.2.2  [2026-10-16-06:00pm] NTRIP source (ntripRtcmBuffer), ntripLatencyMs.
+ * @since  3.2.2  [2026-10-16-08:00pm] Relayed bytes -> session log (logStream[LOG_RTCM]).
+ * @since  3.2.2  [2026-10-16-11:00pm] Metrics: RX -> ZED latency histogram, status snapshot (metricsRelay).
+ * @since  3.2.2  [2026-10-17-09:00am] Framer counters & type stats published in metricsRelay. CRC-only hold doc.
+ * @since  3.2.2  [2026-10-17-12:30pm] No LED writes: taskLoopStatusLed() reads RTCMin & bytesIn from metricsRelay.
+ * @since  3.2.2  [2026-10-17-02:00pm] Frame after every chunk: a backlog > RTCM3_RING_SIZE overflowed the framer ring.
+ * @see    startTasks(), taskNtripClient(), taskSessionLogger().
+ * @see    rtcm3Framer.h.
  * @see    Global vars: Serial, startSerialInterfaces(), loop().
  * @link   https://github.com/sparkfun/SparkFun_u-blox_GNSS_v3/blob/main/examples/ZED-F9P/Example3_StartRTCMBase/Example3_StartRTCMBase.ino.
  * @link   https://www.use-snip.com/kb/knowledge-base/an-rtcm-message-cheat-sheet/.
@@ -1664,12 +2903,27 @@ void taskLoopStatusLed(void * pvParameters) {
  */
 void taskRtcmRelay(void *pvParameters) {
 
-// --- Local vars. ---
-    const  uint16_t RTCM_TIMEOUT      = 3000000;                        // Time (us) not to exceed for RTCM input received (3 sec).
-           uint16_t byteCount         =       0;
-           int64_t  lastRTCMtime      =       0;                        // Last time (us) when RTCM input received.
-           char     rtcmSentence[1030] =  {'\0'};                        // RTCM3 sentence buffer.
-           uint16_t msg_type          =       0;
+    // --- Local vars. ---
+    const  int64_t    RTCM_TIMEOUT     = 3000000;                       // Time (us) not to exceed for RTCM input received (3 sec).
+    const  int64_t    KBPS_WINDOW      = 1000000;                       // Time (us) to average rtcmKbps over (1 sec).
+    const  TickType_t RTCM_IDLE_WAIT   = pdMS_TO_TICKS(100);            // Max time to sleep without a UART RX event.
+    static uint8_t    rxChunk[256];                                     // Bulk read buffer (Serial1 -> Serial2).
+    static uint8_t    rtcmFrame[RTCM3_MAX_FRAME];                       // One CRC-valid RTCM3 frame.
+    static NtripChunk ntripRx;                                          // One ntripRtcmBuffer message.
+           uint8_t*   data             = rxChunk;                       // Bytes to relay (rxChunk or ntripRx.data).
+           bool       fromNtrip        = false;
+           uint16_t   frameLen         = 0;
+           uint16_t   msgType          = 0;
+           size_t     numBytes         = 0;
+           size_t     windowBytes      = 0;                             // Bytes in during this KBPS_WINDOW.
+           int64_t    windowStart      = esp_timer_get_time();
+           int64_t    lastRTCMtime     = 0;                             // Last time (us) when RTCM input received.
+           int64_t    windowLatency    = 0;                             // Max NTRIP latency (us) during this KBPS_WINDOW.
+           uint32_t   passStart        = 0;                             // Oldest RX/queue time this pass (us, low 32 bits), 0 = none.
+           int64_t    now              = 0;
+
+    // --- Init. ---
+    rtcm3FramerReset(&rtcmFramer);
 
     // --- Loop. ---
     for (;;) {
@@ -1680,50 +2934,470 @@ void taskRtcmRelay(void *pvParameters) {
             continue;
         }
 
+        // -- Sleep until Serial1 or ntripRtcmBuffer has data (or RTCM_IDLE_WAIT). --
+        ulTaskNotifyTake(pdTRUE, RTCM_IDLE_WAIT);
+        fromNtrip = (strcmp(prfRtcIn, "ntrip") == 0);
+
         // -- Check for radio down. Set RTCMin state. --
-        if ((esp_timer_get_time() - lastRTCMtime) > RTCM_TIMEOUT) {
+        now = esp_timer_get_time();
+        if ((now - lastRTCMtime) > RTCM_TIMEOUT) {
             RTCMin = false;
-            ws2812LedColor = GREEN;
-            ws2812LedBlink = false;
         }
 
-        // -- Drain Serial1 (HC-12) fully, write each byte to Serial2 (ZED UART2). --
-        while (Serial1.available() > 0) {                               // Loop until caught up, not just once.
-            char inputChar = Serial1.read();                            // Read a character from Serial1 (HC-12) @ SERIAL1_SPEED.
-            Serial2.write(inputChar);                                   // Write a character to Serial2 (ZED UART2) @ SERIAL2_SPEED.
-            if (byteCount < sizeof(rtcmSentence) - 1) {                 // Bounds check - prevent stack buffer overflow (relay above is unaffected either way).
-                rtcmSentence[byteCount] = inputChar;                    // RTCM3 sentence buffer used to parse message type.
-            }
-            RTCMin = true;
-            ws2812LedColor = GREEN;
-            ws2812LedBlink = true;
-
-            // - Stats. -
-            if (inputChar == 0xd3) {                                    // Start of new sentence.
-                rtcmSentenceCount++;
-                msg_type = rtcm3GetMessageType(rtcmSentence);           // Parse message type.
-                int64_t RTCMintervalUs = esp_timer_get_time() - lastRTCMtime;
-                int64_t RTCMinterval = RTCMintervalUs / 1000;           // Ms for display only.
-                if (RTCMintervalUs > 0) {
-                    rtcmKbps = ((float)byteCount * 8.0f * 1000.0f) / (float)RTCMintervalUs;     // kbps = bits / ms.
-                } else {
-                        // Interval too short to measure meaningfully — hold last known value rather than emit garbage/null.
-                }
-                if (commandFlag[DEBUG_RTCM]) {          // Debug.
-                    Serial.printf("\nRTCM3 #%zu Type:%u bytes:%u ms:%lld kbps:%.2f\n\nd3 ", rtcmSentenceCount, msg_type, byteCount, RTCMinterval, rtcmKbps);
+        // -- NTRIP source: drop radio bytes. --
+        while (fromNtrip && ((numBytes = Serial1.available()) > 0)) {
+            Serial1.read(rxChunk, (numBytes > sizeof(rxChunk)) ? sizeof(rxChunk) : numBytes);
+        }
+
+        // -- Drain source, Serial1 (HC-12) or ntripRtcmBuffer, fully, in bulk. --
+        for (;;) {                                                      // Loop until caught up, not just once.
+            if (fromNtrip) {
+                numBytes = xMessageBufferReceive(ntripRtcmBuffer, &ntripRx, sizeof(ntripRx), 0);
+                if (numBytes <= sizeof(ntripRx.rxTime)) {
+                    break;
                 }
-                lastRTCMtime = esp_timer_get_time();                    // Used to check for timeout.
-                memset(rtcmSentence, '\0', sizeof(rtcmSentence));       // Clear the sentence buffer.
-                rtcmSentence[0] = 0xd3;
-                byteCount = 1;
+                numBytes -= sizeof(ntripRx.rxTime);
+                data      = ntripRx.data;
             } else {
+                numBytes = Serial1.available();
+                if (numBytes == 0) {
+                    break;
+                }
+                if (numBytes > sizeof(rxChunk)) {
+                    numBytes = sizeof(rxChunk);
+                }
+                numBytes = Serial1.read(rxChunk, numBytes);             // Read a chunk from Serial1 (HC-12) @ SERIAL1_SPEED.
+                data     = rxChunk;
+            }
+            if (passStart == 0) {
+                passStart = fromNtrip ? ((uint32_t)ntripRx.rxTime | 1) : rtcmRxEventUs;
+            }
+            if (!fromNtrip) {
+                rtcmRxEventUs = 0;                                      // Taken. Next RX event starts the next sample.
+            }
+            if (!commandFlag[RTCM_CRC_ONLY]) {
+                Serial2.write(data, numBytes);                          // Pass through: write the chunk to Serial2 (ZED UART2) @ SERIAL2_SPEED.
+            }
+            if (fromNtrip && ((esp_timer_get_time() - ntripRx.rxTime) > windowLatency)) {
+                windowLatency = esp_timer_get_time() - ntripRx.rxTime;  // Caster socket -> ZED UART2.
+            }
+            logGatePush(&logSession, &logStream[LOG_RTCM].ring, data, numBytes);   // Session log. Never blocks, drops if full.
+            windowBytes   += numBytes;
+            lastRTCMtime   = esp_timer_get_time();                      // Used to check for timeout.
+            RTCMin         = true;
+
+            // Frame this chunk before the next is read: a backlog (e.g. ntripRtcmBuffer) can be larger than the framer ring.
+            rtcm3FramerPush(&rtcmFramer, data, numBytes);               // Frame for stats (& CRC-only forwarding).
+            while (rtcm3FramerNext(&rtcmFramer, rtcmFrame, &frameLen)) {
+                if (commandFlag[RTCM_CRC_ONLY]) {
+                    Serial2.write(rtcmFrame, frameLen);                 // Only CRC-valid frames to Serial2 (ZED UART2).
+                }
+                msgType = rtcm3MessageType(rtcmFrame);
+                Rtcm3TypeStats* typeStats = rtcm3TypeStatsRecord(&rtcmFramer, msgType, frameLen, esp_timer_get_time());
+                rtcmSentenceCount = rtcmFramer.framesOk;
                 if (commandFlag[DEBUG_RTCM]) {                          // Debug.
-                    Serial.printf("%02x ", inputChar);
+                    Serial.printf("RTCM3 #%zu Type:%u bytes:%u ms:%lu kbps:%.2f crcBad:%lu\n", rtcmSentenceCount, msgType, frameLen,
+                        (typeStats != NULL) ? (unsigned long)typeStats->intervalMs : 0UL, rtcmKbps, (unsigned long)rtcmFramer.framesCrcBad);
+                }
+            }
+        }
+
+        // -- Rate. --
+        now = esp_timer_get_time();
+        if ((now - windowStart) >= KBPS_WINDOW) {
+            rtcmKbps    = ((float)windowBytes * 8.0f * 1000.0f) / (float)(now - windowStart);     // kbps = bits / ms.
+            windowBytes = 0;
+            windowStart = now;
+            ntripLatencyMs = fromNtrip ? (windowLatency / 1000.0f) : 0;
+            windowLatency  = 0;
+        }
+
+        // -- Metrics: publish status & this pass's latency together. --
+        metricWriteBegin(&metricsRelayLock);
+        if (passStart != 0) {
+            metricHistRecord(&metricsRelay.rxToZed, (uint32_t)((uint32_t)esp_timer_get_time() - passStart));
+            passStart = 0;
+        }
+        metricsRelay.rtcmIn         = RTCMin;
+        metricsRelay.kbps           = rtcmKbps;
+        metricsRelay.frames         = rtcmFramer.framesOk;
+        metricsRelay.crcBad         = rtcmFramer.framesCrcBad;
+        metricsRelay.falseStarts    = rtcmFramer.framesFalseStart;
+        metricsRelay.bytesIn        = rtcmFramer.bytesIn;
+        metricsRelay.bytesDiscarded = rtcmFramer.bytesDiscarded;
+        metricsRelay.bytesOverflow  = rtcmFramer.bytesOverflow;
+        metricsRelay.numTypes       = rtcmFramer.numTypes;
+        memcpy(metricsRelay.types, rtcmFramer.types, rtcmFramer.numTypes * sizeof(Rtcm3TypeStats));
+        metricsRelay.ntripLatencyMs = ntripLatencyMs;
+        metricWriteEnd(&metricsRelayLock);
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  GhostRover FreeRTOS task - NTRIP client, caster -> taskRtcmRelay().
+ * -------------------------------------------------------------------------
+ *
+ * Runs only while prfRtcIn is "ntrip" & the hotspot link from startWiFi() is up. Connect, read & write
+ * block this task only; loop() & taskRtcmRelay() never wait on the caster.
+ *
+ *  -- Session. --
+ *     Load the active caster profile (ntripLoadCaster()), connect, send the v1/v2 request (ntripBuildRequest()).
+ *     ntripReceive() strips the response header & v2 chunked encoding. RTCM bytes go to ntripRtcmBuffer with
+ *     their receive time (NtripChunk) & taskRtcmRelay() is woken, so framing, Serial2, RTCMin & rtcmKbps
+ *     are the same for radio & NTRIP.
+ *     If the profile has sendGga set, the latest GGA (saved by DevUBLOXGNSS::processNMEA()) is uploaded
+ *     every ggaInterval seconds.
+ *
+ *  -- Reconnect. --
+ *     Refused, closed, no answer within RESPONSE_TIMEOUT, or no RTCM within STREAM_TIMEOUT: drop & retry
+ *     after ntripBackoffMs() (1 s doubling to 60 s). Reset once RTCM flows again. ntripRestart (preferences
+ *     changed) drops the connection & reloads the profile right away. ntripRtcmBuffer is reset on every new
+ *     connection & when the source changes, so stale chunks from the old session never reach the ZED.
+ *     The backoff & idle waits are NTRIP_IDLE_WAIT slices on the task notification: the preference writers
+ *     (processJsonActivity()) notify after setting ntripRestart or prfRtcIn, & the restart, source & hotspot
+ *     link checks run between slices, so a change never waits out a 60 s backoff.
+ *
+ *  -- Status (operate page). --
+ *     ntripLatencyMs (set by taskRtcmRelay()), ntripBytesPerSec, ntripReconnects (streaming resumed after a lost
+ *     connection, not attempts).
+ *
+ * @param  void * pvParameters Pointer to FreeRTOS task parameters.
+ * @return void   No output is returned (infinite loop).
+ * @since  3.2.2  [2026-10-16-06:00pm] New.
+ * @since  3.2.2  [2026-10-17-10:30am] Reset ntripRtcmBuffer on connect & source change, count successful reconnects only.
+ * @since  3.2.2  [2026-10-17-03:00pm] Back off in notify slices, recheck ntripRestart, prfRtcIn & the hotspot link between them.
+ * @see    startTasks(), taskRtcmRelay(), ntripLoadCaster().
+ * @see    ntripClient.h.
+ * @link   https://docs.espressif.com/projects/arduino-esp32/en/latest/api/wifi.html.
+ */
+void taskNtripClient(void *pvParameters) {
+
+    // --- Local vars. ---
+    const  TickType_t   NTRIP_IDLE_WAIT  = pdMS_TO_TICKS(500);            // Sleep slice while NTRIP is off, the hotspot link is down or backing off.
+    const  TickType_t   NTRIP_RX_WAIT    = pdMS_TO_TICKS(10);             // Sleep when no bytes are waiting.
+    const  int32_t      CONNECT_TIMEOUT  = 5000;                          // TCP connect timeout (ms).
+    const  int64_t      RESPONSE_TIMEOUT = 10000000;                      // Caster must answer within this (us).
+    const  int64_t      STREAM_TIMEOUT   = 15000000;                      // No RTCM for this long (us): reconnect.
+    const  int64_t      GGA_MAX_AGE      = 5000000;                       // Don't upload a GGA older than this (us).
+    const  int64_t      RATE_WINDOW      = 1000000;                       // Time (us) to average ntripBytesPerSec over (1 sec).
+    static char         request[NTRIP_REQUEST_MAX];
+    static char         gga[NMEA_MAX_LEN];
+    static NtripChunk   chunk;                                            // Receive buffer, sent as is to ntripRtcmBuffer.
+    static NtripSession session;
+    ntripCasterProfile  caster         = {};
+    WiFiClient          client;
+    bool                connected      = false;                           // TCP up & request sent.
+    bool                everStreamed   = false;                           // RTCM has flowed since NTRIP was turned on (ntripReconnects).
+    uint32_t            failures       = 0;                               // Consecutive failed attempts (backoff).
+    size_t              numBytes       = 0;
+    size_t              requestLen     = 0;
+    size_t              ggaLen         = 0;
+    size_t              windowBytes    = 0;
+    int64_t             windowStart    = esp_timer_get_time();
+    int64_t             connectTime    = 0;
+    int64_t             lastRx         = 0;
+    int64_t             lastGga        = 0;
+    int64_t             retryTime      = 0;                               // End of the current backoff (us), 0 = not backing off.
+    int64_t             now            = 0;
+    TickType_t          wait           = 0;
+
+    // --- Loop. ---
+    for (;;) {
+
+        // -- Check preference, restart & hotspot link. --
+        if (ntripRestart || (strcmp(prfRtcIn, "ntrip") != 0) || (WiFi.status() != WL_CONNECTED)) {
+            if (connected) {
+                client.stop();
+                connected = false;
+                Serial.println("NTRIP disconnected.");
+                xMessageBufferReset(ntripRtcmBuffer);                    // Source changed: drop chunks from the old caster.
+            }
+            ntripUp          = false;
+            ntripGgaWanted   = false;
+            ntripBytesPerSec = 0;
+            if (ntripRestart || (strcmp(prfRtcIn, "ntrip") != 0)) {
+                everStreamed = false;                                   // New profile or source, not a reconnect.
+                failures     = 0;
+                retryTime    = 0;
+            }
+            if (ntripRestart) {
+                ntripRestart = false;
+            } else {
+                ulTaskNotifyTake(pdTRUE, NTRIP_IDLE_WAIT);              // Woken early by a preference writer.
+            }
+            continue;
+        }
+
+        // -- Connect. --
+        if (!connected) {
+            if (failures > 0) {
+                now = esp_timer_get_time();
+                if (retryTime == 0) {
+                    retryTime = now + (int64_t)ntripBackoffMs(failures - 1) * 1000;
+                }
+                if (now < retryTime) {                                  // Back off one slice, then recheck restart, source & link above.
+                    wait = pdMS_TO_TICKS((retryTime - now) / 1000) + 1;
+                    ulTaskNotifyTake(pdTRUE, (wait < NTRIP_IDLE_WAIT) ? wait : NTRIP_IDLE_WAIT);
+                    continue;
+                }
+                retryTime = 0;
+            }
+            if (!ntripLoadCaster(&caster)) {
+                Serial.printf("NTRIP caster profile %s incomplete (URL, mount point).\n", prfNtripCastAct);
+                failures++;
+                continue;
+            }
+            requestLen = ntripBuildRequest(request, sizeof(request), caster.url, caster.port, caster.mount,
+                                           caster.user, caster.pass, caster.version);
+            if ((requestLen == 0) || (!client.connect(caster.url, caster.port, CONNECT_TIMEOUT))) {
+                Serial.printf("NTRIP connect to %s:%u failed, retry in %lu ms.\n", caster.url, caster.port, (unsigned long)ntripBackoffMs(failures));
+                failures++;
+                continue;
+            }
+            client.setNoDelay(true);
+            xMessageBufferReset(ntripRtcmBuffer);                       // Drop chunks left from the last session (taskRtcmRelay() never blocks on it).
+            client.write((const uint8_t*)request, requestLen);
+            if (commandFlag[DEBUG_NTRIP]) {                             // Debug.
+                Serial.printf("NTRIP --> %s", request);
+            }
+            ntripSessionReset(&session);
+            connected   = true;
+            connectTime = esp_timer_get_time();
+            lastRx      = connectTime;
+            lastGga     = 0;
+        }
+
+        // -- Receive. --
+        now      = esp_timer_get_time();
+        numBytes = client.available();
+        if (numBytes > 0) {
+            numBytes = client.read(chunk.data, (numBytes > sizeof(chunk.data)) ? sizeof(chunk.data) : numBytes);
+            numBytes = ntripReceive(&session, chunk.data, numBytes);    // Header & chunked encoding removed, in place.
+            if (session.state == NTRIP_STATE_FAILED) {
+                Serial.printf("NTRIP caster %s:%u/%s refused: %.*s\n", caster.url, caster.port, caster.mount,
+                    (int)strcspn(session.header, "\r\n"), session.header);
+                client.stop();
+                connected = false;
+                ntripUp   = false;
+                failures++;
+                continue;
+            }
+            if ((session.state == NTRIP_STATE_STREAMING) && (!ntripUp)) {
+                if (everStreamed) {
+                    ntripReconnects++;                                  // Successful reconnects only, not attempts.
+                }
+                everStreamed   = true;
+                ntripUp        = true;
+                ntripGgaWanted = caster.sendGga;
+                Serial.printf("NTRIP connected to %s:%u/%s (v%u).\n", caster.url, caster.port, caster.mount, caster.version);
+            }
+            if (numBytes > 0) {
+                chunk.rxTime = now;
+                if (xMessageBufferSend(ntripRtcmBuffer, &chunk, sizeof(chunk.rxTime) + numBytes, 0) == 0) {
+                    ntripBytesDropped += numBytes;                      // taskRtcmRelay() fell behind.
+                }
+                xTaskNotifyGive(taskRtcmRelayHandle);
+                windowBytes += numBytes;
+                lastRx       = now;
+                failures     = 0;
+            }
+        } else if ((!client.connected()) ||
+                   ((!ntripUp) && ((now - connectTime) > RESPONSE_TIMEOUT)) ||
+                   (ntripUp && ((now - lastRx) > STREAM_TIMEOUT))) {
+            Serial.printf("NTRIP caster %s:%u %s, reconnecting.\n", caster.url, caster.port, client.connected() ? "timed out" : "closed");
+            client.stop();
+            connected      = false;
+            ntripUp        = false;
+            ntripGgaWanted = false;
+            failures++;
+            continue;
+        } else {
+            vTaskDelay(NTRIP_RX_WAIT);
+        }
+
+        // -- Upload GGA. --
+        if (ntripUp && caster.sendGga && ((now - lastGga) >= (int64_t)caster.ggaInterval * 1000000)) {
+            ggaLen = 0;
+            portENTER_CRITICAL(&ntripGgaMux);
+            if ((ntripGga[0] != '\0') && ((now - ntripGgaTime) < GGA_MAX_AGE)) {
+                ggaLen = strlcpy(gga, ntripGga, sizeof(gga));
+            }
+            portEXIT_CRITICAL(&ntripGgaMux);
+            if (ggaLen > 0) {
+                client.write((const uint8_t*)gga, ggaLen);
+                lastGga = now;
+                if (commandFlag[DEBUG_NTRIP]) {                         // Debug.
+                    Serial.printf("NTRIP --> %s", gga);
+                }
+            }
+        }
+
+        // -- Rate. --
+        if ((now - windowStart) >= RATE_WINDOW) {
+            ntripBytesPerSec = (uint32_t)((windowBytes * 1000000ULL) / (uint64_t)(now - windowStart));
+            windowBytes      = 0;
+            windowStart      = now;
+            if (commandFlag[DEBUG_NTRIP]) {                             // Debug.
+                Serial.printf("NTRIP %s bytes/s:%lu latency ms:%.1f reconnects:%lu dropped:%lu\n", ntripUp ? "up" : "down",
+                    (unsigned long)ntripBytesPerSec, ntripLatencyMs, (unsigned long)ntripReconnects, (unsigned long)ntripBytesDropped);
+            }
+        }
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  GhostRover FreeRTOS task - Session log, RTCM/NMEA/UBX rings -> SD files.
+ * -------------------------------------------------------------------------
+ *
+ * Started & stopped with the logSession command. Producers never touch the SD card: they copy into a PSRAM
+ * ring (logGatePush()) & move on. This task is the only SD writer, so a slow card (SD wear leveling & FAT
+ * updates can stall a write for 100s of ms) costs ring space, not RTCM relay or NMEA timing.
+ *
+ *  -- Streams (sessionLog.h). --
+ *     RTCM: taskRtcmRelay(), as relayed to the ZED (radio or NTRIP).
+ *     NMEA: DevUBLOXGNSS::processNMEA(), as received from the ZED (before nmeaRewrite(), so a replay sees the raw fix).
+ *     UBX:  checkZedTriggerUpdate(), RXM-RAWX & RXM-SFRBX from the roverGNSS file buffer (post processing).
+ *
+ *  -- Files (SD root, the files page & "/download" are flat). --
+ *     /logNNNN.rtcm, .nmea, .ubx  Raw streams. NNNN = first unused #.
+ *     /logNNNN.idx                LogIndexEntry every LOG_INDEX_INTERVAL: session ms, GPS TOW & stream offsets.
+ *
+ *  -- Writes. --
+ *     Every LOG_WAIT: full LOG_BLOCK_SIZE blocks only (sector aligned).
+ *     Every LOG_SYNC_INTERVAL: also the whole sectors of partial blocks, then flush (FAT & directory entries).
+ *     Close & rotate (LOG_ROTATE_TIME or LOG_ROTATE_BYTES): everything (logStreamFinish()), then a new set of files.
+ *     A short write (card busy or full) keeps the unwritten bytes for the next pass; at close they're retried,
+ *     then counted as lost.
+ *
+ *  -- Close handshake (LogGate). --
+ *     Producers push through logGatePush(). Close shuts the gate (logGateClose()) & waits until no producer is
+ *     mid-push (logGateIdle()) before the last write, so no push lands in a ring after its file is closed.
+ *
+ *  -- Stats (showLogStats). --
+ *     Per stream bytes in, bytes dropped (ring full), ring high water, file bytes, write errors & bytes lost; slowest write pass.
+ *
+ * @param  void * pvParameters Pointer to FreeRTOS task parameters.
+ * @return void   No output is returned (infinite loop).
+ * @since  3.2.2  [2026-10-16-08:00pm] New.
+ * @since  3.2.2  [2026-10-17-11:00am] Close waits for producers (LogGate) instead of LOG_WAIT, logStreamFinish().
+ * @see    startTasks(), startHttpServer(), debug().
+ * @see    sessionLog.h.
+ * @link   https://github.com/espressif/arduino-esp32/tree/master/libraries/SD.
+ */
+void taskSessionLogger(void *pvParameters) {
+
+    // --- Local vars. ---
+    const  TickType_t LOG_WAIT     = pdMS_TO_TICKS(100);                // Time between write passes.
+    const  LogSink    SD_SINK      = [](void* context, const uint8_t* data, size_t len) -> size_t {
+        return ((File*)context)->write(data, len);
+    };
+    static File       file[LOG_NUM_STREAMS];
+    static File       indexFile;
+    LogIndexEntry     mark         = {};
+    char              filename[32];
+    bool              rotate       = false;
+    bool              sync         = false;
+    uint32_t          passMs       = 0;
+    uint32_t          lost         = 0;                                 // Bytes the card never took at close/rotate.
+    int64_t           openTime     = 0;
+    int64_t           lastIndex    = 0;
+    int64_t           lastSync     = 0;
+    int64_t           now          = 0;
+
+    // --- Loop. ---
+    for (;;) {
+        vTaskDelay(LOG_WAIT);
+        now = esp_timer_get_time();
+
+        // -- Close (logSession off) or rotate. --
+        rotate = ((now - openTime) >= LOG_ROTATE_TIME);
+        for (uint8_t stream = 0; stream < LOG_NUM_STREAMS; stream++) {
+            rotate = rotate || (logStream[stream].fileBytes >= LOG_ROTATE_BYTES);
+        }
+        rotate = rotate && logSession.open && commandFlag[LOG_SESSION];
+        if (logSession.open && (rotate || (!commandFlag[LOG_SESSION]))) {
+            if (!rotate) {
+                logGateClose(&logSession);                              // New pushes refused.
+                while (!logGateIdle(&logSession)) {                     // Pushes in progress finish (a memcpy each).
+                    vTaskDelay(1);
+                }
+            }
+            for (uint8_t stream = 0; stream < LOG_NUM_STREAMS; stream++) {
+                lost = logStreamFinish(&logStream[stream], SD_SINK, &file[stream], !rotate);
+                if (lost > 0) {
+                    Serial.printf("Session log %04u.%s: %lu bytes not written.\n", logSessionNumber, LOG_EXTENSION[stream], (unsigned long)lost);
+                }
+                file[stream].close();
+            }
+            indexFile.close();
+            Serial.printf("Session log %04u closed%s.\n", logSessionNumber, rotate ? " (rotate)" : "");
+        }
+
+        // -- Open (logSession on) or rotate. --
+        if (commandFlag[LOG_SESSION] && (rotate || (!logSession.open))) {
+            for (logSessionNumber++; logSessionNumber < 10000; logSessionNumber++) {
+                snprintf(filename, sizeof(filename), "/log%04u.idx", logSessionNumber);
+                if (!SD.exists(filename)) {
+                    break;
                 }
-                byteCount++;
             }
+            indexFile = SD.open(filename, FILE_WRITE);
+            bool opened = indexFile;
+            for (uint8_t stream = 0; stream < LOG_NUM_STREAMS; stream++) {
+                snprintf(filename, sizeof(filename), "/log%04u.%s", logSessionNumber, LOG_EXTENSION[stream]);
+                file[stream] = SD.open(filename, FILE_WRITE);
+                opened = opened && file[stream];
+                logStream[stream].fileBytes = 0;
+            }
+            if (!opened) {
+                Serial.printf("Session log %04u open failed. logSession disabled.\n", logSessionNumber);
+                for (uint8_t stream = 0; stream < LOG_NUM_STREAMS; stream++) {
+                    file[stream].close();
+                }
+                indexFile.close();
+                commandFlag[LOG_SESSION] = false;
+                logGateClose(&logSession);
+                continue;
+            }
+            openTime       = now;
+            lastIndex      = now - LOG_INDEX_INTERVAL;                  // First index entry right away.
+            lastSync       = now;
+            logSession.open = true;
+            Serial.printf("Session log %04u opened.\n", logSessionNumber);
+        }
+        if (!logSession.open) {
+            continue;
+        }
+
+        // -- Index. Offsets include bytes still in the ring or block: produced before now. --
+        if ((now - lastIndex) >= LOG_INDEX_INTERVAL) {
+            mark.ms       = (uint32_t)((now - openTime) / 1000);
+            mark.gpsTowMs = gnssEpochTow;
+            for (uint8_t stream = 0; stream < LOG_NUM_STREAMS; stream++) {
+                mark.offset[stream] = logStreamOffset(&logStream[stream]);
+            }
+            indexFile.write((const uint8_t*)&mark, sizeof(mark));
+            lastIndex = now;
+        }
+
+        // -- Write. --
+        sync = ((now - lastSync) >= LOG_SYNC_INTERVAL);
+        for (uint8_t stream = 0; stream < LOG_NUM_STREAMS; stream++) {
+            logStreamWrite(&logStream[stream], SD_SINK, &file[stream], sync ? LOG_WRITE_SECTORS : LOG_WRITE_BLOCKS);
+        }
+        if (sync) {
+            for (uint8_t stream = 0; stream < LOG_NUM_STREAMS; stream++) {
+                file[stream].flush();
+            }
+            indexFile.flush();
+            lastSync = now;
+        }
+        passMs = (uint32_t)((esp_timer_get_time() - now) / 1000);
+        if (passMs > logWriteMaxMs) {
+            logWriteMaxMs = passMs;
         }
-        vTaskDelay(1);                                                  // Yield 1 tick when idle - keeps watchdog/other tasks fed.
     }
 }
 
@@ -1737,6 +3411,8 @@ void taskRtcmRelay(void *pvParameters) {
  * @see   onHttpFileUpload()          - <ESPAsyncWebServer.h> HTTP endpoint ("/upload") event handler (AsyncWebServerRequest).
  * @see   onWebSocketEvent()          - <ESPAsyncWebServer.h> WebSocket event handler (AsyncWebSocket).
  * @see   DevUBLOXGNSS::processNMEA() - <SparkFun_u-blox_GNSS_v3.h> DevUBLOXGNSS::processNMEA event handler (char incoming).
+ * @see   onNavPvt()                  - <SparkFun_u-blox_GNSS_v3.h> auto NAV-PVT callback (UBX_NAV_PVT_data_t).
+ * @see   onNavHpposllh()             - <SparkFun_u-blox_GNSS_v3.h> auto NAV-HPPOSLLH callback (UBX_NAV_HPPOSLLH_data_t).
  */
 
 /**
@@ -1776,10 +3452,15 @@ void onWiFiEvent(WiFiEvent_t event) {
  *
  * Upload a file to the SD card.
  *
+ * Asset cache: an uploaded asset ("name" or "name.gz") is dropped from the cache. A plain "name" also removes
+ * "/name.gz" (now stale, serveStatic() would prefer it). Uploading ASSET_MANIFEST (last, after the .gz files
+ * from tools/gzipAssets.py) reloads the cache.
+ *
  * @return void   No output is returned.
  * @since  3.0.7  [2025-11-11-06:00pm].
  * @since  3.0.10 [2026-01-07-12:00pm] Local vars.
- * @see    startHttpServer().
+ * @since  3.2.2  [2026-10-16-10:00pm] Asset cache invalidation.
+ * @see    startHttpServer(), assetCacheDrop(), assetCacheLoad().
  * @link   https://randomnerdtutorials.com/esp32-async-web-server-espasyncwebserver-library/.
  */
 void onHttpFileUpload(AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
@@ -1792,6 +3473,9 @@ void onHttpFileUpload(AsyncWebServerRequest *request, String filename, size_t in
         Serial.println("\nhttpServer endpoint \"/upload\".\nonHttpFileUpload() running.");
         SD.remove("/" + filename);                          // Delete file.
         Serial.printf("%s deleted on SD.\n", filename.c_str());
+        if (assetCacheDrop(filename.c_str()) && (!filename.endsWith(".gz"))) {
+            SD.remove("/" + filename + ".gz");              // Stale pre-gzipped copy.
+        }
         uploadFile = SD.open("/" + filename, FILE_WRITE);   // Open file for writing.
         if (uploadFile) {
             Serial.printf("%s opened on SD.\n", filename.c_str());
@@ -1812,6 +3496,9 @@ void onHttpFileUpload(AsyncWebServerRequest *request, String filename, size_t in
     if (final) {                                            // Complete.
         uploadFile.close();
         Serial.printf("%s closed on SD.\n", filename.c_str());
+        if (("/" + filename) == ASSET_MANIFEST) {
+            assetCacheLoad();                               // New build of the UI assets.
+        }
         request->send(200, "text/plain", "Upload complete. File saved to SD.");
     }
 }
@@ -1826,7 +3513,10 @@ void onHttpFileUpload(AsyncWebServerRequest *request, String filename, size_t in
  * @since  3.0.8 [2025-12-01-05:15pm] Changed color & blink status.
  * @since  3.2.1  [2026-07-28-04:45pm] Removed NMEA out switch & preference.
  * @since  3.2.1  [2026-07-30-10:00am] Refactored case WS_EVT_DATA.
- * @see    startWebSocketServer().
+ * @since  3.2.2  [2026-10-16-02:00pm] Pooled wsRxPool[] buffer, queue handle. Keyframe on connect.
+ * @since  3.2.2  [2026-10-17-10:00am] Track clients (wsClientAdd(), wsClientRemove()), sender ID in WsRxBuffer.
+ * @since  3.2.2  [2026-10-17-12:30pm] No LED writes: taskLoopStatusLed() reads wsClientIds[].
+ * @see    startWebSocketServer(), startQueues().
  * @link   https://randomnerdtutorials.com/esp32-websocket-server-arduino/.
  * @link   https://shawnhymel.com/1882/how-to-create-a-web-server-with-websockets-using-an-esp32-in-arduino/.
  */
@@ -1835,33 +3525,34 @@ void onWebSocketEvent(AsyncWebSocket *httpServer, AsyncWebSocketClient *client,
     switch (type) {
         case WS_EVT_CONNECT:
             Serial.printf("WS #%u: %s connected to server.\n", clientId, client->remoteIP().toString().c_str());
-            ws2812LedColor = GREEN;                         // Loop status indicator LED.
-            ws2812LedBlink = false;
             wsSendCount    = 0;                             // Reset counter.
+            wsClientAdd(client->id());                      // New client: JSON until it asks for compact, keyframe first.
             break;
         case WS_EVT_DISCONNECT:
             Serial.printf("WS #%u: disconnected.\n\n", clientId);
-            ws2812LedColor = BLUE;
-            ws2812LedBlink = false;
             wsSendCount    = 0;                             // Reset counter.
+            wsClientRemove(client->id());
             break;
         case WS_EVT_DATA: {
                 AwsFrameInfo *info = (AwsFrameInfo*)arg;
                 if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT) {   // Full message received.
-                    WsQueueItem item;                                                                   // Struct - holds data & length.
-                    item.len = (len < sizeof(item.data) - 1) ? len : sizeof(item.data) - 1;             // Bounds check.
-                    memcpy(item.data, data, item.len);
-                    item.data[item.len] = '\0';                                                         // For debug printing.
-                    if (xQueueSend(wsRxQueue, &item, 0) != pdTRUE) {                                    // Non-blocking; drop if full.
+                    uint8_t handle;                                                                     // Index into wsRxPool[].
+                    if (xQueueReceive(wsRxFreeQueue, &handle, 0) != pdTRUE) {                           // Non-blocking; drop if no free buffer.
                         Serial.println("wsRxQueue full, message dropped.");
+                        break;
                     }
+                    WsRxBuffer* item = &wsRxPool[handle];
+                    item->len = (len < WS_RX_BUFFER_SIZE - 1) ? len : WS_RX_BUFFER_SIZE - 1;           // Bounds check.
+                    memcpy(item->data, data, item->len);
+                    item->data[item->len] = '\0';                                                       // For debug printing.
+                    item->client          = client->id();                                               // Per client replies (sendPrefs, keyframe).
+                    xQueueSend(wsRxQueue, &handle, 0);                                                  // Can't be full: # of handles = queue length.
                 }
             }
             break;
+        case WS_EVT_PING:
         case WS_EVT_PONG:
         case WS_EVT_ERROR:
-            // ws2812LedColor = RED;
-            // ws2812LedBlink = false;
             break;
     }
 }
@@ -1876,6 +3567,10 @@ void onWebSocketEvent(AsyncWebSocket *httpServer, AsyncWebSocketClient *client,
  * Send NMEA sentence to MCU #2 for BLE out.
  * 
  * roverGNSS.checkUblox() is not used in loop().
+ * Bytes are framed by nmeaFramerPush() (nmeaFramer.h): length is tracked incrementally, the *hh checksum
+ * is verified & sentences longer than NMEA_MAX_LEN are dropped. Only checksum-valid sentences are logged (as received)
+ * & sent, after nmeaRewrite() (nmeaRewrite.h) has applied the instrument height & any position/height lock in place,
+ * as one bulk Wire1.write() (NMEA_MAX_LEN fits the 128 byte Wire TX buffer, so one transaction per sentence).
  * Error return values from Wire1.beginTransmission():
  *   1: Data too long to fit in transmit buffer.
  *   2: Received NACK on transmit of address: slave device at the specified address did not respond.
@@ -1890,115 +3585,193 @@ void onWebSocketEvent(AsyncWebSocket *httpServer, AsyncWebSocketClient *client,
  * @since  3.0.12 [2026-02-18-11:00pm] Shorten RTCM & NMEA status.
  * @since  3.2.1  [2026-07-28-04:45pm] Removed NMEA out switch & preference.
  * @since  3.2.1  [2026-07-30-10:30am] Global browserUpdatePending flag added.
- * @see    nmeaBuffer[] in Operation section of Global vars.
+ * @since  3.2.2  [2026-10-16-11:00am] nmeaFramerPush(), bulk Wire1.write(), table driven nmeaCount[].
+ * @since  3.2.2  [2026-10-16-08:00pm] Sentence -> session log (logStream[LOG_NMEA]).
+ * @since  3.2.2  [2026-10-16-11:00pm] Metrics: framed -> I2C ack latency, I2C restarts (metricsLoop).
+ * @since  3.2.2  [2026-10-16-11:30pm] nmeaRewrite(): instrument height, position/height lock.
+ * @since  3.2.2  [2026-10-17-09:45am] Fix nmeaRate: timed from the previous GGA (was divided by ~0 us).
+ * @since  3.2.2  [2026-10-17-12:30pm] No LED writes: taskLoopStatusLed() reads i2cUp.
+ * @since  3.2.2  [2026-10-17-01:00pm] Session log before nmeaRewrite() (raw sentence). Lock capture -> nmeaLockConfirm.
+ * @see    nmeaFramer in GNSS section of Global vars, nmeaFramer.h, nmeaRewrite.h.
+ * @see    taskSessionLogger().
  * @link   https://docs.espressif.com/projects/arduino-esp32/en/latest/api/wifi.html.
  * @link   https://github.com/sparkfun/SparkFun_u-blox_GNSS_v3/tree/main/examples/Basics/Example2_NMEAParsing.
  */
 void DevUBLOXGNSS::processNMEA(char incoming) {
 
     // --- Local vars. ---
-    // nmeaBuffer[] is a global var.
+    // nmeaFramer is a global var.
     uint8_t writeStatus;                                                    // Return value from Wire.endTransmission().
     static  uint64_t nmeaSolutionLength        = 1;
     static  bool     nmeaSolutionBlockComplete = false;
 
     // --- Loop. ---
-    if (inLoop) {
-        strncat(nmeaBuffer, &incoming, 1);                                  // Add NMEA byte from RTK-SMA to outbound buffer.
-        if ((incoming == '\n') && (nmeaBuffer[0] == '$')) {                 // We have a full sentence.
-            // TODo: Here is where the NMEA sentence should get modified for instrument hieght and lock button.
-            if (i2cUp) {                                                    // Slave is up.
-                Wire1.beginTransmission(8);                                 // Prepare to send on I2C1.
-                for (int i = 0; i < strlen(nmeaBuffer); i++) {              // Add bytes to output queue.
-                    Wire1.write(nmeaBuffer[i]);
-                }
-                writeStatus = Wire1.endTransmission(8);                 // Send sentence on I2C1.
-                if (writeStatus == 0) {                                     // Success: master (Wire1 on MCU #1) & slave (Wire on MCU #2) are both up.
-                    nmeaCountAll++;                                         // Increment counter for all NMEA sentences sent.
-                    if (strncmp(&nmeaBuffer[3], "GGA", 3) == 0) {           // We have a full GGA sentence.
-                        lastGGAsendTime = esp_timer_get_time();             // Save time when GGA sentence was sent out.
-                        nmeaCountGGA++;                                     // Increment counter for GGA sentences sent.
-                        nmeaSolutionBlockComplete = true;                   // NMEA solution block is complete.
-                    } else if (strncmp(&nmeaBuffer[3], "RMC", 3) == 0) {
-                        nmeaCountRMC++;
-                    } else if (strncmp(&nmeaBuffer[3], "GSA", 3) == 0) {
-                        nmeaCountGSA++;
-                    } else if (strncmp(&nmeaBuffer[3], "GSV", 3) == 0) {
-                        nmeaCountGSV++;
-                    } else if (strncmp(&nmeaBuffer[3], "GST", 3) == 0) {
-                        nmeaCountGST++;
-                    } else if (strncmp(&nmeaBuffer[3], "TXT", 3) == 0) {
-                        nmeaCountTXT++;
-                    } else {
-                        nmeaCountOther++;
-                        if (commandFlag[DEBUG_NMEA_COUNTS]) {
-                            Serial.println(nmeaBuffer);
-                        }
-                    }
-                    if (zeroStatusCounters) {                               // Zero all NMEA status counters.
-                            nmeaCountAll       = 0;
-                            nmeaCountGGA       = 0;
-                            nmeaCountRMC       = 0;
-                            nmeaCountGSA       = 0;
-                            nmeaCountGSV       = 0;
-                            nmeaCountGST       = 0;
-                            nmeaCountTXT       = 0;
-                            nmeaCountOther     = 0;
-                            zeroStatusCounters = false;
-                    }
-                    if (commandFlag[DEBUG_NMEA_COUNTS]) {
-                        Serial.printf("All=%u, GGA=%u, RMC=%u, GSA=%u, GSV=%u, GST=%u, TXT=%u, $other=%u.\n",
-                        nmeaCountAll, nmeaCountGGA, nmeaCountRMC, nmeaCountGSA, nmeaCountGSV, nmeaCountGST, nmeaCountTXT, nmeaCountOther);
-                    }
-                    if (commandFlag[DEBUG_NMEA]) {                          // Debug - show NMEA sentence characters.
-                        if (strncmp("$GNGGA", nmeaBuffer, 6) == 0) {
-                            Serial.print('\n');
-                        }
-                        Serial.printf("%u %s", nmeaCountAll, nmeaBuffer);   // Display NMEA sentence (nmeaBuffer already ends with [CR][LF]).
-                    }
-                    if (commandFlag[DEBUG_NMEA_HEX]) {                      // Debug - show NMEA sentence characters in hex.
-                        if (strncmp("$GNGGA", nmeaBuffer, 6) == 0) {
-                            Serial.println('\n');
-                        }
-                        Serial.printf("%u %s", nmeaCountAll, nmeaBuffer);   // Display NMEA sentence (nmeaBuffer already ends with [CR][LF]).
-                        for (int i = 0; i < strlen(nmeaBuffer); i++) {      // Display NMEA sentence characters in hex.
-                            Serial.printf("[\"%c\" 0x%02X] ",nmeaBuffer[i], nmeaBuffer[i]);
-                        }
-                        Serial.println('\n');
-                    }
+    if (!inLoop) {
+        return;
+    }
+    NmeaFrameStatus frameStatus = nmeaFramerPush(&nmeaFramer, incoming);   // Add NMEA byte from RTK-SMA to the framer.
+    if (frameStatus != NMEA_FRAME_OK) {
+        if ((frameStatus != NMEA_FRAME_PENDING) && (commandFlag[DEBUG_NMEA_COUNTS])) {
+            Serial.printf("NMEA dropped (%s): %.*s\n", (frameStatus == NMEA_FRAME_OVERFLOW) ? "length" : "checksum", (int)nmeaFramer.len, nmeaFramer.buf);
+        }
+        return;
+    }
 
-                    // -- If on NMEA page, save sentence for processJsonActivity() call in next loop() & flag update. --
-                    // NmeaBuffer gets memset (cleared), so it needs to be saved into lastNmea.
-                    // This shifts the NMEA sentence's arrival at the browser by roughly one loop() pass (microseconds) which is negligable.
-                    if (strcmp(whichPage, "nmea") == 0) {
-                        strlcpy(lastNmea, nmeaBuffer, sizeof(lastNmea));
-                        browserUpdatePending = true;
-                    }
+    // --- We have a full, checksum-valid sentence. ---
+    const int64_t  frameTime   = esp_timer_get_time();                     // Metrics: framed -> I2C ack.
+    const char*    sentence    = nmeaFramer.buf;
+          uint16_t sentenceLen = nmeaFramer.len;                           // Changed by nmeaRewrite().
+    const uint8_t  sentenceType = nmeaFramer.type;
+
+    // -- Save latest GGA for the NTRIP caster (taskNtripClient() reads it on core 0). --
+    if ((sentenceType == NMEA_TYPE_GGA) && ntripGgaWanted) {
+        portENTER_CRITICAL(&ntripGgaMux);
+        memcpy(ntripGga, sentence, sentenceLen + 1);                        // Includes '\0'.
+        ntripGgaTime = esp_timer_get_time();
+        portEXIT_CRITICAL(&ntripGgaMux);
+    }
 
-                    i2cUp = true;
-                    NMEAout = true;                                         // NMEA sent out succesfully to MCU #2.
+    // -- Session log (taskSessionLogger() writes it to SD). The sentence as received, before the rewrite below. --
+    logGatePush(&logSession, &logStream[LOG_NMEA].ring, (const uint8_t*)sentence, sentenceLen);
 
-                    // -- Calculate NMEA status values for oper page. --
-                    if (nmeaSolutionBlockComplete) {                        // For each solution block ...
-                        nmeaRate = (nmeaSolutionLength * 1024) / (esp_timer_get_time() - lastGGAsendTime);          // Average kbps x 1000 per solution.
-                        lastGGAsendTime = esp_timer_get_time();             // Save time when last GGA sent.
-                        nmeaSolutionBlockComplete = false;                  // Start a new solution block.
-                        nmeaSolutionLength = 0;                             // Reset counter for # of bytes in solution block.
-                    }
-                    nmeaSolutionLength += strlen(nmeaBuffer);               // Each NMEA sentence - add to total bytes for this solution block.
-                } else {
-                    i2cUp = false;                                          // Wire1 is down.
-                    NMEAout = false;
-                    ws2812LedColor = RED;
-                    ws2812LedBlink = false;
-                    startI2C();                                             // Restart Wire & Wire1.
+    // -- Rewrite in place: altitude - instrument height, locked position/height (ghost mode). The caster above gets the antenna position. --
+    // Only the Wire1 output (& lastNmea, the NMEA page) is rewritten.
+    if ((sentenceType == NMEA_TYPE_GGA) && (nmeaRewriter.lockPending != 0)) {
+        uint8_t pending = nmeaRewriter.lockPending;
+        if (nmeaLockCapture(&nmeaRewriter, sentence, sentenceLen)) {   // Lock the first GGA with a fix.
+            nmeaLockConfirm     |= pending;                             // "locked" reply with the next browser update.
+            browserUpdatePending = true;
+        }
+    }
+    sentenceLen = nmeaRewrite(&nmeaRewriter, nmeaFramer.buf, sentenceLen, sentenceType, prfInstrHgt);
+
+    if (i2cUp) {                                                            // Slave is up.
+        Wire1.beginTransmission(8);                                         // Prepare to send on I2C1.
+        Wire1.write((const uint8_t*)sentence, sentenceLen);                 // Add sentence to output queue in one call.
+        writeStatus = Wire1.endTransmission(8);                             // Send sentence on I2C1.
+        if (writeStatus == 0) {                                             // Success: master (Wire1 on MCU #1) & slave (Wire on MCU #2) are both up.
+            metricWriteBegin(&metricsLoopLock);
+            metricHistRecord(&metricsLoop.nmeaToI2c, esp_timer_get_time() - frameTime);
+            metricWriteEnd(&metricsLoopLock);
+            if (zeroStatusCounters) {                                       // Zero all NMEA status counters.
+                nmeaCountAll = 0;
+                memset(nmeaCount, 0, sizeof(nmeaCount));
+                zeroStatusCounters = false;
+            }
+            nmeaCountAll++;                                                 // Increment counter for all NMEA sentences sent.
+            nmeaCount[sentenceType]++;                                      // Increment counter for this sentence type.
+            if (sentenceType == NMEA_TYPE_GGA) {                            // We have a full GGA sentence.
+                nmeaSolutionBlockComplete = true;                           // NMEA solution block is complete.
+            } else if ((sentenceType == NMEA_TYPE_OTHER) && (commandFlag[DEBUG_NMEA_COUNTS])) {
+                Serial.print(sentence);
+            }
+            if (commandFlag[DEBUG_NMEA_COUNTS]) {
+                Serial.printf("All=%zu", nmeaCountAll);
+                for (uint8_t i = 0; i < NMEA_TYPE_OTHER; i++) {
+                    Serial.printf(", %s=%zu", NMEA_TYPE_IDS[i], nmeaCount[i]);
+                }
+                Serial.printf(", $other=%zu.\n", nmeaCount[NMEA_TYPE_OTHER]);
+            }
+            if (commandFlag[DEBUG_NMEA]) {                                  // Debug - show NMEA sentence characters.
+                if (sentenceType == NMEA_TYPE_GGA) {
+                    Serial.print('\n');
+                }
+                Serial.printf("%zu %s", nmeaCountAll, sentence);             // Display NMEA sentence (sentence already ends with [CR][LF]).
+            }
+            if (commandFlag[DEBUG_NMEA_HEX]) {                              // Debug - show NMEA sentence characters in hex.
+                if (sentenceType == NMEA_TYPE_GGA) {
+                    Serial.println('\n');
+                }
+                Serial.printf("%zu %s", nmeaCountAll, sentence);             // Display NMEA sentence (sentence already ends with [CR][LF]).
+                for (uint16_t i = 0; i < sentenceLen; i++) {                // Display NMEA sentence characters in hex.
+                    Serial.printf("[\"%c\" 0x%02X] ", sentence[i], sentence[i]);
                 }
+                Serial.println('\n');
+            }
+
+            // -- If on NMEA page, save sentence for processJsonActivity() call in next loop() & flag update. --
+            // nmeaFramer.buf is reused for the next sentence, so it needs to be saved into lastNmea.
+            // This shifts the NMEA sentence's arrival at the browser by roughly one loop() pass (microseconds) which is negligable.
+            if (strcmp(whichPage, "nmea") == 0) {
+                memcpy(lastNmea, sentence, sentenceLen + 1);                // sentenceLen < NMEA_MAX_LEN <= sizeof(lastNmea), includes '\0'.
+                browserUpdatePending = true;
+            }
+
+            i2cUp = true;
+            NMEAout = true;                                                 // NMEA sent out succesfully to MCU #2.
+
+            // -- Calculate NMEA status values for oper page. --
+            if (nmeaSolutionBlockComplete) {                                // For each solution block ...
+                nmeaRate = (nmeaSolutionLength * 1024) / (esp_timer_get_time() - lastGGAsendTime);          // Average kbps x 1000 per solution.
+                lastGGAsendTime = esp_timer_get_time();                     // Save time when last GGA sent.
+                nmeaSolutionBlockComplete = false;                          // Start a new solution block.
+                nmeaSolutionLength = 0;                                     // Reset counter for # of bytes in solution block.
             }
-            memset(nmeaBuffer, '\0', sizeof(nmeaBuffer));
+            nmeaSolutionLength += sentenceLen;                              // Each NMEA sentence - add to total bytes for this solution block.
+        } else {
+            i2cUp = false;                                                  // Wire1 is down.
+            NMEAout = false;                                                // LED red: taskLoopStatusLed() reads i2cUp.
+            metricWriteBegin(&metricsLoopLock);
+            metricsLoop.i2cRestarts++;
+            metricWriteEnd(&metricsLoopLock);
+            startI2C();                                                     // Restart Wire & Wire1.
         }
     }
 }
 
+/**
+ * -------------------------------------------------------------------------
+ *  <SparkFun_u-blox_GNSS_v3.h> auto NAV-PVT callback (UBX_NAV_PVT_data_t).
+ * -------------------------------------------------------------------------
+ *
+ * Called from roverGNSS.checkCallbacks() in loop(), once per epoch. Copies the fix half of gnssEpoch.
+ *
+ * @param  UBX_NAV_PVT_data_t* pvt NAV-PVT copy held by the library.
+ * @return void No output is returned.
+ * @since  3.2.2 [2026-10-16-04:00pm] New.
+ * @see    startAndConfigGNSS(), buildOperData().
+ */
+void onNavPvt(UBX_NAV_PVT_data_t* pvt) {
+    gnssEpoch.pvtTow   = pvt->iTOW;
+    gnssEpoch.numSv    = pvt->numSV;
+    gnssEpoch.fixType  = pvt->fixType;
+    gnssEpoch.carrSoln = pvt->flags.bits.carrSoln;
+    gnssEpoch.ready    = (gnssEpoch.pvtTow == gnssEpoch.hpTow);             // Both halves of this epoch.
+    if (gnssEpoch.ready) {
+        gnssEpochTime = esp_timer_get_time();                               // Metrics: epoch -> WebSocket send.
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  <SparkFun_u-blox_GNSS_v3.h> auto NAV-HPPOSLLH callback (UBX_NAV_HPPOSLLH_data_t).
+ * -------------------------------------------------------------------------
+ *
+ * Called from roverGNSS.checkCallbacks() in loop(), once per epoch. Copies the position half of gnssEpoch.
+ *
+ * @param  UBX_NAV_HPPOSLLH_data_t* hp NAV-HPPOSLLH copy held by the library.
+ * @return void No output is returned.
+ * @since  3.2.2 [2026-10-16-04:00pm] New.
+ * @see    startAndConfigGNSS(), buildOperData().
+ */
+void onNavHpposllh(UBX_NAV_HPPOSLLH_data_t* hp) {
+    gnssEpoch.hpTow    = hp->iTOW;
+    gnssEpoch.lat      = hp->lat;
+    gnssEpoch.lon      = hp->lon;
+    gnssEpoch.latHp    = hp->latHp;
+    gnssEpoch.lonHp    = hp->lonHp;
+    gnssEpoch.height   = hp->height;
+    gnssEpoch.hMsl     = hp->hMSL;
+    gnssEpoch.heightHp = hp->heightHp;
+    gnssEpoch.hMslHp   = hp->hMSLHp;
+    gnssEpoch.hAcc     = hp->hAcc;
+    gnssEpoch.vAcc     = hp->vAcc;
+    gnssEpoch.ready    = (gnssEpoch.pvtTow == gnssEpoch.hpTow);             // Both halves of this epoch.
+    if (gnssEpoch.ready) {
+        gnssEpochTime = esp_timer_get_time();                               // Metrics: epoch -> WebSocket send.
+    }
+}
+
 /**
  * =========================================================================
  *  Loop functions.
@@ -2018,6 +3791,7 @@ void DevUBLOXGNSS::processNMEA(char incoming) {
  * -------------------------------------------------------------------------
  * 
  * Throttle roverGNSS.checkUblox() calls, which throttles DevUBLOXGNSS::processNMEA().
+ * On the operate page the same poll also delivers NAV-PVT & NAV-HPPOSLLH (auto, once per epoch); no getter polls.
  * 
  * (prfGnsNavRat * prfGnsMsrInt) = interval (ms) to query ZED for PVT data.
  * 
@@ -2026,30 +3800,53 @@ void DevUBLOXGNSS::processNMEA(char incoming) {
  * @since  3.0.12 [2026-02-08-05:00pm] New.
  * @since  3.0.12 [2026-02-14-06:15pm] Replace prfRqsPvtInt with (prfGnsNavRat * prfGnsMsrInt).
  * @since  3.2.1  [2026-07-30-11:15am] Moved jsonDocToBrowser.clear() to processJsonActivity().
- * @see    DevUBLOXGNSS::processNMEA().
+ * @since  3.2.2  [2026-10-16-04:00pm] Operate page: same throttled checkUblox() plus checkCallbacks().
+ * @since  3.2.2  [2026-10-16-06:00pm] Also poll while the NTRIP caster wants GGA (ntripGgaWanted).
+ * @since  3.2.2  [2026-10-16-08:00pm] Also poll while a session log is open. UBX (RXM-RAWX & RXM-SFRBX) -> logStream[LOG_UBX].
+ * @see    DevUBLOXGNSS::processNMEA(), onNavPvt(), onNavHpposllh(), taskSessionLogger().
  */
 void checkZedTriggerUpdate() {
 
-    // --- NMEA page. ---
-    if (strcmp(whichPage, "nmea") == 0) {
-        // -- Local vars. --
-        const  int64_t THROTTLE_CHECK_ZED = (prfGnsNavRat * prfGnsMsrInt) * 1000;   // Convert from (us) to (ms), time between checkZedTriggerUpdate().
-        static int64_t lastZedCheck = esp_timer_get_time();                         // Throttle. Initialize only once, then persist.
-               int64_t lastTime;
+    // --- Local vars. ---
+    const  int64_t THROTTLE_CHECK_ZED = (prfGnsNavRat * prfGnsMsrInt) * 1000;   // Convert from (us) to (ms), time between checkZedTriggerUpdate().
+    static int64_t lastZedCheck = esp_timer_get_time();                         // Throttle. Initialize only once, then persist.
+    static uint8_t ubxChunk[512];                                               // roverGNSS file buffer -> logStream[LOG_UBX].
+    bool           operatePage  = (strcmp(whichPage, "operate") == 0);
+    uint16_t       numBytes     = 0;
+
+    // --- NMEA & operate pages, NTRIP caster wants GGA, or session log (UBX still on: keep polling until off). ---
+    if ((!operatePage) && (strcmp(whichPage, "nmea") != 0) && (!ntripGgaWanted) && (!logSession.open) && (!logUbxOn)) {
+        return;
+    }
 
-        // -- Throttle loop() calls. --
-        if ((esp_timer_get_time() - lastZedCheck) < THROTTLE_CHECK_ZED) {           // Not time to run.
-            return; 
-        }
-        lastZedCheck = esp_timer_get_time();                                        // Time to run. Reset timer.
+    // -- Throttle loop() calls. --
+    if ((esp_timer_get_time() - lastZedCheck) < THROTTLE_CHECK_ZED) {           // Not time to run.
+        return; 
+    }
+    lastZedCheck = esp_timer_get_time();                                        // Time to run. Reset timer.
+
+    // -- Session log: RXM-RAWX & RXM-SFRBX on/off. --
+    if (logUbxOn != logSession.open) {
+        logUbxOn = logSession.open;
+        roverGNSS.setAutoRXMRAWX(logUbxOn, false, VAL_LAYER_RAM);
+        roverGNSS.setAutoRXMSFRBX(logUbxOn, false, VAL_LAYER_RAM);
+        roverGNSS.logRXMRAWX(logUbxOn);                                        // Raw UBX frame -> roverGNSS file buffer.
+        roverGNSS.logRXMSFRBX(logUbxOn);
+    }
 
-        // -- Check ZED. --
-        roverGNSS.checkUblox();
-        lastTime = esp_timer_get_time();
+    // -- Check ZED. --
+    roverGNSS.checkUblox();                                                     // NMEA -> DevUBLOXGNSS::processNMEA(). UBX -> library copies.
+    roverGNSS.checkCallbacks();                                                 // NAV-PVT -> onNavPvt(), NAV-HPPOSLLH -> onNavHpposllh().
+
+    // -- Session log: UBX. Always drain the file buffer, push only while open. --
+    while ((numBytes = roverGNSS.fileBufferAvailable()) > 0) {
+        numBytes = (numBytes > sizeof(ubxChunk)) ? sizeof(ubxChunk) : numBytes;
+        roverGNSS.extractFileBufferData(ubxChunk, numBytes);
+        logGatePush(&logSession, &logStream[LOG_UBX].ring, ubxChunk, numBytes);
     }
 
     // --- Build data for operate page. ---
-    if (strcmp(whichPage, "operate") == 0) {
+    if (operatePage) {
         buildOperData();
     }
 }
@@ -2060,9 +3857,9 @@ void checkZedTriggerUpdate() {
  * -------------------------------------------------------------------------
  * 
  * Operation summary:
- *  1. Pull (xQueueReceive) JSON struct (data & length) from GhostRover FreeRTOS QueueHandle_t wsRxQueue.
- *     JSON struct was pushed (xQueueSend) into GhostRover FreeRTOS QueueHandle_t wsRxQueue by onWebSocketEvent().
- *  2. If data pulled from queue, deserialize into jsonDocFromBrowser.
+ *  1. Pull (xQueueReceive) buffer handle from GhostRover FreeRTOS QueueHandle_t wsRxQueue.
+ *     Handle was pushed (xQueueSend) into GhostRover FreeRTOS QueueHandle_t wsRxQueue by onWebSocketEvent().
+ *  2. If handle pulled from queue, deserialize wsRxPool[handle] into jsonDocFromBrowser (which copies), return handle to wsRxFreeQueue.
  *  3. Clear jsonDocToBrowser & response.
  *  4. Save browser page name as global var.
  *  5. Set global vars. from jsonDocFromBrowser. Read/set preferences if on config page.
@@ -2082,6 +3879,8 @@ void checkZedTriggerUpdate() {
  *  --- Notes. --- 
  *      1) NTRIP CASTER PREFERENCE is an embedded JSON string. Attributes for each NTRIP caster are sent/received (and stored in NVS) as a single JSON string.
  *      2) Numeric JSON keys are used to reduce JSON string length.
+ *      3) If the browser sends "compact", GNSS STATUS & NMEA SENTENCE are sent to that client as binary frames instead. @see wsTelemetry.h.
+ *         Compact mode, keyframe requests & delta state are per client (wsClients[]); other clients keep getting JSON.
  * 
  * --- JSON key index. ---
  *     0  = Build info                      (buildString).
@@ -2107,13 +3906,13 @@ void checkZedTriggerUpdate() {
  *     20 = Up time                         (char     uptime[20]).
  *     21 = RTCM in count all               Not used?
  *     22 = RTCM in rate                    Not used?
- *     23 = NMEA GGA out sentence count     (size_t   nmeaCountGGA).
- *     24 = NMEA RMC out sentence count     (size_t   nmeaCountRMC).
- *     25 = NMEA GSA out sentence count     (size_t   nmeaCountGSA).
- *     26 = NMEA GSV out sentence count     (size_t   nmeaCountGSV).
- *     27 = NMEA GST out sentence count     (size_t   nmeaCountGST).
- *     28 = NMEA TXT out sentence count     (size_t   nmeaCountTXT).
- *     29 = NMEA other out sentence count   (size_t   nmeaCountOther).
+ *     23 = NMEA GGA out sentence count     (size_t   nmeaCount[NMEA_TYPE_GGA]).
+ *     24 = NMEA RMC out sentence count     (size_t   nmeaCount[NMEA_TYPE_RMC]).
+ *     25 = NMEA GSA out sentence count     (size_t   nmeaCount[NMEA_TYPE_GSA]).
+ *     26 = NMEA GSV out sentence count     (size_t   nmeaCount[NMEA_TYPE_GSV]).
+ *     27 = NMEA GST out sentence count     (size_t   nmeaCount[NMEA_TYPE_GST]).
+ *     28 = NMEA TXT out sentence count     (size_t   nmeaCount[NMEA_TYPE_TXT]).
+ *     29 = NMEA other out sentence count   (size_t   nmeaCountAll - above).
  *     30 = NMEA total out sentence count   (size_t   nmeaCountAll).
  *     31 = NMEA out rate                   (int64_t  nmeaRate).
  *     32 = Operational mode                (char     operMode[2]).
@@ -2136,6 +3935,17 @@ void checkZedTriggerUpdate() {
  *     49 = NTRIP caster user               (struct ntripCasterProfile caster[1/2/3].user    - char user[48]).
  *     50 = NTRIP caster password           (struct ntripCasterProfile caster[1/2/3].pass    - char user[48]).
  *     51 = NTRIP caster sendGga            (struct ntripCasterProfile caster[1/2/3].sendGga - bool ).
+ *     52 = GNSS epoch time of week (ms)    (uint32_t gnssEpochTow).
+ *     53 = NTRIP caster GGA interval (s)   (struct ntripCasterProfile caster[1/2/3].ggaInterval - uint16_t).
+ *     54 = NTRIP latency (ms)              (float    ntripLatencyMs).
+ *     55 = NTRIP rate (bytes/s)            (uint32_t ntripBytesPerSec).
+ *     56 = NTRIP reconnects (successful)   (uint32_t ntripReconnects).
+ *     57 = RTCM in -> ZED p95 (ms)         (metricsRelay.rxToZed   - metricsToBrowser()).
+ *     58 = NMEA -> I2C ack p95 (ms)        (metricsLoop.nmeaToI2c  - metricsToBrowser()).
+ *     59 = Epoch -> WebSocket p95 (ms)     (metricsLoop.epochToWs  - metricsToBrowser()).
+ *     60 = loop() time p95 (ms)            (metricsLoop.loopTime   - metricsToBrowser()).
+ *     61 = I2C restarts                    (metricsLoop.i2cRestarts).
+ *     62 = Least free task stack           (metricsLoop.task[]     - "name bytes").
  *
  *  --- Description of exchange protocol. ---
  *
@@ -2186,7 +3996,11 @@ void checkZedTriggerUpdate() {
  *       "34":"172.20.10.2",
  *       "35":30,
  *       "37":12,
- *       "38":89
+ *       "38":89,
+ *       "52":412345000,
+ *       "54":3.2,
+ *       "55":1180,
+ *       "56":0
  * 
  *   -- NMEA SENTENCE. --
  *     "NMEA":"$GLGSV,1,1,01,77,06,333,10,3*4F\r\n", etc.
@@ -2246,15 +4060,17 @@ void checkZedTriggerUpdate() {
  *       browser (sends)    --> {"page":"operate",{"laserOff:""}.
  *       browser (receives) <-- {"laserOffResp":"Laser off."}.
  *
- *     - Height lock/unlock button. --
+ *     - Height lock/unlock button. -- Lock takes the altitude of the next GGA with a fix (nmeaLockCapture()).
  *       browser (sends)    --> {"page":"operate",{"heightLock:""}.
- *       browser (receives) <-- {"heightLockResp":"Height locked"}.
+ *       browser (receives) <-- {"heightLockResp":"Height lock pending."}.
+ *       browser (receives) <-- {"heightLockResp":"Height locked."}. With the next update once captured (nmeaLockConfirm).
  *       browser (sends)    --> {"page":"operate",{"heightUnlock:""}.
  *       browser (receives) <-- {"heightUnlockResp":"Height unlocked."}.
  *
- *     - Position lock/unlock button. --
+ *     - Position lock/unlock button. -- Lock takes lat/lon & geoid separation of the next GGA with a fix (ghost mode).
  *       browser (sends)    --> {"page":"operate",{"positionLock:""}.
- *       browser (receives) <-- {"positionLockResp":"Position locked"}.
+ *       browser (receives) <-- {"positionLockResp":"Position lock pending."}.
+ *       browser (receives) <-- {"positionLockResp":"Position locked."}. With the next update once captured (nmeaLockConfirm).
  *       browser (sends)    --> {"page":"operate",{"positionUnlock:""}.
  *       browser (receives) <-- {"positionUnlockResp":"Position unlocked."}.
  *
@@ -2266,6 +4082,12 @@ void checkZedTriggerUpdate() {
  *       browser (receives) <-- {"sendPrefsResp":"Preferences sent.",ALL PREFERENCES}.
  *       browser (receives) <-- {NMEA SENTENCE}. Continues in loop() until page is left.
  *
+ *  -- Compact telemetry (operate & NMEA pages). --
+ *       browser (sends)    --> {"page:"operate","sendPrefs":"","compact":""}.
+ *       browser (receives) <-- {"sendPrefsResp":"Preferences sent.",ALL PREFERENCES}, then binary keyframe & delta frames. @see wsTelemetry.h.
+ *       browser (sends)    --> {"keyframe":""}. Browser saw a sequence # gap. Doesn't change the page ("page" is ignored).
+ *       browser (receives) <-- binary keyframe (this client only).
+ *
  *  -- Test. --
  *     - Echo. -
  *       browser (sends)    --> {"page":"TBD","echo":"some text"}.
@@ -2286,6 +4108,12 @@ void checkZedTriggerUpdate() {
  * @since 3.2.1  [2026-07-30-10:45am] Implement FreeRTOS queues: refactor onWebSocketMessage() into processJsonActivity().
  *                Fix cross-task race on shared JsonDocuments causing intermittent LoadProhibited/heap-corruption crashes.
  * @since 3.2.1  [2026-07-30-11:45am] Set page name global var. 
+ * @since 3.2.2  [2026-10-16-02:00pm] wsRxPool[] handles, "compact" & "keyframe" keys.
+ * @since 3.2.2  [2026-10-16-06:00pm] NTRIP keys 53-56, ntripRestart on preference changes.
+ * @since 3.2.2  [2026-10-16-11:30pm] Implement height & position lock/unlock (nmeaRewriter, ghostMode).
+ * @since 3.2.2  [2026-10-17-10:00am] "compact" & "keyframe" apply to the sending client only, "keyframe" leaves whichPage alone.
+ * @since 3.2.2  [2026-10-17-01:00pm] Height & position lock reply "pending", then "locked" once captured (nmeaLockConfirm).
+ * @since 3.2.2  [2026-10-17-03:00pm] Preference writers wake taskNtripClient(), resetPrefs sets ntripRestart.
  * @see   Global vars: GNSS, prefUtility(), onWebSocketEvent(), startWebSocketServer().
  * @link  https://randomnerdtutorials.com/esp32-websocket-server-arduino/.
  * @link  https://randomnerdtutorials.com/esp32-websocket-server-sensor/.
@@ -2306,19 +4134,23 @@ void checkZedTriggerUpdate() {
 
     // --- Local vars. ---
     // jsonDocFromBrowser, jsonDocToBrowser, &  JsonDocNtrip are global vars.
-    WsQueueItem item;
+    uint8_t handle;                                                                 // Index into wsRxPool[].
 
     // --- Step 1/2: Process one incoming WebSocket message, if queued. ---
-    if (xQueueReceive(wsRxQueue, &item, 0) == pdTRUE) {
+    if (xQueueReceive(wsRxQueue, &handle, 0) == pdTRUE) {
+        WsRxBuffer* item   = &wsRxPool[handle];
+        WsClient*   sender = wsClientFind(item->client);                            // Compact telemetry state of the sender, NULL if not tracked.
 
         // -- Debug. Print data received. --
         if (commandFlag[DEBUG_WS]) {
-            Serial.printf("WS #%u: browser --> %s\n", clientId, item.data);
+            Serial.printf("WS #%u: browser --> %s\n", clientId, item->data);
         }
 
         // -- WebSocket message - deserialize the JSON data into a JSON document (jsonDocFromBrowser). --
+        // ArduinoJson 7 copies strings into the document, so the buffer goes back to the pool right away.
         jsonDocFromBrowser.clear();
-        DeserializationError error = deserializeJson(jsonDocFromBrowser, item.data, item.len);
+        DeserializationError error = deserializeJson(jsonDocFromBrowser, (const char*)item->data, item->len);
+        xQueueSend(wsRxFreeQueue, &handle, 0);
 
         // -- Begin. --
         if (error) {
@@ -2330,8 +4162,8 @@ void checkZedTriggerUpdate() {
             memset(response, '\0', sizeof(response));
             jsonDocToBrowser.clear();
 
-            // -- Set page name global var.
-            if (jsonDocFromBrowser["page"].is<JsonVariant>()) {                     // Does key exist?
+            // -- Set page name global var. A keyframe request is not a page load. --
+            if (jsonDocFromBrowser["page"].is<JsonVariant>() && (!jsonDocFromBrowser["keyframe"].is<JsonVariant>())) {
                 strlcpy(whichPage, jsonDocFromBrowser["page"], sizeof(whichPage));  // Important global used in loop().
             }
 
@@ -2359,6 +4191,12 @@ void checkZedTriggerUpdate() {
                 jsonDocToBrowser["41"] = prfNtripCastAttr[2];
                 jsonDocToBrowser["42"] = prfNtripCastAct;
 
+                // - Compact telemetry. Browser asks each time a page loads. Only for this client. -
+                if (sender != NULL) {
+                    sender->compact         = jsonDocFromBrowser["compact"].is<JsonVariant>();
+                    sender->keyframePending = true;
+                }
+
                 // - Set response. -
                 strcpy(response, "Preferences sent.");
                 jsonDocToBrowser["sendPrefsResp"] = response;
@@ -2374,13 +4212,15 @@ void checkZedTriggerUpdate() {
                 strlcpy(prfRtcIn,        jsonDocFromBrowser["2"],  sizeof(prfRtcIn));
                 strlcpy(prfHotSsi,       jsonDocFromBrowser["6"],  sizeof(prfHotSsi));
                 strlcpy(prfHotPas,       jsonDocFromBrowser["7"],  sizeof(prfHotPas));
-                strlcpy(prfNtripCastAct, jsonDocFromBrowser["42"], sizeof(prfNtripCastAct));
+                prefNtripSet(prfNtripCastAct, sizeof(prfNtripCastAct), jsonDocFromBrowser["42"]);
                 prfGnsNavRat    = (uint8_t)  atoi(jsonDocFromBrowser["5"]);   // KV values are stored in NVS as int, but set to C-string in processJsonActivity() for code clarity.
                 prfGnsMsrInt    = (uint16_t) atoi(jsonDocFromBrowser["4"]);
                 prfInstrHgt     = (uint16_t) atoi(jsonDocFromBrowser["36"]);
 
                 // - Set new preferences from global vars. -
                 prefUtility(PREF_SET);
+                ntripRestart = true;                                                // taskNtripClient() reloads the active caster profile.
+                xTaskNotifyGive(taskNtripClientHandle);                             // Now, not after its backoff or idle wait.
 
                 // - Set response. -
                 strcpy(response, "Preferences saved.");
@@ -2394,6 +4234,8 @@ void checkZedTriggerUpdate() {
 
                 // - Set global vars to defaults. -
                 prefUtility(PREF_RESET);
+                ntripRestart = true;                                                // prfRtcIn & the active caster profile may have changed.
+                xTaskNotifyGive(taskNtripClientHandle);
 
                 // - Set response. -
                 strcpy(response, "Preferences reset.");
@@ -2424,12 +4266,15 @@ void checkZedTriggerUpdate() {
                 ntripCaster.port    = atoi(JsonDocNtrip["47"]);
                 ntripCaster.version = atoi(JsonDocNtrip["48"]);
                 ntripCaster.sendGga = JsonDocNtrip["51"].as<bool>();
+                ntripCaster.ggaInterval = atoi(JsonDocNtrip["53"] | "10");
 
                 // Set set global var for JSON NTRIP caster (e.g. prfNtripCastAttr[1]).
-                strlcpy(prfNtripCastAttr[ntripCaster.id-1], jsonDocFromBrowser["setNtripCasterPref"], NTRIP_CAST_ATTR_LEN);
+                prefNtripSet(prfNtripCastAttr[ntripCaster.id-1], NTRIP_CAST_ATTR_LEN, jsonDocFromBrowser["setNtripCasterPref"]);
 
                 // - Set new NTRIP preference. -
                 prefUtility(PREF_SET_NTRIP);
+                ntripRestart = true;                                                // taskNtripClient() reloads the active caster profile.
+                xTaskNotifyGive(taskNtripClientHandle);                             // Now, not after its backoff or idle wait.
 
                 // - Set response. -
                 strcpy(response, "Preference updated.");
@@ -2448,7 +4293,7 @@ void checkZedTriggerUpdate() {
                 File file = root.openNextFile();
                 while(file) {
                     if (strlen(output) + strlen(file.name()) + 2 < sizeof(output)) {       
-                        if ((file.name()[0] != '.') && (file.name() != "") && (!file.isDirectory())) {
+                        if ((file.name()[0] != '.') && (file.name()[0] != '\0') && (!file.isDirectory())) {
                             // TODO: Flat fs for now, add directories & recursive call.
                             strcat(output, "/");
                             strcat(output, file.name());
@@ -2498,6 +4343,13 @@ void checkZedTriggerUpdate() {
             // -------------------------------------------------------------------------
             // loop() -> checkZedTriggerUpdate() -> buildOperData() sets browserUpdatePending = true; -> sendDataToBrowser().
 
+            // -------------------------------------------------------------------------
+            // -- Operate page. Compact telemetry keyframe request (browser saw a sequence # gap). --
+            // -------------------------------------------------------------------------
+            if (jsonDocFromBrowser["keyframe"].is<JsonVariant>() && (sender != NULL)) {
+                sender->keyframePending = true;                                         // Sent to this client by sendDataToBrowser() below.
+            }
+
             // -------------------------------------------------------------------------
             // -- Operate page. Laser on/off button. --
             // -------------------------------------------------------------------------
@@ -2524,15 +4376,17 @@ void checkZedTriggerUpdate() {
             // -- Operate page. Height lock/unlock button. --
             // -------------------------------------------------------------------------
             if (jsonDocFromBrowser["heightLock"].is<JsonVariant>()) {
-                // ToDo: Implement.
+                nmeaRewriter.lockPending |= NMEA_LOCK_HEIGHT;              // Captured by DevUBLOXGNSS::processNMEA().
 
-                // - Set response. -
-                strcpy(response, "Height locked.");
+                // - Set response. "Height locked." follows once a GGA with a fix is captured (nmeaLockConfirm). -
+                strcpy(response, "Height lock pending.");
                 jsonDocToBrowser["heightLockResp"] = response;
                 Serial.println(response);
             }
             if (jsonDocFromBrowser["heightUnlock"].is<JsonVariant>()) {
-                // ToDo: Implement.
+                nmeaRewriter.lockPending &= ~NMEA_LOCK_HEIGHT;
+                nmeaRewriter.locked      &= ~NMEA_LOCK_HEIGHT;
+                nmeaLockConfirm          &= ~NMEA_LOCK_HEIGHT;
 
                 // - Set response. -
                 strcpy(response, "Height unlocked.");
@@ -2544,15 +4398,19 @@ void checkZedTriggerUpdate() {
             // -- Operate page. Position lock/unlock button. --
             // -------------------------------------------------------------------------
             if (jsonDocFromBrowser["positionLock"].is<JsonVariant>()) {
-                // ToDo: Implement.
+                nmeaRewriter.lockPending |= NMEA_LOCK_POSITION;            // Captured by DevUBLOXGNSS::processNMEA().
+                ghostMode = true;
 
-                // - Set response. -
-                strcpy(response, "Position locked.");
+                // - Set response. "Position locked." follows once a GGA with a fix is captured (nmeaLockConfirm). -
+                strcpy(response, "Position lock pending.");
                 jsonDocToBrowser["positionLockResp"] = response;
                 Serial.println(response);
             }
             if (jsonDocFromBrowser["positionUnlock"].is<JsonVariant>()) {
-                // ToDo: Implement.
+                nmeaRewriter.lockPending &= ~NMEA_LOCK_POSITION;
+                nmeaRewriter.locked      &= ~NMEA_LOCK_POSITION;
+                nmeaLockConfirm          &= ~NMEA_LOCK_POSITION;
+                ghostMode = false;
 
                 // - Set response. -
                 strcpy(response, "Position unlocked.");
@@ -2606,6 +4464,15 @@ void checkZedTriggerUpdate() {
     if (browserUpdatePending) {
         memset(response, '\0', sizeof(response));
         jsonDocToBrowser.clear();       // Ensure a clean JSON doc for all browser pages (operate, nmea, ...).
+        if (nmeaLockConfirm & NMEA_LOCK_HEIGHT) {                   // Captured by DevUBLOXGNSS::processNMEA().
+            jsonDocToBrowser["heightLockResp"] = "Height locked.";
+            Serial.println("Height locked.");
+        }
+        if (nmeaLockConfirm & NMEA_LOCK_POSITION) {
+            jsonDocToBrowser["positionLockResp"] = "Position locked.";
+            Serial.println("Position locked.");
+        }
+        nmeaLockConfirm = 0;
         sendDataToBrowser();
         browserUpdatePending = false;
     }
@@ -2654,7 +4521,7 @@ void checkSerialUSB() {
             }
             Serial.println('.');
         } else if ((command[0]) == '!') {                       // Disable all debugs.
-            for (size_t i = 0; i <= NUM_COMMANDS; i++) {
+            for (size_t i = 0; i < NUM_COMMANDS; i++) {
                 commandFlag[i] = false;
             }
             Serial.println("All debug disabled.");
@@ -2730,6 +4597,10 @@ void checkGnssLockButton() {
  * @since  3.0.11 [2026-01-15-10:45am] Moved THROTTLE_DEBUG from global to local var.
  * @since  3.0.11 [2026-01-22-02:00pm] Add DEBUG_TEMP.
  * @since  3.1.1  [2026-06-25-04:00pm] Change DEBUG_SER output.
+ * @since  3.2.2  [2026-10-16-09:00am] Add SHOW_RTCM_STATS.
+ * @since  3.2.2  [2026-10-16-08:00pm] Add SHOW_LOG_STATS.
+ * @since  3.2.2  [2026-10-16-11:00pm] Add SHOW_METRICS.
+ * @since  3.2.2  [2026-10-17-09:00am] SHOW_RTCM_STATS reads the metricsRelay snapshot.
  * @see    checkSerialUSB().
  */
 void debug() {
@@ -2737,7 +4608,6 @@ void debug() {
     // --- Local vars. ---
     const int64_t  THROTTLE_DEBUG = 1000000;                            // Time (us) between debug() = (every 1 sec).
     static int64_t lastThrottleTime = esp_timer_get_time();             // Throttle. Initialize only once, then persist.
-           int64_t lastTime;
 
     // --- Throttle loop() calls. ---
     if ((esp_timer_get_time() - lastThrottleTime) < THROTTLE_DEBUG) {   // Not time to run.
@@ -2792,9 +4662,8 @@ void debug() {
             if (Serial1.available() > 0) {
                 while (Serial1.available() > 0)  {
                     char outoutChar = Serial1.read();
-                    if (((int) outoutChar > 31) && ((int) outoutChar < 128)) {
+                    if (((uint8_t) outoutChar > 31) && ((uint8_t) outoutChar < 128)) {
                         Serial.printf("%c",outoutChar);     // Display character from HC-12.
-                        lastTime = esp_timer_get_time();
                     }
                 }
             }
@@ -2803,6 +4672,53 @@ void debug() {
 
     // --- RTCM in. ---
     // @see task taskRtcmRelay().
+    if (commandFlag[SHOW_RTCM_STATS]) {
+        metricsReadRelay(&metricsRelayCopy);                // rtcmFramer belongs to taskRtcmRelay() (core 0).
+        Serial.printf("RTCM in: frames=%lu crcBad=%lu falseStarts=%lu discarded=%lu overflow=%lu bytes=%lu kbps=%.2f\n",
+            (unsigned long)metricsRelayCopy.frames, (unsigned long)metricsRelayCopy.crcBad, (unsigned long)metricsRelayCopy.falseStarts,
+            (unsigned long)metricsRelayCopy.bytesDiscarded, (unsigned long)metricsRelayCopy.bytesOverflow, (unsigned long)metricsRelayCopy.bytesIn,
+            metricsRelayCopy.kbps);
+        for (uint8_t i = 0; i < metricsRelayCopy.numTypes; i++) {
+            const Rtcm3TypeStats* typeStats = &metricsRelayCopy.types[i];
+            Serial.printf("  Type %4u  count=%lu  last=%uB  avg=%luB  interval=%lums\n", typeStats->type, (unsigned long)typeStats->count,
+                typeStats->lastLen, (unsigned long)(typeStats->bytes / typeStats->count), (unsigned long)typeStats->intervalMs);
+        }
+    }
+
+    // --- Session log. ---
+    // @see task taskSessionLogger().
+    if (commandFlag[SHOW_LOG_STATS]) {
+        Serial.printf("Session log %04u %s: slowest write=%lums\n", logSessionNumber, logSession.open ? "open" : "closed", (unsigned long)logWriteMaxMs);
+        for (uint8_t stream = 0; stream < LOG_NUM_STREAMS; stream++) {
+            const LogStream* logStats = &logStream[stream];
+            Serial.printf("  %-4s  in=%lu  dropped=%lu  highWater=%lu/%lu  file=%lu  writeErrors=%lu  lost=%lu\n", LOG_EXTENSION[stream],
+                (unsigned long)logStats->ring.bytesIn, (unsigned long)logStats->ring.bytesDropped, (unsigned long)logStats->ring.highWater,
+                (unsigned long)LOG_RING_SIZE[stream], (unsigned long)logStats->fileBytes, (unsigned long)logStats->writeErrors,
+                (unsigned long)logStats->bytesLost);
+        }
+    }
+
+    // --- Metrics, since boot. ---
+    // @see metricsSampleLoop(), "/metrics" in startHttpServer().
+    if (commandFlag[SHOW_METRICS]) {
+        metricsReadRelay(&metricsRelayCopy);
+        const MetricHistogram* hist[METRICS_NUM_STAGES] = {&metricsRelayCopy.rxToZed, &metricsLoop.nmeaToI2c, &metricsLoop.epochToWs, &metricsLoop.loopTime};
+        Serial.printf("Metrics: i2cRestarts=%lu  heapFree=%lu  psramFree=%lu\n", (unsigned long)metricsLoop.i2cRestarts,
+            (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getFreePsram());
+        for (uint8_t stage = 0; stage < METRICS_NUM_STAGES; stage++) {
+            Serial.printf("  %-14s  n=%lu  p50=%luus  p95=%luus  p99=%luus  max=%luus\n", METRICS_STAGE[stage], (unsigned long)hist[stage]->count,
+                (unsigned long)metricHistPercentile(hist[stage], NULL, 50), (unsigned long)metricHistPercentile(hist[stage], NULL, 95),
+                (unsigned long)metricHistPercentile(hist[stage], NULL, 99), (unsigned long)hist[stage]->maxUs);
+        }
+        for (uint8_t i = 0; i < metricsLoop.numTasks; i++) {
+            Serial.printf("  %-16s  stackFree=%luB  cpu=", metricsLoop.task[i].name, (unsigned long)metricsLoop.task[i].stackFree);
+            if (metricsLoop.task[i].cpuPermille < 0) {
+                Serial.println("n/a");                                  // No FreeRTOS run time stats.
+            } else {
+                Serial.printf("%.1f%%\n", metricsLoop.task[i].cpuPermille / 10.0f);
+            }
+        }
+    }
 
     // --- GNSS. ---
     if (commandFlag[DEBUG_GNSS]) {
@@ -2921,6 +4837,7 @@ void setup() {
  * =========================================================================
  * 
  * @since 3.0.10 [2025-12-27-08:00pm] New.
+ * @since 3.2.2  [2026-10-16-11:00pm] Add metricsSampleLoop().
  * @see   startTasks().
  * @see   GhostRover FreeRTOS functions.
  * @see   Event handlers.
@@ -2932,4 +4849,5 @@ void loop() {
     // checkGnssLockButton();   // Check GNSS lock button.  // ToDo: Implement.
     ws.cleanupClients();        // HTTP WebSocket cleanup.
     debug();                    // Display debug.
+    metricsSampleLoop();        // Metrics: loop() time, task CPU & stack.
 }
@@ -0,0 +1,203 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Runtime metrics.
+ * *************************************************************************
+ *
+ * metrics.h
+ *
+ * Fixed bucket latency histograms & seqlock snapshots used by the "Metrics" globals.
+ * Plain C++ (no Arduino or FreeRTOS calls) so the same code also builds on a host.
+ *
+ * Histogram: METRIC_BUCKETS log2 buckets. Bucket 0 = < 2 us, bucket n = 2^n .. 2^(n+1) - 1 us,
+ *   last bucket = everything above. Recording is a few adds & a count leading zeros, cheap enough to
+ *   leave on in production.
+ *
+ * Seqlock: one writer per snapshot (the producer task), any # of readers on either core.
+ *   Writer: metricWriteBegin(), update fields, metricWriteEnd(). Never waits.
+ *   Reader: metricRead() copies the snapshot & retries if a write overlapped. Bounded: a reader that
+ *           preempted the writer on the same core gives up after METRIC_READ_TRIES & keeps its last copy.
+ *           Between tries it calls METRIC_READ_YIELD() (default: nothing). The sketch defines it as
+ *           taskYIELD() before including this file, so a same core writer of equal priority can finish.
+ *           A reader of higher priority than the writer can still run out of tries: callers must treat
+ *           a false return as "copy is stale" (the last good copy, possibly zeros before the first).
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-16-11:00pm] New.
+ * @see    metricsSampleLoop(), metricsPrint(), startHttpServer() ("/metrics"), debug() in DougFoster_Ghost_Rover.ino.
+ * @see    tests/host/test_metrics.cpp.
+ * @link   http://dougfoster.me.
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * =========================================================================
+ *  Global vars.
+ * =========================================================================
+ */
+
+// --- Histogram. ---
+const uint8_t METRIC_BUCKETS    = 20;                     // Last bucket starts at 2^19 us (524 ms).
+const uint8_t METRIC_READ_TRIES = 8;                      // metricRead() attempts before giving up.
+#ifndef METRIC_READ_YIELD
+#define METRIC_READ_YIELD()                               // Wait hook between metricRead() tries. Host: spin.
+#endif
+
+struct MetricHistogram {                                  // Latency (us) distribution since boot.
+    uint32_t bucket[METRIC_BUCKETS];                      // # of samples per log2 bucket.
+    uint32_t count;                                       // # of samples.
+    uint32_t maxUs;                                       // Largest sample.
+    uint64_t sumUs;                                       // Sum of samples (mean = sumUs / count).
+};
+
+// --- Seqlock. ---
+struct MetricSeqlock {                                    // Odd while a write is in progress.
+    volatile uint32_t seq;
+};
+
+/**
+ * =========================================================================
+ *  Functions.
+ * =========================================================================
+ *
+ * @see metricHistRecord()     - Add a sample.
+ * @see metricHistBucketMax()  - Upper bound of a bucket.
+ * @see metricHistPercentile() - Percentile, since boot or since a previous copy.
+ * @see metricWriteBegin()     - Writer: start update.
+ * @see metricWriteEnd()       - Writer: end update.
+ * @see metricRead()           - Reader: consistent copy.
+ */
+
+/**
+ * -------------------------------------------------------------------------
+ *  Add a sample.
+ * -------------------------------------------------------------------------
+ *
+ * @param  MetricHistogram* hist Histogram.
+ * @param  int64_t          us   Latency (us), negative counts as 0.
+ * @return void             No output is returned.
+ * @since  3.2.2 [2026-10-16-11:00pm] New.
+ */
+static inline void metricHistRecord(MetricHistogram* hist, int64_t us) {
+    uint32_t value = (us < 0) ? 0 : ((us > (int64_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)us);
+    uint8_t  index = (value < 2) ? 0 : (uint8_t)(31 - __builtin_clz(value));   // floor(log2(value)).
+    if (index >= METRIC_BUCKETS) {
+        index = METRIC_BUCKETS - 1;
+    }
+    hist->bucket[index]++;
+    hist->count++;
+    hist->sumUs += value;
+    if (value > hist->maxUs) {
+        hist->maxUs = value;
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Upper bound of a bucket.
+ * -------------------------------------------------------------------------
+ *
+ * @param  uint8_t  index Bucket.
+ * @return uint32_t       Largest value (us) in the bucket, UINT32_MAX for the last one.
+ * @since  3.2.2 [2026-10-16-11:00pm] New.
+ */
+static inline uint32_t metricHistBucketMax(uint8_t index) {
+    return (index >= METRIC_BUCKETS - 1) ? UINT32_MAX : ((uint32_t)2 << index) - 1;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Percentile, since boot or since a previous copy.
+ * -------------------------------------------------------------------------
+ *
+ * Resolution is one bucket: the result is the upper bound of the bucket holding the percentile,
+ * capped at maxUs.
+ *
+ * @param  const MetricHistogram* hist    Current copy.
+ * @param  const MetricHistogram* prev    Earlier copy of the same histogram (window = hist - prev), NULL = since boot.
+ * @param  uint8_t                percent 1 - 100.
+ * @return uint32_t               Latency (us), 0 = no samples.
+ * @since  3.2.2 [2026-10-16-11:00pm] New.
+ */
+static inline uint32_t metricHistPercentile(const MetricHistogram* hist, const MetricHistogram* prev, uint8_t percent) {
+    uint32_t count = hist->count - ((prev != NULL) ? prev->count : 0);
+    if (count == 0) {
+        return 0;
+    }
+    uint32_t target = (uint32_t)(((uint64_t)count * percent + 99) / 100);   // Rank, rounded up.
+    uint32_t seen   = 0;
+    for (uint8_t i = 0; i < METRIC_BUCKETS; i++) {
+        seen += hist->bucket[i] - ((prev != NULL) ? prev->bucket[i] : 0);
+        if (seen >= target) {
+            uint32_t bound = metricHistBucketMax(i);
+            return (bound < hist->maxUs) ? bound : hist->maxUs;
+        }
+    }
+    return hist->maxUs;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Writer: start update.
+ * -------------------------------------------------------------------------
+ *
+ * @param  MetricSeqlock* lock Snapshot lock.
+ * @return void           No output is returned.
+ * @since  3.2.2 [2026-10-16-11:00pm] New.
+ */
+static inline void metricWriteBegin(MetricSeqlock* lock) {
+    __atomic_store_n(&lock->seq, lock->seq + 1, __ATOMIC_RELAXED);         // Odd: write in progress.
+    __atomic_thread_fence(__ATOMIC_RELEASE);                                // Odd seq visible before any field changes.
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Writer: end update.
+ * -------------------------------------------------------------------------
+ *
+ * @param  MetricSeqlock* lock Snapshot lock.
+ * @return void           No output is returned.
+ * @since  3.2.2 [2026-10-16-11:00pm] New.
+ */
+static inline void metricWriteEnd(MetricSeqlock* lock) {
+    __atomic_store_n(&lock->seq, lock->seq + 1, __ATOMIC_RELEASE);         // Even: fields changed before this.
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Reader: consistent copy.
+ * -------------------------------------------------------------------------
+ *
+ * @param  const MetricSeqlock* lock     Snapshot lock.
+ * @param  const void*          snapshot Snapshot (written by the lock's writer).
+ * @param  void*                copy     Output, sizeof snapshot. Unchanged if false is returned.
+ * @param  size_t               size     sizeof snapshot.
+ * @param  void*                scratch  Work buffer, sizeof snapshot.
+ * @return bool                 true if copied, false if every try overlapped a write (copy is stale).
+ * @since  3.2.2 [2026-10-16-11:00pm] New.
+ * @since  3.2.2 [2026-10-17-12:30pm] METRIC_READ_YIELD() between tries.
+ */
+static inline bool metricRead(const MetricSeqlock* lock, const void* snapshot, void* copy, size_t size, void* scratch) {
+    for (uint8_t tries = 0; tries < METRIC_READ_TRIES; tries++) {
+        uint32_t seq = __atomic_load_n(&lock->seq, __ATOMIC_ACQUIRE);
+        if (seq & 1) {
+            METRIC_READ_YIELD();                                            // Write in progress.
+            continue;
+        }
+        memcpy(scratch, snapshot, size);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);                            // Copy done before seq is checked again.
+        if (__atomic_load_n(&lock->seq, __ATOMIC_RELAXED) == seq) {
+            memcpy(copy, scratch, size);
+            return true;
+        }
+        METRIC_READ_YIELD();                                                // Overlapped a write.
+    }
+    return false;
+}
+
+#endif
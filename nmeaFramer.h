@@ -0,0 +1,208 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - NMEA framer.
+ * *************************************************************************
+ *
+ * nmeaFramer.h
+ *
+ * Streaming, allocation-free NMEA 0183 framer used by DevUBLOXGNSS::processNMEA().
+ * Plain C++ (no Arduino or FreeRTOS calls) so the same code also builds on a host.
+ *
+ * NMEA sentence structure:
+ *   $<talker (2)><type (3)>,<fields>*<checksum (2 hex)><CR><LF>
+ *   Checksum = XOR of every byte between '$' and '*' (exclusive).
+ *
+ * Operation:
+ *   nmeaFramerPush() - Add one byte. Length & checksum are tracked incrementally (no strlen()/strncat() rescans).
+ *                      Returns NMEA_FRAME_OK when a complete, checksum-valid sentence is in framer.buf.
+ *   nmeaClassify()   - Table driven sentence type lookup. Add a type by adding a NMEA_TYPE_IDS[] row & NmeaType entry.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-16-11:00am] New. Replaces strncat()/strncmp() in DevUBLOXGNSS::processNMEA().
+ * @see    DevUBLOXGNSS::processNMEA() in DougFoster_Ghost_Rover.ino.
+ * @see    tests/host/test_nmeaFramer.cpp.
+ * @link   https://cdn.sparkfun.com/assets/a/3/2/f/a/NMEA_Reference_Manual-Rev2.1-Dec07.pdf.
+ * @link   http://dougfoster.me.
+ */
+
+#ifndef NMEA_FRAMER_H
+#define NMEA_FRAMER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * =========================================================================
+ *  Global vars.
+ * =========================================================================
+ */
+
+// --- Sentence. ---
+const uint16_t NMEA_MAX_LEN = 120;                        // Buffer size incl. '\0'. UBLOX_CFG_NMEA_HIGHPREC GGA is ~90 bytes.
+
+// --- Sentence types. ---
+enum NmeaType {                                           // Readable index for NMEA_TYPE_IDS[]. Order must match.
+    NMEA_TYPE_GGA,                                        // 0.
+    NMEA_TYPE_RMC,                                        // 1.
+    NMEA_TYPE_GSA,                                        // 2.
+    NMEA_TYPE_GSV,                                        // 3.
+    NMEA_TYPE_GST,                                        // 4.
+    NMEA_TYPE_TXT,                                        // 5.
+    NMEA_TYPE_GLL,                                        // 6.
+    NMEA_TYPE_VTG,                                        // 7.
+    NMEA_TYPE_ZDA,                                        // 8.
+    NMEA_TYPE_GNS,                                        // 9.
+    NMEA_TYPE_OTHER,                                      // 10 = anything not in NMEA_TYPE_IDS[].
+    NMEA_NUM_TYPES                                        // 11 = automatic array length.
+};
+const char NMEA_TYPE_IDS[NMEA_TYPE_OTHER][4] = {          // Sentence type strings; match NmeaType.
+    "GGA", "RMC", "GSA", "GSV", "GST", "TXT", "GLL", "VTG", "ZDA", "GNS"
+};
+
+// --- Framer. ---
+enum NmeaFrameStatus {                                    // nmeaFramerPush() result.
+    NMEA_FRAME_PENDING,                                   // Sentence not complete yet.
+    NMEA_FRAME_OK,                                        // Complete, checksum-valid sentence in buf.
+    NMEA_FRAME_BAD_CHECKSUM,                              // Complete sentence, checksum mismatch (or not hex).
+    NMEA_FRAME_OVERFLOW                                   // Sentence longer than NMEA_MAX_LEN, dropped.
+};
+enum NmeaFrameState {                                     // Internal parser state.
+    NMEA_STATE_HUNT,                                      // Waiting for '$'.
+    NMEA_STATE_BODY,                                      // Between '$' and '*'.
+    NMEA_STATE_CHECKSUM,                                  // 2 hex digits after '*'.
+    NMEA_STATE_END                                        // Waiting for [CR][LF].
+};
+struct NmeaFramer {                                       // Sentence buffer, parser state & stats.
+    char     buf[NMEA_MAX_LEN];                           // Sentence ($ ... [CR][LF]), '\0' terminated when complete.
+    uint16_t len;                                         // # of bytes in buf (no strlen() needed).
+    uint8_t  state;                                       // NmeaFrameState.
+    uint8_t  checksum;                                    // Running XOR.
+    uint8_t  checksumRx;                                  // Checksum received after '*'.
+    uint8_t  checksumDigits;                              // # of checksum digits received.
+    bool     checksumHex;                                 // false if a checksum digit wasn't hex.
+    uint8_t  type;                                        // NmeaType of the completed sentence.
+    uint32_t sentencesOk;                                 // # of checksum-valid sentences.
+    uint32_t checksumBad;                                 // # of sentences dropped for checksum.
+    uint32_t overflows;                                   // # of sentences dropped for length.
+    uint32_t restarts;                                    // # of sentences cut short by a new '$'.
+};
+
+/**
+ * =========================================================================
+ *  Functions.
+ * =========================================================================
+ *
+ * @see nmeaClassify()   - Return NmeaType of a sentence.
+ * @see nmeaFramerPush() - Add one byte to the framer.
+ */
+
+/**
+ * -------------------------------------------------------------------------
+ *  Return NmeaType of a sentence.
+ * -------------------------------------------------------------------------
+ *
+ * Compares the 3 type characters after "$<talker>" against NMEA_TYPE_IDS[].
+ * Proprietary sentences ($P...) are NMEA_TYPE_OTHER.
+ *
+ * @param  array    sentence NMEA sentence starting with '$'.
+ * @param  uint16_t len      Sentence length.
+ * @return uint8_t  NmeaType.
+ * @since  3.2.2 [2026-10-16-11:00am] New.
+ */
+static inline uint8_t nmeaClassify(const char* sentence, uint16_t len) {
+    if ((len < 6) || (sentence[1] == 'P')) {
+        return NMEA_TYPE_OTHER;
+    }
+    for (uint8_t i = 0; i < NMEA_TYPE_OTHER; i++) {
+        if ((sentence[3] == NMEA_TYPE_IDS[i][0]) && (sentence[4] == NMEA_TYPE_IDS[i][1]) && (sentence[5] == NMEA_TYPE_IDS[i][2])) {
+            return i;
+        }
+    }
+    return NMEA_TYPE_OTHER;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Add one byte to the framer.
+ * -------------------------------------------------------------------------
+ *
+ * O(1) per byte. A '$' always starts a new sentence. On NMEA_FRAME_OK, buf/len/type hold the sentence
+ * until the next byte is pushed.
+ *
+ * @param  NmeaFramer* framer   Framer.
+ * @param  char        incoming Byte from the ZED.
+ * @return NmeaFrameStatus
+ * @since  3.2.2 [2026-10-16-11:00am] New.
+ */
+static inline NmeaFrameStatus nmeaFramerPush(NmeaFramer* framer, char incoming) {
+
+    // --- Start of sentence. ---
+    if (incoming == '$') {
+        if (framer->state != NMEA_STATE_HUNT) {
+            framer->restarts++;
+        }
+        framer->buf[0]         = '$';
+        framer->len            = 1;
+        framer->checksum       = 0;
+        framer->checksumRx     = 0;
+        framer->checksumDigits = 0;
+        framer->checksumHex    = true;
+        framer->state          = NMEA_STATE_BODY;
+        return NMEA_FRAME_PENDING;
+    }
+    if (framer->state == NMEA_STATE_HUNT) {
+        return NMEA_FRAME_PENDING;                              // Between sentences.
+    }
+
+    // --- Length bound (keep room for '\0'). ---
+    if (framer->len >= NMEA_MAX_LEN - 1) {
+        framer->state = NMEA_STATE_HUNT;
+        framer->overflows++;
+        return NMEA_FRAME_OVERFLOW;
+    }
+    framer->buf[framer->len++] = incoming;
+
+    // --- Parse. ---
+    switch (framer->state) {
+        case NMEA_STATE_BODY:
+            if (incoming == '*') {
+                framer->state = NMEA_STATE_CHECKSUM;
+            } else {
+                framer->checksum ^= (uint8_t)incoming;
+            }
+            break;
+        case NMEA_STATE_CHECKSUM: {
+                uint8_t nibble = 0;
+                if ((incoming >= '0') && (incoming <= '9')) {
+                    nibble = incoming - '0';
+                } else if ((incoming >= 'A') && (incoming <= 'F')) {
+                    nibble = incoming - 'A' + 10;
+                } else if ((incoming >= 'a') && (incoming <= 'f')) {
+                    nibble = incoming - 'a' + 10;
+                } else {
+                    framer->checksumHex = false;
+                }
+                framer->checksumRx = (framer->checksumRx << 4) | nibble;
+                if (++framer->checksumDigits == 2) {
+                    framer->state = NMEA_STATE_END;
+                }
+            }
+            break;
+        case NMEA_STATE_END:
+            if (incoming == '\n') {                             // Sentence complete.
+                framer->buf[framer->len] = '\0';
+                framer->state = NMEA_STATE_HUNT;
+                if ((!framer->checksumHex) || (framer->checksum != framer->checksumRx)) {
+                    framer->checksumBad++;
+                    return NMEA_FRAME_BAD_CHECKSUM;
+                }
+                framer->type = nmeaClassify(framer->buf, framer->len);
+                framer->sentencesOk++;
+                return NMEA_FRAME_OK;
+            }
+            break;                                              // [CR].
+    }
+    return NMEA_FRAME_PENDING;
+}
+
+#endif
@@ -0,0 +1,364 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - NMEA rewriter.
+ * *************************************************************************
+ *
+ * nmeaRewrite.h
+ *
+ * Allocation-free rewrite of framed NMEA sentences (nmeaFramer.buf) before they go to GR-MCU2.
+ * Plain C++ (no Arduino or FreeRTOS calls) so the same code also builds on a host.
+ *
+ * Rewrites:
+ *   Instrument height: GGA & GNS altitude - instrument height, i.e. the ground point under the pole tip
+ *                      instead of the antenna. Geoid separation is a property of the position, so it only
+ *                      changes with a position lock.
+ *   Position lock:     GGA, RMC, GLL & GNS lat/lon (& GGA/GNS geoid separation) replaced by the values
+ *                      captured from a GGA with a fix (ghost mode).
+ *   Height lock:       GGA & GNS altitude replaced by the captured altitude (instrument height still applied).
+ *
+ * Field text is copied as received, so UBLOX_CFG_NMEA_HIGHPREC precision (7 decimal lat/lon) is kept.
+ * Altitude math is fixed point in the received # of decimals (no float rounding).
+ *
+ * Cost: one pass over the sentence into a stack buffer plus one copy back, i.e. O(NMEA_MAX_LEN)
+ * per sentence whatever the type. Sentence types with nothing to change return after one table lookup.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-16-11:30pm] New.
+ * @see    DevUBLOXGNSS::processNMEA(), processJsonActivity() in DougFoster_Ghost_Rover.ino, nmeaFramer.h.
+ * @see    tests/host/test_nmeaRewrite.cpp.
+ * @link   https://cdn.sparkfun.com/assets/a/3/2/f/a/NMEA_Reference_Manual-Rev2.1-Dec07.pdf.
+ * @link   http://dougfoster.me.
+ */
+
+#ifndef NMEA_REWRITE_H
+#define NMEA_REWRITE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "nmeaFramer.h"                                   // NMEA_MAX_LEN, NmeaType.
+
+/**
+ * =========================================================================
+ *  Global vars.
+ * =========================================================================
+ */
+
+// --- Fields. ---
+const uint8_t NMEA_FIELD_LEN      = 16;                   // Stored field text incl. '\0'. HIGHPREC lon "dddmm.mmmmmmm" is 13.
+const uint8_t NMEA_REWRITE_FIELDS = 12;                   // Field #s the rewriter can replace (0 = address ... 11).
+
+struct NmeaLayout {                                       // Field #s per sentence type, 0 = not in this sentence.
+    uint8_t lat;                                          // Latitude. N/S, longitude & E/W follow.
+    uint8_t alt;                                          // Altitude above mean sea level.
+    uint8_t geoid;                                        // Geoid separation.
+};
+const NmeaLayout NMEA_LAYOUT[NMEA_NUM_TYPES] = {          // Indexed by NmeaType.
+    {2, 9, 11},                                           // GGA.
+    {3, 0,  0},                                           // RMC.
+    {0, 0,  0},                                           // GSA.
+    {0, 0,  0},                                           // GSV.
+    {0, 0,  0},                                           // GST.
+    {0, 0,  0},                                           // TXT.
+    {1, 0,  0},                                           // GLL.
+    {0, 0,  0},                                           // VTG.
+    {0, 0,  0},                                           // ZDA.
+    {2, 9, 10},                                           // GNS.
+    {0, 0,  0}                                            // OTHER.
+};
+
+// --- Locks. ---
+enum NmeaLock {                                           // NmeaRewriter lock bits.
+    NMEA_LOCK_POSITION = 0x01,                            // Lat/lon & geoid separation.
+    NMEA_LOCK_HEIGHT   = 0x02                             // Altitude.
+};
+
+// --- Rewriter. ---
+struct NmeaField {                                        // Field text as received.
+    char    text[NMEA_FIELD_LEN];
+    uint8_t len;
+};
+struct NmeaRewriter {                                     // Lock state & stats.
+    uint8_t   lockPending;                                // NmeaLock bits to capture from the next GGA with a fix.
+    uint8_t   locked;                                     // NmeaLock bits captured.
+    NmeaField lat;                                        // Captured fields.
+    NmeaField ns;
+    NmeaField lon;
+    NmeaField ew;
+    NmeaField alt;                                        // Antenna altitude (instrument height not applied).
+    NmeaField geoid;
+    uint32_t  rewritten;                                  // # of sentences changed.
+    uint32_t  skipped;                                    // # of sentences left as is (short, too long, or altitude not a number).
+};
+
+/**
+ * =========================================================================
+ *  Functions.
+ * =========================================================================
+ *
+ * @see nmeaFieldFind()     - Locate a field.
+ * @see nmeaAltitudeShift() - Altitude text - instrument height.
+ * @see nmeaLockCapture()   - Capture pending locks from a GGA.
+ * @see nmeaRewrite()       - Rewrite a sentence in place.
+ */
+
+/**
+ * -------------------------------------------------------------------------
+ *  Locate a field.
+ * -------------------------------------------------------------------------
+ *
+ * @param  array    sentence NMEA sentence starting with '$'.
+ * @param  uint16_t len      Sentence length.
+ * @param  uint8_t  field    Field # (0 = address).
+ * @param  uint16_t* start   Output: offset of the first character.
+ * @return int16_t  Field length, -1 if the sentence has fewer fields.
+ * @since  3.2.2 [2026-10-16-11:30pm] New.
+ */
+static inline int16_t nmeaFieldFind(const char* sentence, uint16_t len, uint8_t field, uint16_t* start) {
+    uint16_t i = 1;
+    for (uint8_t n = 0; n < field; i++) {
+        if ((i >= len) || (sentence[i] == '*')) {
+            return -1;
+        }
+        if (sentence[i] == ',') {
+            n++;
+        }
+    }
+    *start = i;
+    while ((i < len) && (sentence[i] != ',') && (sentence[i] != '*')) {
+        i++;
+    }
+    return (int16_t)(i - *start);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Altitude text - instrument height.
+ * -------------------------------------------------------------------------
+ *
+ * Keeps the received # of decimals, e.g. "123.4567" - 128 mm = "123.3287", "12.3" - 128 mm = "12.2".
+ *
+ * @param  array      text  Altitude (m), e.g. "-12.345".
+ * @param  uint8_t    len   Text length.
+ * @param  int32_t    mm    Instrument height (mm).
+ * @param  NmeaField* out   Output.
+ * @return bool       false if text is empty or not a number (out unchanged).
+ * @since  3.2.2 [2026-10-16-11:30pm] New.
+ */
+static inline bool nmeaAltitudeShift(const char* text, uint8_t len, int32_t mm, NmeaField* out) {
+
+    // --- Parse to fixed point (10^-decimals m). ---
+    bool     negative = (len > 0) && (text[0] == '-');
+    int64_t  value    = 0;
+    int8_t   decimals = -1;                                     // -1 = no '.' yet.
+    uint8_t  digits   = 0;
+    for (uint8_t i = negative ? 1 : 0; i < len; i++) {
+        if ((text[i] == '.') && (decimals < 0)) {
+            decimals = 0;
+        } else if ((text[i] >= '0') && (text[i] <= '9') && (digits < 15)) {
+            value = value * 10 + (text[i] - '0');
+            digits++;
+            if (decimals >= 0) {
+                decimals++;
+            }
+        } else {
+            return false;
+        }
+    }
+    if ((digits == 0) || (decimals > 9)) {
+        return false;
+    }
+    uint8_t places = (decimals < 0) ? 0 : (uint8_t)decimals;
+
+    // --- Subtract, in the same units (rounded half away from 0 when places < 3). ---
+    int64_t scale = 1;
+    for (uint8_t i = 0; i < places; i++) {
+        scale *= 10;
+    }
+    int64_t offset = ((int64_t)mm * scale * 2 + ((mm < 0) ? -1000 : 1000)) / 2000;
+    value = (negative ? -value : value) - offset;
+
+    // --- Format, right to left. ---
+    char     tmp[NMEA_FIELD_LEN];
+    uint8_t  n         = 0;
+    uint8_t  i         = 0;
+    uint64_t magnitude = (value < 0) ? (uint64_t)(-value) : (uint64_t)value;
+    do {
+        if (n >= sizeof(tmp) - 3) {
+            return false;                                       // Too long for a field (room for '.', '-' & '\0').
+        }
+        if ((i == places) && (places > 0)) {
+            tmp[n++] = '.';
+        }
+        tmp[n++]   = (char)('0' + (magnitude % 10));
+        magnitude /= 10;
+        i++;
+    } while ((i <= places) || (magnitude > 0));
+    if (value < 0) {
+        tmp[n++] = '-';
+    }
+    for (uint8_t i = 0; i < n; i++) {
+        out->text[i] = tmp[n - 1 - i];
+    }
+    out->text[n] = '\0';
+    out->len     = n;
+    return true;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Capture pending locks from a GGA.
+ * -------------------------------------------------------------------------
+ *
+ * Waits for a GGA with a fix (quality field not empty or '0'). Call with the received (not rewritten) sentence.
+ *
+ * @param  NmeaRewriter* rw       Rewriter.
+ * @param  array         sentence GGA sentence.
+ * @param  uint16_t      len      Sentence length.
+ * @return bool          true if a lock was captured.
+ * @since  3.2.2 [2026-10-16-11:30pm] New.
+ */
+static inline bool nmeaLockCapture(NmeaRewriter* rw, const char* sentence, uint16_t len) {
+
+    // --- Fields. ---
+    NmeaField* const FIELDS[6] = {&rw->lat, &rw->ns, &rw->lon, &rw->ew, &rw->alt, &rw->geoid};
+    const uint8_t    NUMBER[6] = {2, 3, 4, 5, 9, 11};
+    NmeaField        capture[6];
+    uint16_t         start;
+    int16_t          fieldLen  = nmeaFieldFind(sentence, len, 6, &start);  // Fix quality.
+    if ((fieldLen <= 0) || (sentence[start] == '0')) {
+        return false;                                           // No fix yet, stay pending.
+    }
+    for (uint8_t i = 0; i < 6; i++) {
+        fieldLen = nmeaFieldFind(sentence, len, NUMBER[i], &start);
+        if ((fieldLen <= 0) || (fieldLen >= NMEA_FIELD_LEN)) {
+            return false;
+        }
+        memcpy(capture[i].text, &sentence[start], fieldLen);
+        capture[i].text[fieldLen] = '\0';
+        capture[i].len            = (uint8_t)fieldLen;
+    }
+
+    // --- Keep what was asked for. ---
+    for (uint8_t i = 0; i < 6; i++) {
+        bool height = (i == 4);
+        if (rw->lockPending & (height ? NMEA_LOCK_HEIGHT : NMEA_LOCK_POSITION)) {
+            *FIELDS[i] = capture[i];
+        }
+    }
+    rw->locked      |= rw->lockPending;
+    rw->lockPending  = 0;
+    return true;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Rewrite a sentence in place.
+ * -------------------------------------------------------------------------
+ *
+ * Builds the new sentence in a stack buffer (one pass, checksum on the fly), then copies it over buf.
+ * The sentence is left as is if a field it needs is missing or the result wouldn't fit NMEA_MAX_LEN.
+ * An empty altitude (no fix) stays empty unless the height is locked.
+ *
+ * @param  NmeaRewriter* rw       Rewriter.
+ * @param  array         buf      Sentence ($ ... *hh[CR][LF]\0), NMEA_MAX_LEN bytes.
+ * @param  uint16_t      len      Sentence length.
+ * @param  uint8_t       type     NmeaType.
+ * @param  int32_t       heightMm Instrument height (mm), 0 = none.
+ * @return uint16_t      New sentence length (len if unchanged).
+ * @since  3.2.2 [2026-10-16-11:30pm] New.
+ */
+static inline uint16_t nmeaRewrite(NmeaRewriter* rw, char* buf, uint16_t len, uint8_t type, int32_t heightMm) {
+
+    // --- Anything to do? ---
+    const NmeaLayout* layout   = &NMEA_LAYOUT[(type < NMEA_NUM_TYPES) ? type : (uint8_t)NMEA_TYPE_OTHER];
+    bool              position = (layout->lat != 0) && (rw->locked & NMEA_LOCK_POSITION);
+    bool              height   = (layout->alt != 0) && ((heightMm != 0) || (rw->locked & NMEA_LOCK_HEIGHT));
+    if ((!position) && (!height)) {
+        return len;
+    }
+
+    // --- Replacement fields. ---
+    const NmeaField* replace[NMEA_REWRITE_FIELDS] = {NULL};
+    uint8_t          lastField = 0;
+    NmeaField        altitude;
+    if (position) {
+        replace[layout->lat]     = &rw->lat;
+        replace[layout->lat + 1] = &rw->ns;
+        replace[layout->lat + 2] = &rw->lon;
+        replace[layout->lat + 3] = &rw->ew;
+        lastField = layout->lat + 3;
+        if (layout->geoid != 0) {
+            replace[layout->geoid] = &rw->geoid;
+            lastField = layout->geoid;
+        }
+    }
+    if (height) {
+        const char* text    = rw->alt.text;
+        int16_t     textLen = rw->alt.len;
+        uint16_t    start   = 0;
+        if (!(rw->locked & NMEA_LOCK_HEIGHT)) {
+            textLen = nmeaFieldFind(buf, len, layout->alt, &start);
+            text    = &buf[start];
+        }
+        if ((textLen > 0) && (textLen < NMEA_FIELD_LEN) && nmeaAltitudeShift(text, (uint8_t)textLen, heightMm, &altitude)) {
+            replace[layout->alt] = &altitude;
+            lastField = (layout->alt > lastField) ? layout->alt : lastField;
+        } else if (textLen != 0) {
+            rw->skipped++;                                      // Missing field or not a number.
+            return len;
+        }
+    }
+    if (lastField == 0) {
+        return len;                                             // Empty altitude, no lock.
+    }
+
+    // --- Build. ---
+    char     out[NMEA_MAX_LEN];
+    uint16_t in       = 1;
+    uint16_t n        = 1;
+    uint8_t  field    = 0;
+    uint8_t  checksum = 0;
+    out[0] = '$';
+    while ((in < len) && (buf[in] != '*')) {
+        if (n >= NMEA_MAX_LEN - 6) {                            // Room for "*hh[CR][LF]\0".
+            rw->skipped++;
+            return len;
+        }
+        char c = buf[in++];
+        out[n++]  = c;
+        checksum ^= (uint8_t)c;
+        if ((c != ',') || (++field >= NMEA_REWRITE_FIELDS) || (replace[field] == NULL)) {
+            continue;
+        }
+        if (n + replace[field]->len >= NMEA_MAX_LEN - 6) {
+            rw->skipped++;
+            return len;
+        }
+        for (uint8_t i = 0; i < replace[field]->len; i++) {
+            out[n++]  = replace[field]->text[i];
+            checksum ^= (uint8_t)replace[field]->text[i];
+        }
+        while ((in < len) && (buf[in] != ',') && (buf[in] != '*')) {
+            in++;                                               // Skip the received field.
+        }
+    }
+    if ((in >= len) || (field < lastField)) {
+        rw->skipped++;                                          // No '*' or too few fields.
+        return len;
+    }
+
+    // --- Checksum & terminator. ---
+    const char HEX_DIGITS[] = "0123456789ABCDEF";
+    out[n++] = '*';
+    out[n++] = HEX_DIGITS[checksum >> 4];
+    out[n++] = HEX_DIGITS[checksum & 0x0F];
+    out[n++] = '\r';
+    out[n++] = '\n';
+    out[n]   = '\0';
+    memcpy(buf, out, n + 1);
+    rw->rewritten++;
+    return n;
+}
+
+#endif
@@ -0,0 +1,340 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - NTRIP client protocol.
+ * *************************************************************************
+ *
+ * ntripClient.h
+ *
+ * NTRIP v1/v2 request builder & response parser used by taskNtripClient().
+ * Plain C++ (no Arduino or FreeRTOS calls) so the same code also builds on a host,
+ * e.g. against a local stand-in caster serving a recorded RTCM file.
+ *
+ * NTRIP responses:
+ *   v1: "ICY 200 OK"[CR][LF], then raw RTCM.
+ *   v2: "HTTP/1.1 200 OK"[CR][LF], headers, [CR][LF], then RTCM (usually "Transfer-Encoding: chunked").
+ *   "SOURCETABLE 200 OK" = mount point not found, "HTTP/1.x 401" = bad user/password.
+ *
+ * Operation:
+ *   ntripBuildRequest() - GET request for the mount point, Basic authorization, v2 headers.
+ *   ntripReceive()      - Feed every received chunk. Strips the response header & chunked encoding in place,
+ *                         returns the # of RTCM bytes left at the front of the chunk.
+ *   ntripBackoffMs()    - Reconnect delay: doubles per failed attempt, capped at NTRIP_BACKOFF_MAX_MS.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-16-06:00pm] New.
+ * @see    taskNtripClient() in DougFoster_Ghost_Rover.ino.
+ * @see    tests/host/test_ntripClient.cpp (stand-in caster).
+ * @link   https://www.use-snip.com/kb/knowledge-base/ntrip-rev1-versus-rev2-formats/.
+ * @link   https://gssc.esa.int/wp-content/uploads/2018/07/NtripDocumentation.pdf.
+ * @link   http://dougfoster.me.
+ */
+
+#ifndef NTRIP_CLIENT_H
+#define NTRIP_CLIENT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+/**
+ * =========================================================================
+ *  Global vars.
+ * =========================================================================
+ */
+
+// --- Request. ---
+const char     NTRIP_USER_AGENT[]     = "NTRIP GhostRover/3.2";
+const uint16_t NTRIP_REQUEST_MAX      = 512;              // Request buffer size (mount + host + Base64 credentials fit easily).
+
+// --- Response. ---
+const uint16_t NTRIP_HEADER_MAX       = 512;              // Response header buffer. Longer headers fail the session.
+
+// --- Reconnect. ---
+const uint32_t NTRIP_BACKOFF_MIN_MS   = 1000;             // First retry.
+const uint32_t NTRIP_BACKOFF_MAX_MS   = 60000;            // Cap.
+
+// --- Session. ---
+enum NtripState {                                         // Session state.
+    NTRIP_STATE_HEADER,                                   // Waiting for the complete response header.
+    NTRIP_STATE_STREAMING,                                // Caster accepted, RTCM flowing.
+    NTRIP_STATE_FAILED                                    // Caster refused (status holds the reason).
+};
+enum NtripChunkState {                                    // v2 chunked transfer decoder state.
+    NTRIP_CHUNK_SIZE,                                     // Hex chunk size (& optional extension) up to [CR][LF].
+    NTRIP_CHUNK_DATA,                                     // Chunk payload.
+    NTRIP_CHUNK_DATA_END,                                 // [CR][LF] after the payload.
+    NTRIP_CHUNK_DONE                                      // Zero length chunk: caster ended the stream.
+};
+struct NtripSession {                                     // Parser state for one connection.
+    uint8_t  state;                                       // NtripState.
+    uint16_t status;                                      // 200 = OK, HTTP status, or 0 = unknown/source table.
+    bool     chunked;                                     // v2 "Transfer-Encoding: chunked".
+    uint8_t  chunkState;                                  // NtripChunkState.
+    bool     chunkSizeDone;                               // Hex digits ended (extension or [CR] seen).
+    uint32_t chunkLeft;                                   // Chunk bytes still to come (NTRIP_CHUNK_DATA) or size being parsed.
+    uint16_t headerLen;                                   // # of bytes in header.
+    char     header[NTRIP_HEADER_MAX];                    // Response header, '\0' terminated.
+};
+
+/**
+ * =========================================================================
+ *  Functions.
+ * =========================================================================
+ *
+ * @see ntripBase64()       - Base64 encode (Basic authorization).
+ * @see ntripBuildRequest() - Build the GET request for a mount point.
+ * @see ntripSessionReset() - Start a new response.
+ * @see ntripReceive()      - Parse received bytes, return RTCM bytes.
+ * @see ntripBackoffMs()    - Reconnect delay.
+ */
+
+/**
+ * -------------------------------------------------------------------------
+ *  Base64 encode (Basic authorization).
+ * -------------------------------------------------------------------------
+ *
+ * @param  array  in     Text to encode.
+ * @param  array  out    Output, '\0' terminated.
+ * @param  size_t outLen Output buffer size.
+ * @return size_t        Encoded length, 0 if out is too small.
+ * @since  3.2.2 [2026-10-16-06:00pm] New.
+ */
+static inline size_t ntripBase64(const char* in, char* out, size_t outLen) {
+    static const char TABLE[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    size_t inLen = strlen(in);
+    size_t need  = ((inLen + 2) / 3) * 4;
+    if (need + 1 > outLen) {
+        return 0;
+    }
+    size_t o = 0;
+    for (size_t i = 0; i < inLen; i += 3) {
+        uint32_t v = (uint32_t)(uint8_t)in[i] << 16;
+        if (i + 1 < inLen) v |= (uint32_t)(uint8_t)in[i + 1] << 8;
+        if (i + 2 < inLen) v |= (uint32_t)(uint8_t)in[i + 2];
+        out[o++] = TABLE[(v >> 18) & 0x3F];
+        out[o++] = TABLE[(v >> 12) & 0x3F];
+        out[o++] = (i + 1 < inLen) ? TABLE[(v >> 6) & 0x3F] : '=';
+        out[o++] = (i + 2 < inLen) ? TABLE[v & 0x3F] : '=';
+    }
+    out[o] = '\0';
+    return o;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Build the GET request for a mount point.
+ * -------------------------------------------------------------------------
+ *
+ * GGA is not put in the request (v2 "Ntrip-GGA" header); taskNtripClient() sends it in the stream
+ * after the caster answers, which v1 & v2 casters both accept.
+ *
+ * @param  array    out     Output, NTRIP_REQUEST_MAX bytes.
+ * @param  size_t   outLen  Output buffer size.
+ * @param  array    host    Caster host name.
+ * @param  uint16_t port    Caster port.
+ * @param  array    mount   Mount point (no leading '/').
+ * @param  array    user    User name ("" = no authorization).
+ * @param  array    pass    Password.
+ * @param  uint8_t  version 1 or 2.
+ * @return size_t           Request length, 0 if it doesn't fit.
+ * @since  3.2.2 [2026-10-16-06:00pm] New.
+ */
+static inline size_t ntripBuildRequest(char* out, size_t outLen, const char* host, uint16_t port, const char* mount,
+                                       const char* user, const char* pass, uint8_t version) {
+
+    // --- Credentials. ---
+    char credentials[100];
+    char auth[140] = {'\0'};
+    if (user[0] != '\0') {
+        snprintf(credentials, sizeof(credentials), "%s:%s", user, pass);
+        if (ntripBase64(credentials, auth, sizeof(auth)) == 0) {
+            return 0;
+        }
+    }
+
+    // --- Request. ---
+    int len;
+    if (version == 2) {
+        len = snprintf(out, outLen,
+            "GET /%s HTTP/1.1\r\n"
+            "Host: %s:%u\r\n"
+            "Ntrip-Version: Ntrip/2.0\r\n"
+            "User-Agent: %s\r\n"
+            "%s%s%s"
+            "Connection: close\r\n"
+            "\r\n",
+            mount, host, (unsigned)port, NTRIP_USER_AGENT,
+            (auth[0] != '\0') ? "Authorization: Basic " : "", auth, (auth[0] != '\0') ? "\r\n" : "");
+    } else {
+        len = snprintf(out, outLen,
+            "GET /%s HTTP/1.0\r\n"
+            "User-Agent: %s\r\n"
+            "%s%s%s"
+            "\r\n",
+            mount, NTRIP_USER_AGENT,
+            (auth[0] != '\0') ? "Authorization: Basic " : "", auth, (auth[0] != '\0') ? "\r\n" : "");
+    }
+    if ((len <= 0) || ((size_t)len >= outLen)) {
+        return 0;
+    }
+    return (size_t)len;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Start a new response.
+ * -------------------------------------------------------------------------
+ *
+ * @param  NtripSession* session Session.
+ * @return void          No output is returned.
+ * @since  3.2.2 [2026-10-16-06:00pm] New.
+ */
+static inline void ntripSessionReset(NtripSession* session) {
+    memset(session, 0, sizeof(NtripSession));
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Parse the complete response header.
+ * -------------------------------------------------------------------------
+ *
+ * @param  NtripSession* session Session (header holds the status line & headers).
+ * @return void          No output is returned. Sets state, status & chunked.
+ * @since  3.2.2 [2026-10-16-06:00pm] New.
+ */
+static inline void ntripParseHeader(NtripSession* session) {
+    const char* h = session->header;
+    if (strncmp(h, "ICY 200", 7) == 0) {                        // v1 OK.
+        session->status = 200;
+    } else if ((strncmp(h, "HTTP/1.", 7) == 0) && (h[8] == ' ')) { // v2 (or v1 caster answering in HTTP).
+        session->status = (uint16_t)((h[9] - '0') * 100 + (h[10] - '0') * 10 + (h[11] - '0'));
+    } else {                                                    // "SOURCETABLE 200 OK" or garbage.
+        session->status = 0;
+    }
+    for (const char* p = h; *p != '\0'; p++) {                  // Case insensitive "transfer-encoding: chunked".
+        if (((*p == 'T') || (*p == 't')) && (strncasecmp(p, "transfer-encoding:", 18) == 0)) {
+            const char* v = p + 18;
+            while (*v == ' ') {
+                v++;
+            }
+            session->chunked = (strncasecmp(v, "chunked", 7) == 0);
+        }
+    }
+    session->state      = (session->status == 200) ? NTRIP_STATE_STREAMING : NTRIP_STATE_FAILED;
+    session->chunkState = NTRIP_CHUNK_SIZE;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Parse received bytes, return RTCM bytes.
+ * -------------------------------------------------------------------------
+ *
+ * Works in place: header bytes & chunk framing are removed, RTCM bytes are moved to the front of data.
+ * v1 header ends at the first [CR][LF] ("ICY 200 OK"), v2 at the first blank line.
+ * Any stray bytes that slip through (e.g. an extra [CR][LF] after "ICY 200 OK") are dropped by the RTCM3 framer.
+ *
+ * @param  NtripSession* session Session.
+ * @param  array         data    Received bytes. Overwritten with RTCM bytes.
+ * @param  size_t        len     # of received bytes.
+ * @return size_t        # of RTCM bytes at the front of data.
+ * @since  3.2.2 [2026-10-16-06:00pm] New.
+ */
+static inline size_t ntripReceive(NtripSession* session, uint8_t* data, size_t len) {
+    size_t in  = 0;
+    size_t out = 0;
+
+    // --- Header. ---
+    while ((session->state == NTRIP_STATE_HEADER) && (in < len)) {
+        if (session->headerLen >= NTRIP_HEADER_MAX - 1) {
+            session->state = NTRIP_STATE_FAILED;                // Header too long, not a caster.
+            return 0;
+        }
+        session->header[session->headerLen++] = (char)data[in++];
+        session->header[session->headerLen]   = '\0';
+        bool icyDone  = (session->headerLen >= 2) && (strncmp(session->header, "ICY", 3) == 0) &&
+                        (session->header[session->headerLen - 1] == '\n');
+        bool httpDone = (session->headerLen >= 4) && (strcmp(&session->header[session->headerLen - 4], "\r\n\r\n") == 0);
+        bool srcDone  = (session->headerLen >= 11) && (strncmp(session->header, "SOURCETABLE", 11) == 0);
+        if (icyDone || httpDone || srcDone) {
+            ntripParseHeader(session);
+        }
+    }
+    if (session->state != NTRIP_STATE_STREAMING) {
+        return 0;
+    }
+
+    // --- Body, not chunked. ---
+    if (!session->chunked) {
+        memmove(data, data + in, len - in);
+        return len - in;
+    }
+
+    // --- Body, chunked. ---
+    while (in < len) {
+        uint8_t c = data[in];
+        switch (session->chunkState) {
+            case NTRIP_CHUNK_SIZE:
+                in++;
+                if (c == '\n') {
+                    session->chunkState    = (session->chunkLeft == 0) ? NTRIP_CHUNK_DONE : NTRIP_CHUNK_DATA;
+                    session->chunkSizeDone = false;
+                } else if (!session->chunkSizeDone) {
+                    int8_t digit = ((c >= '0') && (c <= '9')) ? (int8_t)(c - '0') :
+                                   ((c >= 'a') && (c <= 'f')) ? (int8_t)(c - 'a' + 10) :
+                                   ((c >= 'A') && (c <= 'F')) ? (int8_t)(c - 'A' + 10) : -1;
+                    if (digit >= 0) {
+                        session->chunkLeft = (session->chunkLeft << 4) | (uint32_t)digit;
+                    } else {
+                        session->chunkSizeDone = true;          // [CR] or ";extension".
+                    }
+                }
+                break;
+            case NTRIP_CHUNK_DATA: {
+                size_t n = len - in;
+                if (n > session->chunkLeft) {
+                    n = session->chunkLeft;
+                }
+                memmove(data + out, data + in, n);
+                out                += n;
+                in                 += n;
+                session->chunkLeft -= (uint32_t)n;
+                if (session->chunkLeft == 0) {
+                    session->chunkState = NTRIP_CHUNK_DATA_END;
+                }
+                break;
+            }
+            case NTRIP_CHUNK_DATA_END:
+                in++;
+                if (c == '\n') {
+                    session->chunkState = NTRIP_CHUNK_SIZE;
+                }
+                break;
+            case NTRIP_CHUNK_DONE:
+            default:
+                in = len;                                       // Stream ended, ignore the rest.
+                break;
+        }
+    }
+    return out;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Reconnect delay.
+ * -------------------------------------------------------------------------
+ *
+ * @param  uint32_t failures # of consecutive failed attempts (0 = first retry).
+ * @return uint32_t          Delay (ms): NTRIP_BACKOFF_MIN_MS doubling, capped at NTRIP_BACKOFF_MAX_MS.
+ * @since  3.2.2 [2026-10-16-06:00pm] New.
+ */
+static inline uint32_t ntripBackoffMs(uint32_t failures) {
+    uint32_t delayMs = NTRIP_BACKOFF_MIN_MS;
+    while ((failures-- > 0) && (delayMs < NTRIP_BACKOFF_MAX_MS)) {
+        delayMs *= 2;
+    }
+    return (delayMs > NTRIP_BACKOFF_MAX_MS) ? NTRIP_BACKOFF_MAX_MS : delayMs;
+}
+
+#endif
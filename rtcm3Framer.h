@@ -0,0 +1,382 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - RTCM3 framer.
+ * *************************************************************************
+ *
+ * rtcm3Framer.h
+ *
+ * Length-framed, CRC-24Q checked RTCM3 parser used by taskRtcmRelay().
+ * Plain C++ (no Arduino or FreeRTOS calls) so the same code also builds on a host.
+ *
+ * RTCM3 frame structure:
+ *   Byte 0:       Preamble (0xD3).
+ *   Byte 1-2:     Reserved (6 bits, always 0) + message length (10 bits, 0-1023).
+ *   Byte 3-N:     Message (N = 2 + message length). Message type is the first 12 bits.
+ *   Byte N+1-N+3: CRC-24Q over bytes 0-N.
+ *
+ * Operation:
+ *   rtcm3FramerPush()      - Copy a bulk chunk of received bytes into the ring buffer.
+ *   rtcm3FramerNext()      - Pull the next CRC-valid frame out of the ring buffer.
+ *                            A 0xD3 inside a payload can't start a frame: a candidate is only accepted
+ *                            when its length field & CRC agree, otherwise one byte is dropped & the hunt resumes.
+ *                            A candidate still waiting for bytes is dropped as soon as a complete CRC-valid
+ *                            frame is found behind it (false preamble after corruption), so a bogus length
+ *                            field can't hold good frames back for up to RTCM3_MAX_FRAME bytes.
+ *   rtcm3TypeStatsRecord() - Per message type count, size & inter-arrival time.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-16-09:00am] New. Replaces the 0xD3 byte trigger in taskRtcmRelay().
+ * @since  3.2.2 [2026-10-17-09:00am] Lookahead drops an incomplete false candidate (framesFalseStart).
+ * @see    tests/host/test_rtcm3Framer.cpp.
+ * @see    taskRtcmRelay() in DougFoster_Ghost_Rover.ino.
+ * @link   https://www.use-snip.com/kb/knowledge-base/an-rtcm-message-cheat-sheet/.
+ * @link   https://portal.u-blox.com/s/question/0D52p0000C7MwDfCQK/can-you-find-out-the-message-type-of-a-given-rtcm3-message.
+ * @link   http://dougfoster.me.
+ */
+
+#ifndef RTCM3_FRAMER_H
+#define RTCM3_FRAMER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * =========================================================================
+ *  Global vars.
+ * =========================================================================
+ */
+
+// --- Frame. ---
+const uint8_t  RTCM3_PREAMBLE     = 0xD3;                 // First byte of every frame.
+const uint16_t RTCM3_HEADER_LEN   = 3;                    // Preamble + reserved/length.
+const uint16_t RTCM3_CRC_LEN      = 3;                    // CRC-24Q.
+const uint16_t RTCM3_MAX_PAYLOAD  = 1023;                 // 10 bit length field.
+const uint16_t RTCM3_MAX_FRAME    = RTCM3_HEADER_LEN + RTCM3_MAX_PAYLOAD + RTCM3_CRC_LEN;   // 1029.
+
+// --- Ring buffer. ---
+const uint32_t RTCM3_RING_SIZE    = 4096;                 // Must be a power of 2 & hold (at least) one max frame.
+const uint32_t RTCM3_RING_MASK    = RTCM3_RING_SIZE - 1;
+
+// --- Stats. ---
+const uint8_t  RTCM3_MAX_TYPES    = 24;                   // # of message types tracked (a base sends ~6-10).
+
+struct Rtcm3TypeStats {                                   // Stats for one RTCM3 message type.
+    uint16_t type;                                        // Message type (e.g. 1005, 1074, 1230).
+    uint16_t lastLen;                                     // Last frame length (bytes, includes header & CRC).
+    uint32_t count;                                       // # of CRC-valid frames.
+    uint32_t bytes;                                       // Total bytes of CRC-valid frames.
+    uint32_t intervalMs;                                  // Last inter-arrival time (ms).
+    int64_t  lastUs;                                      // Arrival time (us) of last frame.
+};
+
+struct Rtcm3Framer {                                      // Ring buffer, parser state & stats.
+    uint8_t        ring[RTCM3_RING_SIZE];                 // Received bytes waiting to be framed.
+    uint32_t       head;                                  // Write index (free running, masked on access).
+    uint32_t       tail;                                  // Read index (free running, masked on access).
+    uint32_t       bytesIn;                               // Total bytes pushed.
+    uint32_t       bytesDiscarded;                        // Bytes skipped while hunting for a valid frame.
+    uint32_t       bytesOverflow;                         // Bytes dropped because the ring was full.
+    uint32_t       framesOk;                              // # of CRC-valid frames.
+    uint32_t       framesCrcBad;                          // # of candidate frames that failed CRC.
+    uint32_t       framesFalseStart;                      // # of incomplete candidates dropped, valid frame found behind.
+    uint32_t       scanTail;                              // Candidate (tail) the lookahead is for.
+    uint32_t       scanAt;                                // Lookahead resume index (first position not yet decided).
+    uint8_t        numTypes;                              // # of used entries in types[].
+    Rtcm3TypeStats types[RTCM3_MAX_TYPES];                // Per message type stats.
+};
+
+/**
+ * =========================================================================
+ *  Functions.
+ * =========================================================================
+ *
+ * @see rtcm3Crc24q()          - CRC-24Q.
+ * @see rtcm3MessageType()     - Return RTCM3 message type.
+ * @see rtcm3FramerReset()     - Clear ring buffer & stats.
+ * @see rtcm3FramerPush()      - Copy received bytes into the ring buffer.
+ * @see rtcm3FramerLookahead() - Look for a complete frame behind an incomplete candidate.
+ * @see rtcm3FramerNext()      - Pull the next CRC-valid frame.
+ * @see rtcm3TypeStatsRecord() - Update per message type stats.
+ */
+
+/**
+ * -------------------------------------------------------------------------
+ *  CRC-24Q.
+ * -------------------------------------------------------------------------
+ *
+ * Table driven, polynomial 0x1864CFB, initial value 0.
+ *
+ * @param  array  data Bytes to check.
+ * @param  size_t len  # of bytes.
+ * @return uint32_t    24 bit CRC.
+ * @since  3.2.2 [2026-10-16-09:00am] New.
+ */
+static inline uint32_t rtcm3Crc24q(const uint8_t* data, size_t len) {
+    static const uint32_t CRC24Q_TABLE[256] = {
+    0x000000, 0x864CFB, 0x8AD50D, 0x0C99F6, 0x93E6E1, 0x15AA1A, 0x1933EC, 0x9F7F17,
+    0xA18139, 0x27CDC2, 0x2B5434, 0xAD18CF, 0x3267D8, 0xB42B23, 0xB8B2D5, 0x3EFE2E,
+    0xC54E89, 0x430272, 0x4F9B84, 0xC9D77F, 0x56A868, 0xD0E493, 0xDC7D65, 0x5A319E,
+    0x64CFB0, 0xE2834B, 0xEE1ABD, 0x685646, 0xF72951, 0x7165AA, 0x7DFC5C, 0xFBB0A7,
+    0x0CD1E9, 0x8A9D12, 0x8604E4, 0x00481F, 0x9F3708, 0x197BF3, 0x15E205, 0x93AEFE,
+    0xAD50D0, 0x2B1C2B, 0x2785DD, 0xA1C926, 0x3EB631, 0xB8FACA, 0xB4633C, 0x322FC7,
+    0xC99F60, 0x4FD39B, 0x434A6D, 0xC50696, 0x5A7981, 0xDC357A, 0xD0AC8C, 0x56E077,
+    0x681E59, 0xEE52A2, 0xE2CB54, 0x6487AF, 0xFBF8B8, 0x7DB443, 0x712DB5, 0xF7614E,
+    0x19A3D2, 0x9FEF29, 0x9376DF, 0x153A24, 0x8A4533, 0x0C09C8, 0x00903E, 0x86DCC5,
+    0xB822EB, 0x3E6E10, 0x32F7E6, 0xB4BB1D, 0x2BC40A, 0xAD88F1, 0xA11107, 0x275DFC,
+    0xDCED5B, 0x5AA1A0, 0x563856, 0xD074AD, 0x4F0BBA, 0xC94741, 0xC5DEB7, 0x43924C,
+    0x7D6C62, 0xFB2099, 0xF7B96F, 0x71F594, 0xEE8A83, 0x68C678, 0x645F8E, 0xE21375,
+    0x15723B, 0x933EC0, 0x9FA736, 0x19EBCD, 0x8694DA, 0x00D821, 0x0C41D7, 0x8A0D2C,
+    0xB4F302, 0x32BFF9, 0x3E260F, 0xB86AF4, 0x2715E3, 0xA15918, 0xADC0EE, 0x2B8C15,
+    0xD03CB2, 0x567049, 0x5AE9BF, 0xDCA544, 0x43DA53, 0xC596A8, 0xC90F5E, 0x4F43A5,
+    0x71BD8B, 0xF7F170, 0xFB6886, 0x7D247D, 0xE25B6A, 0x641791, 0x688E67, 0xEEC29C,
+    0x3347A4, 0xB50B5F, 0xB992A9, 0x3FDE52, 0xA0A145, 0x26EDBE, 0x2A7448, 0xAC38B3,
+    0x92C69D, 0x148A66, 0x181390, 0x9E5F6B, 0x01207C, 0x876C87, 0x8BF571, 0x0DB98A,
+    0xF6092D, 0x7045D6, 0x7CDC20, 0xFA90DB, 0x65EFCC, 0xE3A337, 0xEF3AC1, 0x69763A,
+    0x578814, 0xD1C4EF, 0xDD5D19, 0x5B11E2, 0xC46EF5, 0x42220E, 0x4EBBF8, 0xC8F703,
+    0x3F964D, 0xB9DAB6, 0xB54340, 0x330FBB, 0xAC70AC, 0x2A3C57, 0x26A5A1, 0xA0E95A,
+    0x9E1774, 0x185B8F, 0x14C279, 0x928E82, 0x0DF195, 0x8BBD6E, 0x872498, 0x016863,
+    0xFAD8C4, 0x7C943F, 0x700DC9, 0xF64132, 0x693E25, 0xEF72DE, 0xE3EB28, 0x65A7D3,
+    0x5B59FD, 0xDD1506, 0xD18CF0, 0x57C00B, 0xC8BF1C, 0x4EF3E7, 0x426A11, 0xC426EA,
+    0x2AE476, 0xACA88D, 0xA0317B, 0x267D80, 0xB90297, 0x3F4E6C, 0x33D79A, 0xB59B61,
+    0x8B654F, 0x0D29B4, 0x01B042, 0x87FCB9, 0x1883AE, 0x9ECF55, 0x9256A3, 0x141A58,
+    0xEFAAFF, 0x69E604, 0x657FF2, 0xE33309, 0x7C4C1E, 0xFA00E5, 0xF69913, 0x70D5E8,
+    0x4E2BC6, 0xC8673D, 0xC4FECB, 0x42B230, 0xDDCD27, 0x5B81DC, 0x57182A, 0xD154D1,
+    0x26359F, 0xA07964, 0xACE092, 0x2AAC69, 0xB5D37E, 0x339F85, 0x3F0673, 0xB94A88,
+    0x87B4A6, 0x01F85D, 0x0D61AB, 0x8B2D50, 0x145247, 0x921EBC, 0x9E874A, 0x18CBB1,
+    0xE37B16, 0x6537ED, 0x69AE1B, 0xEFE2E0, 0x709DF7, 0xF6D10C, 0xFA48FA, 0x7C0401,
+    0x42FA2F, 0xC4B6D4, 0xC82F22, 0x4E63D9, 0xD11CCE, 0x575035, 0x5BC9C3, 0xDD8538,
+    };
+    uint32_t crc = 0;
+    for (size_t i = 0; i < len; i++) {
+        crc = ((crc << 8) & 0xFFFFFF) ^ CRC24Q_TABLE[((crc >> 16) ^ data[i]) & 0xFF];
+    }
+    return crc;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Return RTCM3 message type.
+ * -------------------------------------------------------------------------
+ *
+ * Message type starts at bit 24 (byte 3) and is 12 bits long.
+ * It occupies all 8 bits of byte 3 and the upper 4 bits of byte 4.
+ *
+ * @param  array frame RTCM3 frame (from rtcm3FramerNext()).
+ * @return uint16_t    Message type, 0 if not a frame.
+ * @since  0.8.7 [2025-12-16-06:00pm] New (rtcm3GetMessageType()).
+ * @since  3.2.2 [2026-10-16-09:00am] Moved from DougFoster_Ghost_Rover.ino, unsigned bytes.
+ */
+static inline uint16_t rtcm3MessageType(const uint8_t* frame) {
+    if (frame[0] != RTCM3_PREAMBLE) {
+        return 0;                                               // Invalid preamble.
+    }
+    return ((uint16_t)frame[3] << 4) | (frame[4] >> 4);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Clear ring buffer & stats.
+ * -------------------------------------------------------------------------
+ *
+ * @param  Rtcm3Framer* framer Framer.
+ * @return void No output is returned.
+ * @since  3.2.2 [2026-10-16-09:00am] New.
+ */
+static inline void rtcm3FramerReset(Rtcm3Framer* framer) {
+    memset(framer, 0, sizeof(Rtcm3Framer));
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Copy received bytes into the ring buffer.
+ * -------------------------------------------------------------------------
+ *
+ * At most two memcpy() calls (ring wrap). Bytes that don't fit are counted in bytesOverflow.
+ *
+ * @param  Rtcm3Framer* framer Framer.
+ * @param  array        data   Received bytes.
+ * @param  size_t       len    # of received bytes.
+ * @return size_t       # of bytes accepted.
+ * @since  3.2.2 [2026-10-16-09:00am] New.
+ */
+static inline size_t rtcm3FramerPush(Rtcm3Framer* framer, const uint8_t* data, size_t len) {
+    uint32_t space = RTCM3_RING_SIZE - (framer->head - framer->tail);
+    if (len > space) {
+        framer->bytesOverflow += len - space;
+        len = space;
+    }
+    uint32_t start = framer->head & RTCM3_RING_MASK;
+    uint32_t first = RTCM3_RING_SIZE - start;                   // Bytes before the wrap.
+    if (first > len) {
+        first = len;
+    }
+    memcpy(&framer->ring[start], data, first);
+    memcpy(&framer->ring[0], data + first, len - first);
+    framer->head    += len;
+    framer->bytesIn += len;
+    return len;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Look for a complete frame behind an incomplete candidate.
+ * -------------------------------------------------------------------------
+ *
+ * Real frames follow each other back to back, so a complete CRC-valid frame starting inside the candidate
+ * means the candidate's preamble was false. Each position is decided once per candidate: positions that are
+ * not a preamble or fail CRC are skipped for good, the scan resumes at the first position still waiting for bytes.
+ *
+ * @param  Rtcm3Framer* framer Framer (candidate at tail).
+ * @param  array        frame  Work buffer, RTCM3_MAX_FRAME bytes.
+ * @return bool         true if a complete CRC-valid frame was found behind the candidate.
+ * @since  3.2.2 [2026-10-17-09:00am] New.
+ */
+static inline bool rtcm3FramerLookahead(Rtcm3Framer* framer, uint8_t* frame) {
+    if ((framer->scanTail != framer->tail) || (framer->scanAt <= framer->tail)) {
+        framer->scanTail = framer->tail;                        // New candidate.
+        framer->scanAt   = framer->tail + 1;
+    }
+    bool     waiting = false;
+    uint32_t resume  = 0;
+    uint32_t at      = framer->scanAt;
+    for (; framer->head - at >= RTCM3_HEADER_LEN; at++) {
+        if (framer->ring[at & RTCM3_RING_MASK] != RTCM3_PREAMBLE) {
+            continue;
+        }
+        uint8_t lenHigh = framer->ring[(at + 1) & RTCM3_RING_MASK];
+        if (lenHigh & 0xFC) {
+            continue;
+        }
+        uint16_t payloadLen = ((uint16_t)(lenHigh & 0x03) << 8) | framer->ring[(at + 2) & RTCM3_RING_MASK];
+        uint16_t total      = RTCM3_HEADER_LEN + payloadLen + RTCM3_CRC_LEN;
+        if (framer->head - at < total) {
+            if (!waiting) {
+                waiting = true;                                 // Undecided, check again when more bytes arrive.
+                resume  = at;
+            }
+            continue;
+        }
+        for (uint16_t i = 0; i < total; i++) {
+            frame[i] = framer->ring[(at + i) & RTCM3_RING_MASK];
+        }
+        uint16_t crcAt = RTCM3_HEADER_LEN + payloadLen;
+        uint32_t crcRx = ((uint32_t)frame[crcAt] << 16) | ((uint32_t)frame[crcAt + 1] << 8) | frame[crcAt + 2];
+        if (rtcm3Crc24q(frame, crcAt) == crcRx) {
+            return true;
+        }
+    }
+    framer->scanAt = waiting ? resume : at;
+    return false;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Pull the next CRC-valid frame.
+ * -------------------------------------------------------------------------
+ *
+ * Hunt for 0xD3, check the reserved bits, wait for the full length, check CRC-24Q.
+ * On a bad candidate drop only the preamble byte so a real frame starting inside it is still found.
+ * While waiting, rtcm3FramerLookahead() rejects the candidate early if a valid frame is already behind it.
+ *
+ * @param  Rtcm3Framer* framer   Framer.
+ * @param  array        frame    Output, RTCM3_MAX_FRAME bytes. Holds the frame (header + message + CRC).
+ * @param  uint16_t*    frameLen Output, frame length.
+ * @return bool         true if a frame was returned, false if more bytes are needed.
+ * @since  3.2.2 [2026-10-16-09:00am] New.
+ * @since  3.2.2 [2026-10-17-09:00am] Early reject of an incomplete false candidate.
+ */
+static inline bool rtcm3FramerNext(Rtcm3Framer* framer, uint8_t* frame, uint16_t* frameLen) {
+    while (true) {
+        uint32_t available = framer->head - framer->tail;
+
+        // --- Hunt for preamble. ---
+        while ((available > 0) && (framer->ring[framer->tail & RTCM3_RING_MASK] != RTCM3_PREAMBLE)) {
+            framer->tail++;
+            framer->bytesDiscarded++;
+            available--;
+        }
+        if (available < RTCM3_HEADER_LEN) {
+            return false;                                       // Need more bytes.
+        }
+
+        // --- Header. ---
+        uint8_t lenHigh = framer->ring[(framer->tail + 1) & RTCM3_RING_MASK];
+        uint8_t lenLow  = framer->ring[(framer->tail + 2) & RTCM3_RING_MASK];
+        if (lenHigh & 0xFC) {                                   // Reserved bits set, not a frame.
+            framer->tail++;
+            framer->bytesDiscarded++;
+            continue;
+        }
+        uint16_t payloadLen = ((uint16_t)(lenHigh & 0x03) << 8) | lenLow;
+        uint16_t total      = RTCM3_HEADER_LEN + payloadLen + RTCM3_CRC_LEN;
+        if (available < total) {
+            if (rtcm3FramerLookahead(framer, frame)) {
+                framer->framesFalseStart++;                     // False preamble, valid frame behind it. Resync.
+                framer->tail++;
+                framer->bytesDiscarded++;
+                continue;
+            }
+            return false;                                       // Need more bytes.
+        }
+
+        // --- Copy out (at most two memcpy() calls) & check CRC. ---
+        uint32_t start = framer->tail & RTCM3_RING_MASK;
+        uint32_t first = RTCM3_RING_SIZE - start;
+        if (first > total) {
+            first = total;
+        }
+        memcpy(frame, &framer->ring[start], first);
+        memcpy(frame + first, &framer->ring[0], total - first);
+        uint16_t crcAt = RTCM3_HEADER_LEN + payloadLen;
+        uint32_t crcRx = ((uint32_t)frame[crcAt] << 16) | ((uint32_t)frame[crcAt + 1] << 8) | frame[crcAt + 2];
+        if (rtcm3Crc24q(frame, crcAt) == crcRx) {
+            framer->tail += total;
+            framer->framesOk++;
+            *frameLen = total;
+            return true;
+        }
+        framer->framesCrcBad++;                                 // False preamble or corrupted frame. Resync.
+        framer->tail++;
+        framer->bytesDiscarded++;
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Update per message type stats.
+ * -------------------------------------------------------------------------
+ *
+ * @param  Rtcm3Framer* framer Framer.
+ * @param  uint16_t     type   Message type (from rtcm3MessageType()).
+ * @param  uint16_t     len    Frame length.
+ * @param  int64_t      nowUs  Arrival time (us).
+ * @return Rtcm3TypeStats*     Updated entry, NULL if the table is full.
+ * @since  3.2.2 [2026-10-16-09:00am] New.
+ */
+static inline Rtcm3TypeStats* rtcm3TypeStatsRecord(Rtcm3Framer* framer, uint16_t type, uint16_t len, int64_t nowUs) {
+    Rtcm3TypeStats* entry = NULL;
+    for (uint8_t i = 0; i < framer->numTypes; i++) {
+        if (framer->types[i].type == type) {
+            entry = &framer->types[i];
+            break;
+        }
+    }
+    if (entry == NULL) {
+        if (framer->numTypes == RTCM3_MAX_TYPES) {
+            return NULL;                                        // Table full.
+        }
+        entry = &framer->types[framer->numTypes++];
+        entry->type = type;
+    }
+    if (entry->count > 0) {
+        entry->intervalMs = (uint32_t)((nowUs - entry->lastUs) / 1000);
+    }
+    entry->count++;
+    entry->bytes  += len;
+    entry->lastLen = len;
+    entry->lastUs  = nowUs;
+    return entry;
+}
+
+#endif
@@ -0,0 +1,398 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - SD session log.
+ * *************************************************************************
+ *
+ * sessionLog.h
+ *
+ * Ring buffers, block writer & time index used by taskSessionLogger().
+ * Plain C++ (no Arduino or FreeRTOS calls) so the same code also builds on a host,
+ * e.g. driven by a slow fake block device.
+ *
+ * Data path (one LogStream per stream: RTCM, NMEA, UBX):
+ *   producer (taskRtcmRelay(), DevUBLOXGNSS::processNMEA(), checkZedTriggerUpdate())
+ *     -> logGatePush()     Push only while the session is open (LogGate). The writer closes the gate & waits
+ *                          until no producer is mid-push before it writes the tail & closes the files.
+ *     -> logRingPush()     Lock free, single producer / single consumer. Never blocks: if the ring is full
+ *                          the whole write is dropped & counted (bytesDropped). Ring storage is in PSRAM.
+ *     -> logStreamWrite()  Writer (taskSessionLogger()) moves ring bytes into a LOG_BLOCK_SIZE block &
+ *                          hands full blocks to the sink (SD file). The ring keeps filling while the
+ *                          writer waits on the card (double buffering).
+ *                          LOG_WRITE_SECTORS also writes the whole sectors of a partial block (periodic sync),
+ *                          LOG_WRITE_ALL writes everything (close/rotate). File offsets stay sector aligned
+ *                          until the last write of a file. A short sink write keeps the unwritten bytes
+ *                          for the next pass; logStreamFinish() retries at close & counts what's left (bytesLost).
+ *
+ * Index file (".idx"): LogIndexEntry records, one every LOG_INDEX_INTERVAL (DougFoster_Ghost_Rover.ino).
+ *   Each holds the session time & the stream offsets at that time, so "/download" can seek to a time range.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-16-08:00pm] New.
+ * @since  3.2.2 [2026-10-17-11:00am] Keep the unwritten bytes on a short write, logStreamFinish(), LogGate close handshake.
+ * @see    taskSessionLogger(), startHttpServer() in DougFoster_Ghost_Rover.ino.
+ * @see    tests/host/test_sessionLog.cpp (short writes, slow fake block device, close handshake).
+ * @link   http://dougfoster.me.
+ */
+
+#ifndef SESSION_LOG_H
+#define SESSION_LOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * =========================================================================
+ *  Global vars.
+ * =========================================================================
+ */
+
+// --- Streams. ---
+enum LogStreamId {                                        // Readable index for streams. Order must match LOG_EXTENSION[].
+    LOG_RTCM,                                             // 0. Raw RTCM3 as relayed to the ZED.
+    LOG_NMEA,                                             // 1. NMEA as received from the ZED (checksum-valid, before nmeaRewrite()).
+    LOG_UBX,                                              // 2. UBX (RXM-RAWX & RXM-SFRBX) for post processing.
+    LOG_NUM_STREAMS                                       // 3 = automatic array length.
+};
+const char LOG_EXTENSION[LOG_NUM_STREAMS][6] = {          // File extensions; match LogStreamId.
+    "rtcm", "nmea", "ubx"
+};
+
+// --- Blocks. ---
+const uint32_t LOG_SECTOR_SIZE = 512;                     // SD sector.
+const uint32_t LOG_BLOCK_SIZE  = 8192;                    // Write unit (16 sectors).
+const uint8_t  LOG_FINISH_TRIES = 3;                      // Sink writes tried at close before the rest is counted as lost.
+
+// --- Writer. ---
+enum LogWriteMode {                                       // logStreamWrite() mode.
+    LOG_WRITE_BLOCKS,                                     // Full blocks only.
+    LOG_WRITE_SECTORS,                                    // Full blocks & the whole sectors of a partial block (sync).
+    LOG_WRITE_ALL                                         // Everything (close/rotate).
+};
+typedef size_t (*LogSink)(void* context, const uint8_t* data, size_t len);   // Returns # of bytes written.
+
+struct LogRing {                                          // Single producer / single consumer byte ring.
+    uint8_t*          buf;                                // Storage (power of 2 bytes, PSRAM on the rover).
+    uint32_t          mask;                               // Size - 1.
+    volatile uint32_t head;                               // Write index (free running). Only the producer writes it.
+    volatile uint32_t tail;                               // Read index (free running). Only the writer writes it.
+    uint32_t          bytesIn;                            // Total bytes accepted.
+    uint32_t          bytesDropped;                       // Bytes dropped, ring full.
+    uint32_t          highWater;                          // Max bytes waiting in the ring.
+};
+struct LogStream {                                        // One stream: ring, block & file position.
+    LogRing  ring;
+    uint8_t* block;                                       // LOG_BLOCK_SIZE bytes.
+    uint32_t blockLen;                                    // # of bytes in block.
+    uint32_t fileBytes;                                   // Bytes written to the current file.
+    uint32_t writeErrors;                                 // Short sink writes.
+    uint32_t bytesLost;                                   // Bytes the sink never took by close (logStreamFinish()).
+};
+struct LogGate {                                          // Producers vs. close handshake.
+    volatile bool     open;                               // Producers may push. Only the writer sets it.
+    volatile uint32_t busy;                               // # of producers inside logGatePush().
+};
+struct LogIndexEntry {                                    // One ".idx" record.
+    uint32_t ms;                                          // Time since session file opened (ms).
+    uint32_t gpsTowMs;                                    // GPS time of week (ms), 0 = unknown.
+    uint32_t offset[LOG_NUM_STREAMS];                     // Stream file offsets at ms.
+};
+
+/**
+ * =========================================================================
+ *  Functions.
+ * =========================================================================
+ *
+ * @see logRingInit()      - Set ring storage.
+ * @see logRingUsed()      - # of bytes waiting.
+ * @see logRingPush()      - Producer: add bytes (all or nothing).
+ * @see logRingPop()       - Writer: take bytes.
+ * @see logStreamWrite()   - Writer: ring -> block -> sink.
+ * @see logStreamFinish()  - Writer: write everything at close.
+ * @see logGatePush()      - Producer: push while the session is open.
+ * @see logGateClose()     - Writer: stop producers.
+ * @see logGateIdle()      - Writer: no producer mid-push.
+ * @see logStreamOffset()  - Stream position for the index.
+ * @see logIndexFind()     - Offset for a time.
+ */
+
+/**
+ * -------------------------------------------------------------------------
+ *  Set ring storage.
+ * -------------------------------------------------------------------------
+ *
+ * @param  LogRing* ring    Ring.
+ * @param  array    storage Storage.
+ * @param  uint32_t size    Storage size, power of 2.
+ * @return void     No output is returned.
+ * @since  3.2.2 [2026-10-16-08:00pm] New.
+ */
+static inline void logRingInit(LogRing* ring, uint8_t* storage, uint32_t size) {
+    memset(ring, 0, sizeof(LogRing));
+    ring->buf  = storage;
+    ring->mask = size - 1;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  # of bytes waiting.
+ * -------------------------------------------------------------------------
+ *
+ * @param  LogRing* ring Ring.
+ * @return uint32_t      # of bytes waiting.
+ * @since  3.2.2 [2026-10-16-08:00pm] New.
+ */
+static inline uint32_t logRingUsed(const LogRing* ring) {
+    return __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Producer: add bytes (all or nothing).
+ * -------------------------------------------------------------------------
+ *
+ * All or nothing so a NMEA sentence or RTCM chunk is never cut in half in the log.
+ *
+ * @param  LogRing* ring Ring (no storage = logging off, bytes ignored).
+ * @param  array    data Bytes.
+ * @param  size_t   len  # of bytes.
+ * @return bool     true if added, false if dropped.
+ * @since  3.2.2 [2026-10-16-08:00pm] New.
+ */
+static inline bool logRingPush(LogRing* ring, const uint8_t* data, size_t len) {
+    if (ring->buf == NULL) {
+        return false;
+    }
+    uint32_t head = ring->head;
+    uint32_t used = head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    if (len > (ring->mask + 1) - used) {
+        ring->bytesDropped += len;
+        return false;
+    }
+    uint32_t start = head & ring->mask;
+    uint32_t first = (ring->mask + 1) - start;                  // Bytes before the wrap.
+    if (first > len) {
+        first = len;
+    }
+    memcpy(&ring->buf[start], data, first);
+    memcpy(&ring->buf[0], data + first, len - first);
+    __atomic_store_n(&ring->head, head + (uint32_t)len, __ATOMIC_RELEASE);
+    ring->bytesIn += len;
+    if (used + len > ring->highWater) {
+        ring->highWater = used + len;
+    }
+    return true;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Writer: take bytes.
+ * -------------------------------------------------------------------------
+ *
+ * @param  LogRing* ring   Ring.
+ * @param  array    out    Output.
+ * @param  size_t   maxLen Max # of bytes.
+ * @return size_t          # of bytes taken.
+ * @since  3.2.2 [2026-10-16-08:00pm] New.
+ */
+static inline size_t logRingPop(LogRing* ring, uint8_t* out, size_t maxLen) {
+    uint32_t tail = ring->tail;
+    uint32_t len  = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) - tail;
+    if (len > maxLen) {
+        len = (uint32_t)maxLen;
+    }
+    uint32_t start = tail & ring->mask;
+    uint32_t first = (ring->mask + 1) - start;
+    if (first > len) {
+        first = len;
+    }
+    memcpy(out, &ring->buf[start], first);
+    memcpy(out + first, &ring->buf[0], len - first);
+    __atomic_store_n(&ring->tail, tail + len, __ATOMIC_RELEASE);
+    return len;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Writer: ring -> block -> sink.
+ * -------------------------------------------------------------------------
+ *
+ * A short sink write (card busy or full) counts a writeError & ends the pass. The unwritten bytes stay at
+ * the front of the block & go out first on the next pass, so nothing is lost while the ring has room.
+ *
+ * @param  LogStream* stream  Stream.
+ * @param  LogSink    sink    Block device/file write.
+ * @param  void*      context Passed to sink (e.g. File*).
+ * @param  uint8_t    mode    LogWriteMode.
+ * @return size_t             # of bytes written to the sink.
+ * @since  3.2.2 [2026-10-16-08:00pm] New.
+ * @since  3.2.2 [2026-10-17-11:00am] Short write: keep the unwritten bytes (was dropped).
+ */
+static inline size_t logStreamWrite(LogStream* stream, LogSink sink, void* context, uint8_t mode) {
+    size_t total = 0;
+    while (true) {
+
+        // --- Fill block. ---
+        stream->blockLen += (uint32_t)logRingPop(&stream->ring, stream->block + stream->blockLen, LOG_BLOCK_SIZE - stream->blockLen);
+
+        // --- How much to write. ---
+        uint32_t len = 0;
+        if (stream->blockLen == LOG_BLOCK_SIZE) {
+            len = LOG_BLOCK_SIZE;
+        } else if (mode == LOG_WRITE_SECTORS) {
+            len = stream->blockLen - (stream->blockLen % LOG_SECTOR_SIZE);
+        } else if (mode == LOG_WRITE_ALL) {
+            len = stream->blockLen;
+        }
+        if (len == 0) {
+            return total;
+        }
+
+        // --- Write. ---
+        size_t written = sink(context, stream->block, len);
+        if (written > len) {
+            written = len;
+        }
+        stream->fileBytes += (uint32_t)written;
+        total             += written;
+        memmove(stream->block, stream->block + written, stream->blockLen - written);   // Keep the unwritten bytes.
+        stream->blockLen  -= (uint32_t)written;
+        if (written != len) {
+            stream->writeErrors++;
+            return total;                                       // Sink is behind, retry next pass.
+        }
+        if (len < LOG_BLOCK_SIZE) {
+            return total;                                       // Partial block written, ring drained.
+        }
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Writer: write everything at close.
+ * -------------------------------------------------------------------------
+ *
+ * LOG_WRITE_ALL, retried up to LOG_FINISH_TRIES times after short writes. What's left in the block is counted
+ * (bytesLost) & dropped, so it never lands at the start of the next file. On rotate producers keep pushing &
+ * the ring carries on into the next file. On close (producers stopped: logGateClose() & logGateIdle()) the
+ * ring is dropped & counted too, or it would open the next session.
+ *
+ * @param  LogStream* stream  Stream.
+ * @param  LogSink    sink    Block device/file write.
+ * @param  void*      context Passed to sink (e.g. File*).
+ * @param  bool       closing true = session closing, false = rotate.
+ * @return uint32_t           # of bytes lost, 0 = all written.
+ * @since  3.2.2 [2026-10-17-11:00am] New.
+ */
+static inline uint32_t logStreamFinish(LogStream* stream, LogSink sink, void* context, bool closing) {
+    uint32_t lost = 0;
+    for (uint8_t tries = 0; tries < LOG_FINISH_TRIES; tries++) {
+        logStreamWrite(stream, sink, context, LOG_WRITE_ALL);
+        if ((stream->blockLen == 0) && ((!closing) || (logRingUsed(&stream->ring) == 0))) {
+            return 0;
+        }
+    }
+    lost             = stream->blockLen;
+    stream->blockLen = 0;
+    if (closing) {
+        lost += logRingUsed(&stream->ring);
+        __atomic_store_n(&stream->ring.tail, __atomic_load_n(&stream->ring.head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+    }
+    stream->bytesLost += lost;
+    return lost;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Producer: push while the session is open.
+ * -------------------------------------------------------------------------
+ *
+ * busy is raised before open is checked & the writer clears open before it checks busy (both sequentially
+ * consistent), so either this push sees the gate closed or the writer sees it in progress & waits.
+ *
+ * @param  LogGate* gate Session gate.
+ * @param  LogRing* ring Ring.
+ * @param  array    data Bytes.
+ * @param  size_t   len  # of bytes.
+ * @return bool     true if added, false if closed or dropped.
+ * @since  3.2.2 [2026-10-17-11:00am] New.
+ */
+static inline bool logGatePush(LogGate* gate, LogRing* ring, const uint8_t* data, size_t len) {
+    bool added = false;
+    __atomic_add_fetch(&gate->busy, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&gate->open, __ATOMIC_SEQ_CST)) {
+        added = logRingPush(ring, data, len);
+    }
+    __atomic_sub_fetch(&gate->busy, 1, __ATOMIC_RELEASE);
+    return added;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Writer: stop producers.
+ * -------------------------------------------------------------------------
+ *
+ * New pushes are refused at once. Pushes already past the check finish: wait for logGateIdle().
+ *
+ * @param  LogGate* gate Session gate.
+ * @return void     No output is returned.
+ * @since  3.2.2 [2026-10-17-11:00am] New.
+ */
+static inline void logGateClose(LogGate* gate) {
+    __atomic_store_n(&gate->open, false, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Writer: no producer mid-push.
+ * -------------------------------------------------------------------------
+ *
+ * @param  LogGate* gate Session gate.
+ * @return bool     true if no producer is inside logGatePush().
+ * @since  3.2.2 [2026-10-17-11:00am] New.
+ */
+static inline bool logGateIdle(LogGate* gate) {
+    return __atomic_load_n(&gate->busy, __ATOMIC_SEQ_CST) == 0;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Stream position for the index.
+ * -------------------------------------------------------------------------
+ *
+ * Bytes already in the ring or block were produced before now, so they come before the index mark.
+ *
+ * @param  LogStream* stream Stream.
+ * @return uint32_t          File offset of the next byte produced.
+ * @since  3.2.2 [2026-10-16-08:00pm] New.
+ */
+static inline uint32_t logStreamOffset(const LogStream* stream) {
+    return stream->fileBytes + stream->blockLen + logRingUsed(&stream->ring);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Offset for a time.
+ * -------------------------------------------------------------------------
+ *
+ * @param  array    entries Index entries (ascending ms).
+ * @param  size_t   count   # of entries.
+ * @param  uint32_t ms      Session time (ms).
+ * @param  uint8_t  stream  LogStreamId.
+ * @param  bool     end     false = start of a range (last mark <= ms), true = end of a range (first mark >= ms).
+ * @return uint32_t         Offset, 0 (start) or UINT32_MAX (end) if no mark qualifies.
+ * @since  3.2.2 [2026-10-16-08:00pm] New.
+ */
+static inline uint32_t logIndexFind(const LogIndexEntry* entries, size_t count, uint32_t ms, uint8_t stream, bool end) {
+    uint32_t offset = end ? UINT32_MAX : 0;
+    for (size_t i = 0; i < count; i++) {
+        if ((!end) && (entries[i].ms <= ms)) {
+            offset = entries[i].offset[stream];
+        } else if (end && (entries[i].ms >= ms)) {
+            return entries[i].offset[stream];
+        }
+    }
+    return offset;
+}
+
+#endif
@@ -0,0 +1,62 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host test helpers.
+ * *************************************************************************
+ *
+ * hostTest.h
+ *
+ * CHECK() & a monotonic clock for the tests in tests/host. No test framework, each test is a
+ * main() that returns the # of failed checks (0 = pass for ctest).
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-09:00am] New.
+ * @see    tests/host/CMakeLists.txt.
+ * @link   http://dougfoster.me.
+ */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+
+static int hostTestFailures = 0;                          // # of failed CHECK()s.
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            hostTestFailures++; \
+        } \
+    } while (0)
+
+/**
+ * -------------------------------------------------------------------------
+ *  Monotonic time (ns).
+ * -------------------------------------------------------------------------
+ *
+ * @return int64_t Time (ns) since an arbitrary start.
+ * @since  3.2.2 [2026-10-17-09:00am] New.
+ */
+static inline int64_t hostTestNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Deterministic pseudo random # (xorshift32).
+ * -------------------------------------------------------------------------
+ *
+ * @param  uint32_t* state Seed/state, not 0.
+ * @return uint32_t        Next value.
+ * @since  3.2.2 [2026-10-17-09:00am] New.
+ */
+static inline uint32_t hostTestRandom(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+#endif
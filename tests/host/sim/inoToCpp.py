@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""
+ * *************************************************************************
+ *  Ghost Rover 3 - Sketch to C++ for the host simulator.
+ * *************************************************************************
+
+ inoToCpp.py
+
+ What the Arduino IDE does before it compiles a sketch, for tests/host/sim: write the .ino as a
+ .cpp with #include <Arduino.h> on top & a prototype for every function, so a function can be
+ called above its definition. Prototypes go in front of the first function, after the globals
+ (the types they use). Default arguments stay on the definition only. #line keeps compiler
+ errors pointing at the .ino.
+
+ Usage:
+     python3 tests/host/sim/inoToCpp.py <sketch.ino> <output.cpp>
+
+ @author D. Foster <doug@dougfoster.me>.
+ @since  3.2.2 [2026-10-17-12:00pm] New.
+ @see    tests/host/sim/simRover.cpp, tests/host/CMakeLists.txt.
+ @link   https://arduino.github.io/arduino-cli/latest/sketch-build-process/.
+"""
+
+import re
+import sys
+
+# --- Global vars. ---
+FUNCTION = re.compile(r'^ ?([A-Za-z_][\w:<>]*(?:[ \t]+[\w:<>]+)*[ \t\*&]+)([A-Za-z_]\w*)[ \t]*\(([^;]*)\)[ \t]*\{')
+KEYWORDS = {'if', 'for', 'while', 'switch', 'return', 'else', 'do', 'case', 'sizeof'}
+
+
+def stripDefaults(params):
+    """Drop "= value" from each parameter (top level commas only)."""
+    out   = []
+    depth = 0
+    part  = ''
+    for c in params + ',':
+        if (c == ',') and (depth == 0):
+            out.append(part.split('=')[0].strip())
+            part = ''
+            continue
+        depth += (c in '(<[') - (c in ')>]')
+        part  += c
+    return ', '.join(p for p in out if p)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('Usage: inoToCpp.py <sketch.ino> <output.cpp>')
+    source = sys.argv[1]
+    with open(source, newline='') as f:
+        lines = f.read().replace('\r\n', '\n').split('\n')
+
+    # --- Function definitions (not members: DevUBLOXGNSS::processNMEA() is declared by the library). ---
+    prototypes = []
+    first      = None
+    for number, line in enumerate(lines):
+        match = FUNCTION.match(line)
+        if (match is None) or (match.group(2) in KEYWORDS) or (match.group(1).split()[0] in KEYWORDS):
+            continue
+        prototypes.append(f'{match.group(1).strip()} {match.group(2)}({stripDefaults(match.group(3))});')
+        first = number if first is None else first
+    if first is None:
+        sys.exit(f'{source}: no functions found.')
+
+    # --- Write. ---
+    path = source.replace('\\', '/')
+    with open(sys.argv[2], 'w') as out:
+        out.write(f'#include <Arduino.h>\n#line 1 "{path}"\n')
+        out.write('\n'.join(lines[:first]) + '\n')
+        out.write('\n'.join(prototypes) + '\n')
+        out.write(f'#line {first + 1} "{path}"\n')
+        out.write('\n'.join(lines[first:]) + '\n')
+
+
+if __name__ == '__main__':
+    main()
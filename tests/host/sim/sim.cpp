@@ -0,0 +1,811 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host simulator core.
+ * *************************************************************************
+ *
+ * sim.cpp
+ *
+ * Clock, tasks, notifications, queues, message buffers, heap counters, UARTs & the rest of the stand-in
+ * libraries that isn't inline in tests/host/sim/stubs. @see sim.h.
+ *
+ *  -- Heap counters. --
+ *     malloc() & friends are replaced (glibc's __libc_malloc() underneath). Only blocks allocated on a
+ *     task thread are counted, so the sim's own buffers (captures, latency samples) don't show up as
+ *     sketch heap. Counted blocks sit in a pointer table, so a free() on any thread finds them.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @since  3.2.2 [2026-10-17-03:30pm] Stack use snapshot at simStop(), before SimTaskExit unwinds.
+ * @see    sim.h, simRover.cpp.
+ * @link   http://dougfoster.me.
+ */
+
+#include <Arduino.h>
+#include <FS.h>
+#include <SD.h>
+#include <SPI.h>
+#include <WiFi.h>
+#include <Wire.h>
+#include <freertos/message_buffer.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <chrono>
+#include <condition_variable>
+#include <thread>
+
+/**
+ * =========================================================================
+ *  Heap counters.
+ * =========================================================================
+ */
+extern "C" {
+void* __libc_malloc(size_t size);
+void  __libc_free(void* ptr);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+}
+
+namespace {
+
+const size_t HEAP_SLOTS = 1 << 17;                        // Counted blocks alive at once (open addressing).
+
+struct HeapSlot {
+    void*    ptr;
+    uint32_t size;
+    bool     psram;
+};
+
+HeapSlot             heapSlots[HEAP_SLOTS];
+std::atomic_flag     heapLock = ATOMIC_FLAG_INIT;
+std::atomic<int64_t> heapInUse{0};
+std::atomic<int64_t> heapPeak{0};
+std::atomic<int64_t> psramInUse{0};
+std::atomic<int64_t> psramPeak{0};
+__thread bool        heapCount = false;                   // This thread is a task: count its blocks.
+
+size_t heapHash(void* ptr) {
+    return (size_t)(((uintptr_t)ptr >> 4) * 0x9E3779B97F4A7C15ULL) & (HEAP_SLOTS - 1);
+}
+
+void heapPeakUpdate(std::atomic<int64_t>* peak, int64_t value) {
+    int64_t seen = peak->load();
+    while ((value > seen) && (!peak->compare_exchange_weak(seen, value))) {
+    }
+}
+
+void heapAdd(void* ptr, size_t size, bool psram) {
+    while (heapLock.test_and_set(std::memory_order_acquire)) {
+    }
+    size_t at = heapHash(ptr);
+    for (size_t n = 0; n < HEAP_SLOTS; n++, at = (at + 1) & (HEAP_SLOTS - 1)) {
+        if (heapSlots[at].ptr == NULL) {
+            heapSlots[at] = {ptr, (uint32_t)size, psram};
+            break;
+        }
+    }
+    heapLock.clear(std::memory_order_release);
+    if (psram) {
+        heapPeakUpdate(&psramPeak, psramInUse += (int64_t)size);
+    } else {
+        heapPeakUpdate(&heapPeak, heapInUse += (int64_t)size);
+    }
+}
+
+bool heapRemove(void* ptr) {                              // false: not counted.
+    HeapSlot found = {};
+    while (heapLock.test_and_set(std::memory_order_acquire)) {
+    }
+    size_t at = heapHash(ptr);
+    for (size_t n = 0; (n < HEAP_SLOTS) && (heapSlots[at].ptr != NULL); n++, at = (at + 1) & (HEAP_SLOTS - 1)) {
+        if (heapSlots[at].ptr != ptr) {
+            continue;
+        }
+        found         = heapSlots[at];
+        heapSlots[at] = {};
+        size_t hole   = at;                               // Backward shift: keep probe runs unbroken.
+        for (size_t next = (at + 1) & (HEAP_SLOTS - 1); heapSlots[next].ptr != NULL; next = (next + 1) & (HEAP_SLOTS - 1)) {
+            size_t home = heapHash(heapSlots[next].ptr);
+            if (((next - home) & (HEAP_SLOTS - 1)) >= ((next - hole) & (HEAP_SLOTS - 1))) {
+                heapSlots[hole] = heapSlots[next];
+                heapSlots[next] = {};
+                hole            = next;
+            }
+        }
+        break;
+    }
+    heapLock.clear(std::memory_order_release);
+    if (found.ptr == NULL) {
+        return false;
+    }
+    (found.psram ? psramInUse : heapInUse) -= found.size;
+    return true;
+}
+
+void* heapTrack(void* ptr, bool wasCounted) {
+    if ((ptr != NULL) && (heapCount || wasCounted)) {
+        heapAdd(ptr, malloc_usable_size(ptr), false);
+    }
+    return ptr;
+}
+
+}  // namespace
+
+extern "C" {
+
+void* malloc(size_t size)                                 { return heapTrack(__libc_malloc(size), false); }
+void* calloc(size_t count, size_t size)                   { return heapTrack(__libc_calloc(count, size), false); }
+void* memalign(size_t alignment, size_t size)             { return heapTrack(__libc_memalign(alignment, size), false); }
+void* aligned_alloc(size_t alignment, size_t size)        { return memalign(alignment, size); }
+void* valloc(size_t size)                                 { return memalign(4096, size); }
+void* pvalloc(size_t size)                                { return memalign(4096, (size + 4095) & ~(size_t)4095); }
+
+void free(void* ptr) {
+    if (ptr != NULL) {
+        heapRemove(ptr);
+        __libc_free(ptr);
+    }
+}
+
+void* realloc(void* ptr, size_t size) {
+    bool counted = (ptr != NULL) && heapRemove(ptr);
+    void* moved  = __libc_realloc(ptr, size);
+    if ((moved == NULL) && (size > 0) && counted) {       // Failed: the old block is still there.
+        heapAdd(ptr, malloc_usable_size(ptr), false);
+        return NULL;
+    }
+    return heapTrack(moved, counted);
+}
+
+int posix_memalign(void** out, size_t alignment, size_t size) {
+    void* ptr = memalign(alignment, size);
+    if (ptr == NULL) {
+        return ENOMEM;
+    }
+    *out = ptr;
+    return 0;
+}
+
+}  // extern "C"
+
+void* simPsramAlloc(size_t size) {
+    if ((size_t)psramInUse.load() + size > SIM_PSRAM_SIZE) {
+        return NULL;
+    }
+    void* ptr = __libc_malloc(size);
+    if (ptr != NULL) {
+        heapAdd(ptr, size, true);
+    }
+    return ptr;
+}
+
+SimHeapOff::SimHeapOff() : was(heapCount) {
+    heapCount = false;
+}
+
+SimHeapOff::~SimHeapOff() {
+    heapCount = was;
+}
+
+SimHeapStats simHeapStats() {
+    return {heapInUse.load(), heapPeak.load(), psramInUse.load(), psramPeak.load()};
+}
+
+/**
+ * =========================================================================
+ *  Clock.
+ * =========================================================================
+ */
+namespace {
+
+const int64_t SPIN_US = 200;                              // Sleep, then spin the last SPIN_US (sleep overshoots ~50-100 us).
+
+const std::chrono::steady_clock::time_point clockStart = std::chrono::steady_clock::now();
+std::atomic<int64_t>    clockSkip{0};                     // Delays skipped in setup() (us).
+std::atomic<bool>       booting{true};
+std::mutex              stopMutex;
+std::condition_variable stopCv;
+
+int64_t realUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - clockStart).count();
+}
+
+}  // namespace
+
+std::atomic<bool> simStopping{false};
+
+int64_t simNowUs() {
+    return realUs() + clockSkip.load();
+}
+
+bool simSleepUntilUs(int64_t until) {
+    std::unique_lock<std::mutex> lock(stopMutex);
+    for (int64_t left = until - simNowUs(); (left > SPIN_US) && (!simStopping); left = until - simNowUs()) {
+        stopCv.wait_for(lock, std::chrono::microseconds(left - SPIN_US));
+    }
+    lock.unlock();
+    while ((!simStopping) && (simNowUs() < until)) {
+    }
+    return !simStopping;
+}
+
+void simBusyUs(int64_t us) {
+    int64_t until = simNowUs() + us;
+    if (us > SPIN_US) {
+        std::this_thread::sleep_for(std::chrono::microseconds(us - SPIN_US));
+    }
+    while (simNowUs() < until) {
+    }
+}
+
+void simBootDone() {
+    booting = false;
+}
+
+/**
+ * =========================================================================
+ *  Tasks.
+ * =========================================================================
+ */
+struct SimTask {
+    char                    name[configMAX_TASK_NAME_LEN];
+    uint32_t                stackSize;                    // ESP-IDF bytes.
+    void                  (*function)(void*);
+    void*                   param;
+    pthread_t               thread;
+    uint8_t*                stack;                        // Host stack (mmap), painted.
+    size_t                  hostSize;
+    uint8_t*                stackTop;                     // Frame address the task function starts from.
+    void*                   charge;                       // Heap charged for the ESP-IDF stack.
+    uint32_t                stackAtStop;                  // Stack use when simStop() was called (SimTaskExit unwinding isn't the sketch's).
+    std::mutex              mutex;
+    std::condition_variable cv;
+    uint32_t                notify;
+};
+
+namespace {
+
+SimTask*             tasks[SIM_MAX_TASKS];
+std::atomic<uint8_t> numTasks{0};
+std::mutex           tasksMutex;
+__thread SimTask*    current = NULL;
+
+void* taskRun(void* arg) {
+    SimTask* task  = (SimTask*)arg;
+    current        = task;
+    heapCount      = true;
+    task->stackTop = (uint8_t*)__builtin_frame_address(0);
+    try {
+        task->function(task->param);
+    } catch (const SimTaskExit&) {
+    }
+    return NULL;
+}
+
+void taskThrowIfStopping() {
+    if (simStopping && (current != NULL)) {
+        throw SimTaskExit();
+    }
+}
+
+// Wait on cv until ready() or the deadline (portMAX_DELAY: none). Wakes every 10 ms for simStop().
+template <typename Ready>
+bool waitFor(std::unique_lock<std::mutex>& lock, std::condition_variable& cv, TickType_t ticks, Ready ready) {
+    int64_t until = (ticks == portMAX_DELAY) ? INT64_MAX : simNowUs() + (int64_t)ticks * 1000;
+    while (!ready()) {
+        int64_t left = until - simNowUs();
+        if ((left <= 0) || simStopping) {
+            break;
+        }
+        cv.wait_for(lock, std::chrono::microseconds((left < 10000) ? left : 10000));
+    }
+    if (simStopping) {
+        lock.unlock();
+        taskThrowIfStopping();
+        lock.lock();
+    }
+    return ready();
+}
+
+uint32_t taskStackUsed(SimTask* task) {
+    uint8_t* low = task->stack;
+    while ((low < task->stackTop) && (*low == SIM_STACK_PAINT)) {
+        low++;
+    }
+    return (task->stackTop > low) ? (uint32_t)(task->stackTop - low) : 0;
+}
+
+}  // namespace
+
+void simDelayUs(int64_t us) {
+    if (booting && (current != NULL) && (strcmp(current->name, "loopTask") == 0)) {
+        clockSkip += us;                                  // setup(): jump, don't wait.
+        taskThrowIfStopping();
+        return;
+    }
+    simSleepUntilUs(simNowUs() + us);
+    taskThrowIfStopping();
+}
+
+void simStop() {
+    for (uint8_t i = 0; i < numTasks; i++) {
+        tasks[i]->stackAtStop = (tasks[i]->stackTop != NULL) ? taskStackUsed(tasks[i]) : 0;
+    }
+    simStopping = true;
+    std::lock_guard<std::mutex> lock(stopMutex);
+    stopCv.notify_all();
+}
+
+SimTask* simTaskCreate(void (*function)(void*), const char* name, uint32_t stackSize, void* param) {
+    std::lock_guard<std::mutex> lock(tasksMutex);
+    if (numTasks >= SIM_MAX_TASKS) {
+        return NULL;
+    }
+    SimTask* task   = new SimTask();
+    strlcpy(task->name, name, sizeof(task->name));
+    task->stackSize = stackSize;
+    task->function  = function;
+    task->param     = param;
+    task->hostSize  = ((size_t)stackSize * SIM_STACK_SCALE + SIM_STACK_EXTRA + 4095) & ~(size_t)4095;
+    task->stack     = (uint8_t*)mmap(NULL, task->hostSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    task->charge    = malloc(stackSize);                  // xTaskCreate() takes the stack from the heap.
+    if (task->stack == MAP_FAILED) {
+        delete task;
+        return NULL;
+    }
+    memset(task->stack, SIM_STACK_PAINT, task->hostSize);
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstack(&attr, task->stack, task->hostSize);
+    if (pthread_create(&task->thread, &attr, taskRun, task) != 0) {
+        pthread_attr_destroy(&attr);
+        munmap(task->stack, task->hostSize);
+        delete task;
+        return NULL;
+    }
+    pthread_attr_destroy(&attr);
+    tasks[numTasks++] = task;
+    return task;
+}
+
+SimTask* simTaskCurrent() {
+    return current;
+}
+
+void simTaskJoinAll() {
+    for (uint8_t i = 0; i < numTasks; i++) {
+        pthread_join(tasks[i]->thread, NULL);
+    }
+}
+
+size_t simTaskStats(SimTaskStats* out, size_t max) {
+    size_t n = 0;
+    for (; (n < numTasks) && (n < max); n++) {
+        strlcpy(out[n].name, tasks[n]->name, sizeof(out[n].name));
+        out[n].stackSize = tasks[n]->stackSize;
+        out[n].stackUsed = simStopping ? tasks[n]->stackAtStop : (tasks[n]->stackTop != NULL) ? taskStackUsed(tasks[n]) : 0;
+    }
+    return n;
+}
+
+// --- FreeRTOS task API. ---
+BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stackSize, void* param, UBaseType_t priority, TaskHandle_t* handle) {
+    (void)priority;
+    SimTask* task = simTaskCreate(function, name, stackSize, param);
+    if (handle != NULL) {
+        *handle = task;
+    }
+    return (task != NULL) ? pdPASS : pdFAIL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackSize, void* param, UBaseType_t priority,
+                                   TaskHandle_t* handle, BaseType_t core) {
+    (void)core;
+    return xTaskCreate(function, name, stackSize, param, priority, handle);
+}
+
+void vTaskDelay(TickType_t ticks) {
+    simDelayUs((int64_t)ticks * 1000);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if ((task == NULL) || (task == current)) {
+        throw SimTaskExit();
+    }
+}
+
+void vTaskSuspend(TaskHandle_t task) {
+    if ((task == NULL) || (task == current)) {
+        simSleepUntilUs(INT64_MAX);
+        taskThrowIfStopping();
+    }
+}
+
+void taskYIELD() {
+    std::this_thread::yield();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait) {
+    SimTask* task = current;
+    if (task == NULL) {
+        return 0;
+    }
+    std::unique_lock<std::mutex> lock(task->mutex);
+    waitFor(lock, task->cv, wait, [task]() { return task->notify > 0; });
+    uint32_t value = task->notify;
+    task->notify   = (clear == pdTRUE) ? 0 : ((value > 0) ? value - 1 : 0);
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    if (task == NULL) {
+        return pdFAIL;
+    }
+    std::lock_guard<std::mutex> lock(task->mutex);
+    task->notify++;
+    task->cv.notify_one();
+    return pdPASS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return current;
+}
+
+TaskHandle_t xTaskGetHandle(const char* name) {
+    for (uint8_t i = 0; i < numTasks; i++) {
+        if (strcmp(tasks[i]->name, name) == 0) {
+            return tasks[i];
+        }
+    }
+    return NULL;
+}
+
+char* pcTaskGetName(TaskHandle_t task) {
+    task = (task == NULL) ? current : task;
+    return (task != NULL) ? task->name : (char*)"sim";
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    task = (task == NULL) ? current : task;
+    if ((task == NULL) || (task->stackTop == NULL)) {
+        return 0;
+    }
+    uint32_t used = taskStackUsed(task);
+    return (used < task->stackSize) ? task->stackSize - used : 0;
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)(simNowUs() / 1000);
+}
+
+/**
+ * =========================================================================
+ *  Queues & message buffers.
+ * =========================================================================
+ */
+struct SimQueue {
+    std::mutex              mutex;
+    std::condition_variable cv;
+    uint8_t*                storage;                      // length x itemSize, from the heap like the device.
+    UBaseType_t             length;
+    UBaseType_t             itemSize;
+    UBaseType_t             head;
+    UBaseType_t             count;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    SimQueue* queue = new SimQueue();
+    queue->storage  = (uint8_t*)malloc(length * itemSize);
+    queue->length   = length;
+    queue->itemSize = itemSize;
+    queue->head     = 0;
+    queue->count    = 0;
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t wait) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!waitFor(lock, queue->cv, wait, [queue]() { return queue->count < queue->length; })) {
+        return pdFALSE;
+    }
+    memcpy(&queue->storage[((queue->head + queue->count) % queue->length) * queue->itemSize], item, queue->itemSize);
+    queue->count++;
+    queue->cv.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t wait) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!waitFor(lock, queue->cv, wait, [queue]() { return queue->count > 0; })) {
+        return pdFALSE;
+    }
+    memcpy(item, &queue->storage[queue->head * queue->itemSize], queue->itemSize);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    queue->cv.notify_all();
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return queue->count;
+}
+
+struct SimMessageBuffer {
+    std::mutex              mutex;
+    std::condition_variable cv;
+    uint8_t*                storage;                      // Ring: [4 byte length][message] ...
+    size_t                  size;
+    size_t                  head;
+    size_t                  used;
+
+    void copyIn(const void* data, size_t len) {
+        for (size_t n = 0; n < len; n++) {
+            storage[(head + used + n) % size] = ((const uint8_t*)data)[n];
+        }
+        used += len;
+    }
+    void peek(void* data, size_t len) {
+        for (size_t n = 0; n < len; n++) {
+            ((uint8_t*)data)[n] = storage[(head + n) % size];
+        }
+    }
+};
+
+const size_t SIM_MESSAGE_LENGTH = 4;                      // sizeof(size_t) on ESP32.
+
+MessageBufferHandle_t xMessageBufferCreate(size_t size) {
+    SimMessageBuffer* buffer = new SimMessageBuffer();
+    buffer->storage = (uint8_t*)malloc(size);
+    buffer->size    = size;
+    buffer->head    = 0;
+    buffer->used    = 0;
+    return buffer;
+}
+
+size_t xMessageBufferSend(MessageBufferHandle_t buffer, const void* data, size_t len, TickType_t wait) {
+    std::unique_lock<std::mutex> lock(buffer->mutex);
+    if ((len + SIM_MESSAGE_LENGTH > buffer->size) ||
+        (!waitFor(lock, buffer->cv, wait, [buffer, len]() { return buffer->used + SIM_MESSAGE_LENGTH + len <= buffer->size; }))) {
+        return 0;
+    }
+    uint32_t length = (uint32_t)len;
+    buffer->copyIn(&length, SIM_MESSAGE_LENGTH);
+    buffer->copyIn(data, len);
+    buffer->cv.notify_all();
+    return len;
+}
+
+size_t xMessageBufferReceive(MessageBufferHandle_t buffer, void* data, size_t maxLen, TickType_t wait) {
+    std::unique_lock<std::mutex> lock(buffer->mutex);
+    uint32_t length = 0;
+    if (!waitFor(lock, buffer->cv, wait, [buffer]() { return buffer->used > 0; })) {
+        return 0;
+    }
+    buffer->peek(&length, SIM_MESSAGE_LENGTH);
+    if (length > maxLen) {                                // Too big: stays in the buffer (FreeRTOS).
+        return 0;
+    }
+    buffer->head  = (buffer->head + SIM_MESSAGE_LENGTH) % buffer->size;
+    buffer->used -= SIM_MESSAGE_LENGTH;
+    buffer->peek(data, length);
+    buffer->head  = (buffer->head + length) % buffer->size;
+    buffer->used -= length;
+    buffer->cv.notify_all();
+    return length;
+}
+
+BaseType_t xMessageBufferReset(MessageBufferHandle_t buffer) {
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    buffer->head = 0;
+    buffer->used = 0;
+    buffer->cv.notify_all();
+    return pdPASS;
+}
+
+size_t xMessageBufferSpacesAvailable(MessageBufferHandle_t buffer) {
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    return buffer->size - buffer->used;
+}
+
+BaseType_t xMessageBufferIsEmpty(MessageBufferHandle_t buffer) {
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    return (buffer->used == 0) ? pdTRUE : pdFALSE;
+}
+
+/**
+ * =========================================================================
+ *  Arduino core.
+ * =========================================================================
+ */
+HardwareSerial Serial("Serial");
+HardwareSerial Serial1("Serial1");
+HardwareSerial Serial2("Serial2");
+SimLed         simLed = {};
+EspClass       ESP;
+std::atomic<uint32_t> simRestarts{0};
+
+size_t strlcpy(char* dest, const char* src, size_t size) {
+    size_t len = strlen(src);
+    if (size > 0) {
+        size_t n = (len < size - 1) ? len : size - 1;
+        memcpy(dest, src, n);
+        dest[n] = '\0';
+    }
+    return len;
+}
+
+size_t strlcat(char* dest, const char* src, size_t size) {
+    size_t len = strnlen(dest, size);
+    return (len == size) ? size + strlen(src) : len + strlcpy(dest + len, src, size - len);
+}
+
+size_t Print::printf(const char* format, ...) {
+    char    local[256];
+    char*   text = local;
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(local, sizeof(local), format, args);
+    va_end(args);
+    if (len < 0) {
+        return 0;
+    }
+    if ((size_t)len >= sizeof(local)) {                   // Like the core: heap for long output.
+        text = (char*)malloc(len + 1);
+        if (text == NULL) {
+            return 0;
+        }
+        va_start(args, format);
+        vsnprintf(text, len + 1, format, args);
+        va_end(args);
+    }
+    size_t n = write((const uint8_t*)text, len);
+    if (text != local) {
+        free(text);
+    }
+    return n;
+}
+
+size_t Stream::readBytesUntil(char terminator, char* buffer, size_t length) {
+    size_t n = 0;
+    while ((n < length) && (available() > 0)) {
+        int c = read();
+        if ((c < 0) || (c == terminator)) {
+            break;
+        }
+        buffer[n++] = (char)c;
+    }
+    return n;
+}
+
+void HardwareSerial::begin(unsigned long baud, uint32_t config, int8_t rxPin, int8_t txPin) {
+    (void)config;
+    (void)rxPin;
+    (void)txPin;
+    std::lock_guard<std::mutex> lock(mutex_);
+    baud_ = (uint32_t)baud;
+}
+
+int HardwareSerial::available() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (int)rx_.size();
+}
+
+int HardwareSerial::read() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (rx_.empty()) {
+        return -1;
+    }
+    int c = rx_.front();
+    rx_.pop_front();
+    return c;
+}
+
+size_t HardwareSerial::read(uint8_t* buffer, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t n = 0;
+    for (; (n < size) && (!rx_.empty()); n++) {
+        buffer[n] = rx_.front();
+        rx_.pop_front();
+    }
+    return n;
+}
+
+// UART TX: 10 bits a byte at the baud rate, returns once the rest fits the TX FIFO (no TX ring buffer).
+// USB CDC (Serial) isn't paced.
+size_t HardwareSerial::write(const uint8_t* data, size_t len) {
+    int64_t byteUs   = 0;
+    int64_t firstDone = 0;
+    int64_t fifoFree = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if ((this != &Serial) && (baud_ > 0)) {
+            int64_t now   = simNowUs();
+            int64_t start = (txFreeAt_ > now) ? txFreeAt_ : now;
+            byteUs        = 10000000 / baud_;
+            firstDone     = start + byteUs;
+            txFreeAt_     = start + (int64_t)len * byteUs;
+            fifoFree      = txFreeAt_ - (int64_t)SIM_UART_TX_FIFO * byteUs;
+        }
+        if (simTx) {
+            simTx(data, len, firstDone, byteUs);
+        }
+    }
+    if (fifoFree > simNowUs()) {
+        simBusyUs(fifoFree - simNowUs());
+    }
+    return len;
+}
+
+void HardwareSerial::onReceive(std::function<void()> callback, bool onlyOnTimeout) {
+    (void)onlyOnTimeout;
+    std::lock_guard<std::mutex> lock(mutex_);
+    onReceive_ = callback;
+}
+
+size_t HardwareSerial::simRxPush(const uint8_t* data, size_t len) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t n = 0;
+    for (; (n < len) && (rx_.size() < SIM_UART_RX_BUFFER); n++) {
+        rx_.push_back(data[n]);
+    }
+    simRxDropped += len - n;
+    return n;
+}
+
+size_t HardwareSerial::simRxFree() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return SIM_UART_RX_BUFFER - rx_.size();
+}
+
+void HardwareSerial::simRxEvent() {
+    std::function<void()> callback;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callback = onReceive_;
+    }
+    if (callback) {
+        callback();
+    }
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    (void)pin;
+    (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    (void)pin;
+    (void)value;
+}
+
+int digitalRead(uint8_t pin) {
+    (void)pin;
+    return HIGH;                                          // Buttons (pull-up): not pressed.
+}
+
+void rgbLedWrite(uint8_t pin, uint8_t red, uint8_t green, uint8_t blue) {
+    (void)pin;
+    simLed.red   = red;
+    simLed.green = green;
+    simLed.blue  = blue;
+    simLed.writes++;
+}
+
+void esp_restart() {
+    simRestarts++;
+    simSleepUntilUs(INT64_MAX);                           // The sim doesn't reboot: park until simStop().
+    throw SimTaskExit();
+}
+
+/**
+ * =========================================================================
+ *  Libraries.
+ * =========================================================================
+ */
+TwoWire   Wire;
+TwoWire   Wire1;
+SDFS      SD;
+SPIClass  SPI;
+WiFiClass WiFi;
@@ -0,0 +1,108 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host simulator core.
+ * *************************************************************************
+ *
+ * sim.h
+ *
+ * What the stand-in libraries (tests/host/sim/stubs) run on: a clock, FreeRTOS tasks as threads with painted
+ * stacks, heap counters & the far side of the peripherals (radio -> Serial1, Serial2 -> ZED, ZED -> I2C).
+ *
+ *  -- Clock. --
+ *     esp_timer_get_time() is wall time since the sim started. Delays in setup() (4 s start delay, ZED reset)
+ *     don't sleep, the clock jumps ahead instead, so a run starts at once with the same timestamps.
+ *
+ *  -- Tasks. --
+ *     xTaskCreate() starts a thread on a stack of its own (SIM_STACK_SCALE x the ESP-IDF size) filled with
+ *     SIM_STACK_PAINT. uxTaskGetStackHighWaterMark() scans for the deepest byte touched. x86-64 frames aren't
+ *     Xtensa frames, so stack numbers are indicative: compare tasks & runs, not bytes with the device.
+ *     simStop() makes every blocking call (vTaskDelay(), ulTaskNotifyTake(), queue waits) throw SimTaskExit,
+ *     which ends the task; FreeRTOS tasks never return on their own. simTaskStats() after simStop() reports
+ *     the stack use from just before it: unwinding SimTaskExit goes deeper than any task did.
+ *
+ *  -- Heap. --
+ *     malloc() & friends are counted (sim.cpp): bytes in use & the peak, internal RAM & PSRAM
+ *     (heap_caps_malloc(MALLOC_CAP_SPIRAM)) apart. ESP.getFreeHeap() & ESP.getFreePsram() report what's left
+ *     of SIM_HEAP_SIZE & SIM_PSRAM_SIZE. Task stacks are charged to the heap at their ESP-IDF size, like
+ *     xTaskCreate() on the device. The SD card's storage (stubs/FS.h) isn't RAM & isn't counted (SimHeapOff).
+ *
+ * Linux (glibc) only: the heap counters replace malloc().
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    sim.cpp, simRover.cpp, tests/host/sim/stubs.
+ * @link   http://dougfoster.me.
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// --- Sizes. ---
+const size_t   SIM_HEAP_SIZE   = 327680;                  // ESP32-S3 internal RAM free at boot (approx., bytes).
+const size_t   SIM_PSRAM_SIZE  = 8388608;                 // ESP32-S3 Thing Plus PSRAM (bytes).
+const uint32_t SIM_STACK_SCALE = 4;                       // Host stack = SIM_STACK_SCALE x ESP-IDF size + SIM_STACK_EXTRA.
+const uint32_t SIM_STACK_EXTRA = 65536;
+const uint8_t  SIM_STACK_PAINT = 0xA5;                    // Untouched stack bytes.
+const uint8_t  SIM_MAX_TASKS   = 16;
+
+// --- Stop. ---
+struct SimTaskExit {};                                    // Thrown by blocking calls after simStop(). Caught by the task wrapper.
+extern std::atomic<bool> simStopping;
+
+struct SimTask;                                           // FreeRTOS task. @see sim.cpp.
+
+struct SimTaskStats {                                     // One task, simTaskStats().
+    char     name[16];
+    uint32_t stackSize;                                   // ESP-IDF stack size asked for (bytes).
+    uint32_t stackUsed;                                   // Deepest stack use so far (host bytes), at simStop() once stopped.
+};
+
+struct SimHeapOff {                                      // Scope: this thread's allocations aren't counted (SD card storage).
+    SimHeapOff();
+    ~SimHeapOff();
+    bool was;
+};
+
+struct SimHeapStats {                                     // simHeapStats().
+    int64_t inUse;                                        // Internal RAM (bytes).
+    int64_t peak;
+    int64_t psramInUse;                                   // heap_caps_malloc(MALLOC_CAP_SPIRAM).
+    int64_t psramPeak;
+};
+
+/**
+ * =========================================================================
+ *  Functions.
+ * =========================================================================
+ *
+ * @see simNowUs()          - Sim time (us).
+ * @see simDelayUs()        - Task sleep (delay(), vTaskDelay()).
+ * @see simSleepUntilUs()   - Sim thread sleep (feeders).
+ * @see simBusyUs()         - Blocking bus time (I2C, UART TX).
+ * @see simBootDone()       - setup() finished, delays sleep from now on.
+ * @see simStop()           - End every task.
+ * @see simTaskCreate()     - Start a task (thread).
+ * @see simTaskCurrent()    - Calling task, NULL for a sim thread.
+ * @see simTaskJoinAll()    - Wait for every task to end.
+ * @see simTaskStats()      - Stack use per task.
+ * @see simHeapStats()      - Heap in use & peak.
+ * @see simPsramAlloc()     - heap_caps_malloc(MALLOC_CAP_SPIRAM).
+ */
+int64_t  simNowUs();
+void     simDelayUs(int64_t us);
+bool     simSleepUntilUs(int64_t until);
+void     simBusyUs(int64_t us);
+void     simBootDone();
+void     simStop();
+SimTask* simTaskCreate(void (*function)(void*), const char* name, uint32_t stackSize, void* param);
+SimTask* simTaskCurrent();
+void     simTaskJoinAll();
+size_t   simTaskStats(SimTaskStats* out, size_t max);
+SimHeapStats simHeapStats();
+void*    simPsramAlloc(size_t size);
+
+#endif
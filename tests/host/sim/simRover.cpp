@@ -0,0 +1,1091 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host replay simulator & benchmark.
+ * *************************************************************************
+ *
+ * simRover.cpp
+ *
+ * Runs the sketch (DougFoster_Ghost_Rover.ino, unchanged, via inoToCpp.py) on a Linux host against the
+ * stand-ins in tests/host/sim/stubs, replays RTCM & NMEA, & reports throughput, latency, heap & stack.
+ *
+ *  -- Stage 1: radio byte in -> ZED out. --
+ *     The radio feeder sends RTCM at the HC-12 line rate (9600 baud x --speed) in bursts, one per epoch
+ *     (second), into Serial1's RX buffer, & raises the UART RX event every 120 bytes (FIFO full) & 2 byte
+ *     times after a burst (RX timeout), like the ESP32 UART driver. taskRtcmRelay() does the rest.
+ *     The ZED side frames what Serial2 sends at 38400 baud. Latency = last byte of a frame in on the radio
+ *     wire -> last byte of the same frame out of UART2. Frames are matched by length & CRC, so good,
+ *     CRC-bad & lost frames are counted apart (pass-through & rtcmCrcOnly).
+ *
+ *  -- Stage 2: ZED sentence -> I2C out -> browser frame. --
+ *     The ZED feeder puts each epoch's NMEA (& a NAV-PVT/NAV-HPPOSLLH pair) in the ZED's I2C buffer every
+ *     navigation interval (/ --speed). loop() polls it (checkZedTriggerUpdate() -> processNMEA()), Wire1
+ *     takes each sentence & the browser (a WebSocket client on the NMEA page) gets lastNmea in JSON
+ *     (processJsonActivity() -> sendDataToBrowser()). Latency: ZED -> I2C ACK, I2C -> WebSocket frame, both.
+ *
+ *  -- Also exercised. --
+ *     Preferences round trip over the WebSocket (sendPrefs, setNtripCasterPref, setPrefs -> prefUtility()),
+ *     echo, height & position lock ("pending", then "locked"), USB commands (logSession, rtcmCrcOnly), "/metrics", "/" & the asset
+ *     cache ("/global.js", gzip, ETag, 304) when assets.txt is on the card. The session log the run writes
+ *     can be saved (--save) & replayed (--log): its ".rtcm" holds the relay's input as received, CRC-bad
+ *     frames included, & the ".idx" paces the replay.
+ *
+ * Usage:
+ *     simRover [--seconds S] [--speed N] [--corrupt N] [--crc-only] [--rtcm file] [--nmea file]
+ *              [--log dir/logNNNN] [--sd dir]... [--save dir] [--console]
+ *   --seconds  Replay time (default 10, sim seconds at --speed).
+ *   --speed    Accelerate: radio line rate, epoch & NMEA rates x N (default 1).
+ *   --corrupt  Flip a byte in every Nth synthetic RTCM frame (default 0 = none).
+ *   --crc-only Relay only CRC-valid frames (USB command rtcmCrcOnly).
+ *   --rtcm     Raw RTCM3 capture (default synthetic 1005/1230 every 10 s, MSM4 GPS/GLO/GAL/BDS every 1 s).
+ *   --nmea     NMEA capture (default synthetic GGA, RMC, GSA, 3 GSV, GST each epoch).
+ *   --log      Session log base path: replays .rtcm & .nmea paced by .idx.
+ *   --sd       Copy a directory's files to the card root (ui/, tools/gzipAssets.py output). Needed:
+ *              setup() freezes on an empty card.
+ *   --save     Write the card's session log files to a directory after the run.
+ *   --console  Print the sketch's USB serial output.
+ *
+ * Returns the # of failed checks (0 = pass for ctest).
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @since  3.2.2 [2026-10-17-01:00pm] Locks: "pending" reply, then "locked" once a GGA is captured.
+ * @since  3.2.2 [2026-10-17-03:30pm] Fail on a task over its stack size, sketch built with warnings on.
+ * @see    sim.h, inoToCpp.py, tests/host/CMakeLists.txt.
+ * @link   http://dougfoster.me.
+ */
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <SD.h>
+#include <SparkFun_u-blox_GNSS_v3.h>
+#include <Wire.h>
+#include "hostTest.h"
+#include "rtcm3Framer.h"
+#include "sessionLog.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+// --- The sketch (DougFoster_Ghost_Rover.ino.cpp). ---
+extern AsyncWebSocket ws;
+extern AsyncWebServer httpServer;
+extern SFE_UBLOX_GNSS roverGNSS;
+void setup();
+void loop();
+
+// --- Rates. ---
+const uint32_t RADIO_BAUD      = 9600;                    // HC-12 (SERIAL1_SPEED).
+const size_t   UART_RX_FIFO    = 120;                     // RX event: FIFO full threshold (bytes) ...
+const uint32_t UART_RX_TIMEOUT = 2;                       // ... or RX timeout (byte times of silence).
+const int64_t  RTCM_EPOCH_US   = 1000000;                 // Base station output interval.
+const uint8_t  WIRE1_SLAVE     = 8;                       // GR-MCU2.
+
+/**
+ * =========================================================================
+ *  Global vars.
+ * =========================================================================
+ */
+
+struct SimOptions {
+    double                   seconds  = 10.0;
+    double                   speed    = 1.0;
+    uint32_t                 corrupt  = 0;
+    bool                     crcOnly  = false;
+    bool                     console  = false;
+    std::string              rtcmFile;
+    std::string              nmeaFile;
+    std::string              logBase;
+    std::string              saveDir;
+    std::vector<std::string> sdDirs;
+};
+
+struct ReplayEpoch {                                      // One burst (RTCM) or one navigation epoch (NMEA).
+    int64_t              atUs;                            // Time from the start of the replay (1x).
+    std::vector<uint8_t> bytes;
+    std::vector<std::pair<size_t, uint16_t>> frames;      // RTCM: end offset & length of each CRC-valid frame.
+};
+
+struct SimLatency {                                       // Samples (us), one stage.
+    const char*          name;
+    std::vector<int64_t> us;
+};
+
+static SimOptions options;
+
+// --- Phases. ---
+static std::atomic<bool>    booted{false};                // setup() done.
+static std::atomic<bool>    browserReady{false};          // Preferences round trip done, NMEA page open.
+static std::atomic<bool>    lockPhase{false};             // Browser: operate page, height & position lock.
+static std::atomic<bool>    httpPhase{false};             // Browser: HTTP checks.
+static std::atomic<bool>    httpDone{false};
+static std::atomic<bool>    feedStop{false};
+static std::atomic<int64_t> feedStartUs{0};
+static std::atomic<int>     feedersRunning{0};
+
+// --- Stage 1. ---
+static std::mutex                              rtcmMutex;
+static std::map<uint64_t, std::deque<int64_t>> rtcmFed;   // (length << 24 | CRC) -> radio arrival times.
+static std::deque<uint8_t>                     zedRx;     // Serial2 bytes not framed yet, & when each left UART2.
+static std::deque<int64_t>                     zedRxUs;
+static uint64_t   fedFrames      = 0;
+static uint64_t   fedCorrupted   = 0;
+static uint64_t   fedBytes       = 0;
+static uint64_t   fedGarbage     = 0;                     // Bytes outside CRC-valid frames (corrupted frames, noise).
+static uint64_t   zedFrames      = 0;                     // Matched to a fed frame.
+static uint64_t   zedUnmatched   = 0;
+static uint64_t   zedCrcBad      = 0;
+static uint64_t   zedBytes       = 0;
+static SimLatency radioToZed     = {"radio -> ZED UART2", {}};
+static uint64_t   relayFrames    = 0;                     // "/metrics": gr_rtcm_frames_total, gr_rtcm_crc_bad_total.
+static uint64_t   relayCrcBad    = 0;
+
+// --- Stage 2. ---
+struct NmeaSent {                                         // Sentence through Wire1.
+    int64_t zedUs;
+    int64_t i2cUs;
+};
+static std::mutex                      nmeaMutex;
+static std::deque<std::pair<std::string, int64_t>> nmeaFed;   // Key (address & first field) -> ZED time.
+static std::map<std::string, NmeaSent> nmeaOut;           // Sentence as sent -> times (latest).
+static uint64_t   fedSentences   = 0;
+static uint64_t   fedNmeaBytes   = 0;
+static uint64_t   i2cSentences   = 0;
+static uint64_t   i2cBytes       = 0;
+static uint64_t   i2cUnmatched   = 0;
+static uint64_t   wsNmeaFrames   = 0;
+static uint64_t   wsUnmatched    = 0;
+static SimLatency zedToI2c       = {"ZED -> I2C", {}};
+static SimLatency i2cToWs        = {"I2C -> WebSocket", {}};
+static SimLatency zedToWs        = {"ZED -> WebSocket", {}};
+
+// --- Browser. ---
+static std::mutex               wsMutex;
+static std::vector<std::string> wsMessages;               // Text frames other than NMEA updates.
+
+/**
+ * =========================================================================
+ *  Functions.
+ * =========================================================================
+ *
+ * @see appendFrame()     - Append one RTCM3 frame.
+ * @see appendNmea()      - Append one NMEA sentence (checksum added).
+ * @see splitRtcm()       - RTCM capture -> epochs.
+ * @see splitNmea()       - NMEA capture -> epochs.
+ * @see ggaToUbx()        - NAV-PVT & NAV-HPPOSLLH from a GGA.
+ * @see radioFeeder()     - Stage 1 source.
+ * @see zedFeeder()       - Stage 2 source.
+ * @see onSerial2()       - Stage 1 sink (the ZED's UART2).
+ * @see onWire1()         - Stage 2 I2C sink (GR-MCU2).
+ * @see onWsFrame()       - Stage 2 browser sink.
+ * @see taskBrowser()     - The browser ("async_tcp").
+ * @see taskLoop()        - Arduino loopTask.
+ */
+
+/**
+ * -------------------------------------------------------------------------
+ *  Append one RTCM3 frame.
+ * -------------------------------------------------------------------------
+ *
+ * @param  vector   out        Epoch bytes.
+ * @param  uint16_t type       Message type.
+ * @param  uint16_t payloadLen Message length (>= 2).
+ * @param  uint32_t* seed      Payload bytes (no 0xD3, so a corrupted frame can't hide a false preamble).
+ * @param  bool     corrupt    Flip a payload byte after the CRC.
+ * @return void     No output is returned.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ */
+static void appendFrame(std::vector<uint8_t>& out, uint16_t type, uint16_t payloadLen, uint32_t* seed, bool corrupt) {
+    size_t at = out.size();
+    out.push_back(RTCM3_PREAMBLE);
+    out.push_back((uint8_t)(payloadLen >> 8));
+    out.push_back((uint8_t)payloadLen);
+    out.push_back((uint8_t)(type >> 4));
+    out.push_back((uint8_t)(((type & 0x0F) << 4) | (hostTestRandom(seed) & 0x0F)));
+    for (uint16_t i = 2; i < payloadLen; i++) {
+        uint8_t b = (uint8_t)hostTestRandom(seed);
+        out.push_back((b == RTCM3_PREAMBLE) ? 0 : b);
+    }
+    uint32_t crc = rtcm3Crc24q(&out[at], out.size() - at);
+    out.push_back((uint8_t)(crc >> 16));
+    out.push_back((uint8_t)(crc >> 8));
+    out.push_back((uint8_t)crc);
+    if (corrupt) {
+        out[at + RTCM3_HEADER_LEN + 2] ^= (out[at + RTCM3_HEADER_LEN + 2] == (RTCM3_PREAMBLE ^ 0x01)) ? 0x02 : 0x01;
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Append one NMEA sentence.
+ * -------------------------------------------------------------------------
+ *
+ * @param  vector      out  Epoch bytes.
+ * @param  const char* body Between '$' & '*'.
+ * @return void        No output is returned.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ */
+static void appendNmea(std::vector<uint8_t>& out, const char* body) {
+    uint8_t sum = 0;
+    char    tail[8];
+    for (const char* c = body; *c != '\0'; c++) {
+        sum ^= (uint8_t)*c;
+    }
+    snprintf(tail, sizeof(tail), "*%02X\r\n", sum);
+    out.push_back('$');
+    out.insert(out.end(), body, body + strlen(body));
+    out.insert(out.end(), tail, tail + strlen(tail));
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Synthetic epochs.
+ * -------------------------------------------------------------------------
+ *
+ * @param  uint32_t    k    Epoch #.
+ * @param  ReplayEpoch epoch Output.
+ * @return void        No output is returned.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ */
+static void syntheticRtcm(uint32_t k, ReplayEpoch* epoch) {
+    static uint32_t seed   = 0x5EED1234;
+    static uint64_t frames = 0;
+    const struct {
+        uint16_t type;
+        uint16_t len;
+        bool     everyTen;
+    } MESSAGES[] = {{1005, 19, true}, {1230, 6, true}, {1074, 180, false}, {1084, 140, false}, {1094, 160, false}, {1124, 150, false}};
+    epoch->atUs = (int64_t)k * RTCM_EPOCH_US;
+    for (auto& message : MESSAGES) {
+        if (message.everyTen && ((k % 10) != 0)) {
+            continue;
+        }
+        frames++;
+        bool corrupt = (options.corrupt > 0) && ((frames % options.corrupt) == 0);
+        appendFrame(epoch->bytes, message.type, message.len, &seed, corrupt);
+        if (corrupt) {
+            fedCorrupted++;
+        } else {
+            epoch->frames.push_back({epoch->bytes.size(), (uint16_t)(RTCM3_HEADER_LEN + message.len + RTCM3_CRC_LEN)});
+        }
+    }
+}
+
+static void syntheticNmea(uint32_t k, uint32_t intervalMs, ReplayEpoch* epoch) {
+    char     body[100];
+    uint32_t ms   = k * intervalMs;
+    uint32_t hh   = (ms / 3600000) % 24;
+    uint32_t mm   = (ms / 60000) % 60;
+    double   ss   = (ms % 60000) / 1000.0;
+    double   drift = (k % 20) * 0.0000001;                  // Minutes of latitude: a few mm.
+    epoch->atUs = (int64_t)ms * 1000;
+    snprintf(body, sizeof(body), "GNGGA,%02u%02u%05.2f,4807.%07.0f,N,01131.0000000,E,4,20,0.5,545.4,M,46.9,M,1.0,0000", hh, mm, ss,
+             (0.038 + drift) * 10000000.0);
+    appendNmea(epoch->bytes, body);
+    snprintf(body, sizeof(body), "GNRMC,%02u%02u%05.2f,A,4807.03800,N,01131.00000,E,0.010,,171026,,,R,V", hh, mm, ss);
+    appendNmea(epoch->bytes, body);
+    appendNmea(epoch->bytes, "GNGSA,A,3,02,05,07,09,13,15,18,20,27,30,,,1.0,0.5,0.8,1");
+    appendNmea(epoch->bytes, "GPGSV,3,1,11,02,40,083,46,05,17,308,41,07,07,344,39,09,22,228,45,1");
+    appendNmea(epoch->bytes, "GPGSV,3,2,11,13,61,123,48,15,33,199,44,18,12,049,36,20,55,271,47,1");
+    appendNmea(epoch->bytes, "GPGSV,3,3,11,27,09,160,33,30,70,302,49,32,05,018,30,1");
+    snprintf(body, sizeof(body), "GNGST,%02u%02u%05.2f,0.5,0.012,0.009,12.5,0.010,0.011,0.018", hh, mm, ss);
+    appendNmea(epoch->bytes, body);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Captures -> epochs.
+ * -------------------------------------------------------------------------
+ *
+ * RTCM: CRC-valid frames are found by length & CRC. Anything else (CRC-bad frames, noise) stays in the
+ * stream in front of the next frame. An epoch ends where a message type repeats. NMEA: an epoch starts
+ * at each sentence with the capture's first address (e.g. "$GNGGA").
+ * Times: one epoch per period, or from the session log index (".idx") when there is one.
+ *
+ * @param  vector  data     Capture.
+ * @param  vector  marks    Index entries (may be empty).
+ * @param  uint8_t stream   LOG_RTCM or LOG_NMEA.
+ * @param  int64_t periodUs Epoch period without an index.
+ * @return vector           Epochs.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ */
+static int64_t epochTime(const std::vector<LogIndexEntry>& marks, uint8_t stream, size_t offset, int64_t previousUs, int64_t periodUs) {
+    for (size_t i = 0; i + 1 < marks.size(); i++) {
+        uint32_t from = marks[i].offset[stream];
+        uint32_t to   = marks[i + 1].offset[stream];
+        if ((offset >= from) && (offset < to)) {
+            return ((int64_t)marks[i].ms + ((int64_t)(offset - from) * (marks[i + 1].ms - marks[i].ms)) / (to - from)) * 1000;
+        }
+    }
+    return (previousUs < 0) ? 0 : previousUs + periodUs;
+}
+
+static std::vector<ReplayEpoch> splitRtcm(const std::vector<uint8_t>& data, const std::vector<LogIndexEntry>& marks) {
+    std::vector<ReplayEpoch> epochs;
+    std::vector<uint16_t>    types;
+    ReplayEpoch              epoch = {-1, {}, {}};
+    size_t                   start = 0;
+    int64_t                  at    = -1;
+    for (size_t i = 0; i + RTCM3_HEADER_LEN + RTCM3_CRC_LEN <= data.size(); ) {
+        size_t len = RTCM3_HEADER_LEN + ((size_t)(data[i + 1] & 0x03) << 8 | data[i + 2]) + RTCM3_CRC_LEN;
+        if ((data[i] != RTCM3_PREAMBLE) || (i + len > data.size()) ||
+            (rtcm3Crc24q(&data[i], len - RTCM3_CRC_LEN) != ((uint32_t)data[i + len - 3] << 16 | (uint32_t)data[i + len - 2] << 8 | data[i + len - 1]))) {
+            i++;
+            continue;
+        }
+        uint16_t type = rtcm3MessageType(&data[i]);
+        if (std::find(types.begin(), types.end(), type) != types.end()) {
+            at = epochTime(marks, LOG_RTCM, start, at, RTCM_EPOCH_US);
+            epoch.atUs = at;
+            epochs.push_back(epoch);
+            epoch = {-1, {}, {}};
+            types.clear();
+            start = epochs.back().bytes.size() + start;
+        }
+        types.push_back(type);
+        epoch.bytes.insert(epoch.bytes.end(), data.begin() + start + epoch.bytes.size(), data.begin() + i + len);
+        epoch.frames.push_back({epoch.bytes.size(), (uint16_t)len});
+        i += len;
+    }
+    epoch.bytes.insert(epoch.bytes.end(), data.begin() + start + epoch.bytes.size(), data.end());
+    if (!epoch.bytes.empty()) {
+        epoch.atUs = epochTime(marks, LOG_RTCM, start, at, RTCM_EPOCH_US);
+        epochs.push_back(epoch);
+    }
+    return epochs;
+}
+
+static std::vector<ReplayEpoch> splitNmea(const std::vector<uint8_t>& data, const std::vector<LogIndexEntry>& marks, int64_t periodUs) {
+    std::vector<ReplayEpoch> epochs;
+    std::string              first;
+    int64_t                  at = -1;
+    for (size_t i = 0; i < data.size(); ) {
+        size_t end = i;
+        while ((end < data.size()) && (data[end] != '\n')) {
+            end++;
+        }
+        end = (end < data.size()) ? end + 1 : end;
+        std::string address((const char*)&data[i], std::min<size_t>(6, end - i));
+        if (first.empty()) {
+            first = address;
+        }
+        if ((address == first) || epochs.empty()) {
+            at = epochTime(marks, LOG_NMEA, i, at, periodUs);
+            epochs.push_back({at, {}, {}});
+        }
+        epochs.back().bytes.insert(epochs.back().bytes.end(), data.begin() + i, data.begin() + end);
+        i = end;
+    }
+    return epochs;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  NAV-PVT & NAV-HPPOSLLH from a GGA.
+ * -------------------------------------------------------------------------
+ *
+ * @param  ReplayEpoch epoch NMEA epoch.
+ * @param  UBX_NAV_PVT_data_t pvt Output.
+ * @param  UBX_NAV_HPPOSLLH_data_t hp Output.
+ * @return bool        false: no GGA in the epoch.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ */
+static bool ggaToUbx(const ReplayEpoch& epoch, UBX_NAV_PVT_data_t* pvt, UBX_NAV_HPPOSLLH_data_t* hp) {
+    std::string text(epoch.bytes.begin(), epoch.bytes.end());
+    size_t      at = text.find("GGA,");
+    if ((at == std::string::npos) || (at < 3)) {
+        return false;
+    }
+    std::vector<std::string> field;
+    size_t                   end = text.find('*', at);
+    std::string              gga = text.substr(at, (end == std::string::npos) ? std::string::npos : end - at);
+    for (size_t from = 0, comma; ; from = comma + 1) {
+        comma = gga.find(',', from);
+        field.push_back(gga.substr(from, (comma == std::string::npos) ? std::string::npos : comma - from));
+        if (comma == std::string::npos) {
+            break;
+        }
+    }
+    if (field.size() < 12) {
+        return false;
+    }
+    double time = atof(field[1].c_str());
+    double lat  = (int)(atof(field[2].c_str()) / 100) + fmod(atof(field[2].c_str()), 100.0) / 60.0;
+    double lon  = (int)(atof(field[4].c_str()) / 100) + fmod(atof(field[4].c_str()), 100.0) / 60.0;
+    int    fix  = atoi(field[6].c_str());
+    double hMsl = atof(field[9].c_str());
+    double h    = hMsl + atof(field[11].c_str());
+    lat = (field[3] == "S") ? -lat : lat;
+    lon = (field[5] == "W") ? -lon : lon;
+    *pvt = {};
+    *hp  = {};
+    pvt->iTOW                = (uint32_t)(((int)time / 10000 * 3600 + ((int)time / 100 % 100) * 60 + fmod(time, 100.0)) * 1000.0);
+    pvt->fixType             = (fix > 0) ? 3 : 0;
+    pvt->flags.bits.gnssFixOK = (fix > 0);
+    pvt->flags.bits.carrSoln = (fix == 4) ? 2 : ((fix == 5) ? 1 : 0);
+    pvt->numSV               = (uint8_t)atoi(field[7].c_str());
+    hp->iTOW     = pvt->iTOW;
+    hp->lat      = (int32_t)(lat * 10000000.0);
+    hp->lon      = (int32_t)(lon * 10000000.0);
+    hp->latHp    = (int8_t)llround(lat * 1000000000.0 - hp->lat * 100.0);
+    hp->lonHp    = (int8_t)llround(lon * 1000000000.0 - hp->lon * 100.0);
+    hp->height   = (int32_t)(h * 1000.0);
+    hp->hMSL     = (int32_t)(hMsl * 1000.0);
+    hp->heightHp = (int8_t)llround(h * 10000.0 - hp->height * 10.0);
+    hp->hMSLHp   = (int8_t)llround(hMsl * 10000.0 - hp->hMSL * 10.0);
+    hp->hAcc     = 140;                                   // 0.1 mm.
+    hp->vAcc     = 210;
+    return true;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Radio feeder (stage 1 source).
+ * -------------------------------------------------------------------------
+ *
+ * Each epoch starts at its time (or when the last one is out) & goes out at the line rate. A frame is
+ * registered when its last byte is on the wire, before the bytes reach the RX buffer.
+ *
+ * @param  vector epochs Capture epochs (empty: synthetic, endless).
+ * @return void   No output is returned.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ */
+static void radioFeeder(std::vector<ReplayEpoch> epochs) {
+    const double byteUs   = 10000000.0 / (RADIO_BAUD * options.speed);
+    const bool   synthetic = epochs.empty();
+    double       lineFree = 0;
+    for (uint32_t k = 0; (!feedStop) && (synthetic || (k < epochs.size())); k++) {
+        ReplayEpoch epoch = {0, {}, {}};
+        if (synthetic) {
+            syntheticRtcm(k, &epoch);
+        } else {
+            epoch = epochs[k];
+        }
+        double start = feedStartUs + epoch.atUs / options.speed;
+        size_t mark  = 0;
+        size_t good  = 0;
+        start = (start > lineFree) ? start : lineFree;
+        for (size_t off = 0; off < epoch.bytes.size(); ) {
+            size_t n = std::min(UART_RX_FIFO, epoch.bytes.size() - off);
+            if ((!simSleepUntilUs((int64_t)(start + (off + n) * byteUs))) || feedStop) {
+                break;
+            }
+            {
+                std::lock_guard<std::mutex> lock(rtcmMutex);
+                for (; (mark < epoch.frames.size()) && (epoch.frames[mark].first <= off + n); mark++) {
+                    size_t   end = epoch.frames[mark].first;
+                    uint16_t len = epoch.frames[mark].second;
+                    uint32_t crc = (uint32_t)epoch.bytes[end - 3] << 16 | (uint32_t)epoch.bytes[end - 2] << 8 | epoch.bytes[end - 1];
+                    rtcmFed[(uint64_t)len << 24 | crc].push_back((int64_t)(start + end * byteUs));
+                    fedFrames++;
+                    good += len;
+                }
+                fedBytes += n;
+            }
+            Serial1.simRxPush(&epoch.bytes[off], n);
+            if (n == UART_RX_FIFO) {
+                Serial1.simRxEvent();
+            }
+            off += n;
+        }
+        fedGarbage += epoch.bytes.size() - good;
+        lineFree    = start + epoch.bytes.size() * byteUs;
+        if (!simSleepUntilUs((int64_t)(lineFree + UART_RX_TIMEOUT * byteUs))) {
+            break;
+        }
+        Serial1.simRxEvent();
+    }
+    feedersRunning--;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  ZED feeder (stage 2 source).
+ * -------------------------------------------------------------------------
+ *
+ * One epoch every navigation interval (/ --speed): its NMEA into the ZED's I2C buffer, then a NAV-PVT &
+ * NAV-HPPOSLLH pair made from its GGA. Each sentence is queued (nmeaFed) before the ZED has it.
+ *
+ * @param  vector epochs Capture epochs (empty: synthetic, endless).
+ * @return void   No output is returned.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ */
+static std::string nmeaKey(const std::string& sentence) {        // Address & first field: unchanged by nmeaRewrite().
+    size_t comma = sentence.find(',');
+    comma        = (comma == std::string::npos) ? comma : sentence.find(',', comma + 1);
+    return sentence.substr(0, comma);
+}
+
+static void zedFeeder(std::vector<ReplayEpoch> epochs) {
+    const uint32_t intervalMs = roverGNSS.simNavIntervalMs();
+    const bool     synthetic  = epochs.empty();
+    for (uint32_t k = 0; (!feedStop) && (synthetic || (k < epochs.size())); k++) {
+        ReplayEpoch epoch = {0, {}, {}};
+        if (synthetic) {
+            syntheticNmea(k, intervalMs, &epoch);
+        } else {
+            epoch = epochs[k];
+        }
+        if ((!simSleepUntilUs((int64_t)(feedStartUs + epoch.atUs / options.speed))) || feedStop) {
+            break;
+        }
+        {
+            std::lock_guard<std::mutex> lock(nmeaMutex);
+            int64_t now = simNowUs();
+            for (size_t at = 0, end; at < epoch.bytes.size(); at = end) {
+                end = std::find(epoch.bytes.begin() + at, epoch.bytes.end(), '\n') - epoch.bytes.begin();
+                end = (end < epoch.bytes.size()) ? end + 1 : end;
+                nmeaFed.push_back({nmeaKey(std::string((const char*)&epoch.bytes[at], end - at)), now});
+                fedSentences++;
+            }
+            fedNmeaBytes += epoch.bytes.size();
+        }
+        roverGNSS.simZedPush(epoch.bytes.data(), epoch.bytes.size());
+        UBX_NAV_PVT_data_t      pvt;
+        UBX_NAV_HPPOSLLH_data_t hp;
+        if (ggaToUbx(epoch, &pvt, &hp)) {
+            roverGNSS.simZedEpoch(pvt, hp);
+        }
+    }
+    feedersRunning--;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Sinks.
+ * -------------------------------------------------------------------------
+ *
+ * onSerial2() - The ZED's UART2: frame by length & CRC, match to the radio feeder's frames (stage 1).
+ * onWire1()   - GR-MCU2 on I2C: ACK, match to the ZED feeder's sentences (stage 2).
+ * onWsFrame() - The browser: NMEA page updates (stage 2), replies kept for taskBrowser().
+ * Sinks run on the sketch's tasks. What they keep isn't the sketch's heap (SimHeapOff).
+ *
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ */
+static void onSerial2(const uint8_t* data, size_t len, int64_t firstDoneUs, int64_t byteUs) {
+    SimHeapOff                  sim;
+    std::lock_guard<std::mutex> lock(rtcmMutex);
+    uint8_t                     frame[RTCM3_MAX_FRAME];
+    for (size_t i = 0; i < len; i++) {
+        zedRx.push_back(data[i]);
+        zedRxUs.push_back(firstDoneUs + (int64_t)i * byteUs);
+    }
+    zedBytes += len;
+    while (zedRx.size() >= RTCM3_HEADER_LEN) {
+        size_t frameLen = RTCM3_HEADER_LEN + ((size_t)(zedRx[1] & 0x03) << 8 | zedRx[2]) + RTCM3_CRC_LEN;
+        if (zedRx[0] != RTCM3_PREAMBLE) {
+            zedRx.pop_front();
+            zedRxUs.pop_front();
+            continue;
+        }
+        if (zedRx.size() < frameLen) {
+            break;
+        }
+        std::copy(zedRx.begin(), zedRx.begin() + frameLen, frame);
+        uint32_t crc = (uint32_t)frame[frameLen - 3] << 16 | (uint32_t)frame[frameLen - 2] << 8 | frame[frameLen - 1];
+        if (rtcm3Crc24q(frame, frameLen - RTCM3_CRC_LEN) != crc) {
+            zedCrcBad++;                                  // The ZED drops it & hunts on.
+            zedRx.pop_front();
+            zedRxUs.pop_front();
+            continue;
+        }
+        auto fed = rtcmFed.find((uint64_t)frameLen << 24 | crc);
+        if ((fed != rtcmFed.end()) && (!fed->second.empty())) {
+            radioToZed.us.push_back(zedRxUs[frameLen - 1] - fed->second.front());
+            fed->second.pop_front();
+            zedFrames++;
+        } else {
+            zedUnmatched++;
+        }
+        zedRx.erase(zedRx.begin(), zedRx.begin() + frameLen);
+        zedRxUs.erase(zedRxUs.begin(), zedRxUs.begin() + frameLen);
+    }
+}
+
+static uint8_t onWire1(uint16_t address, const uint8_t* data, size_t len) {
+    SimHeapOff                  sim;
+    int64_t                     now = simNowUs();
+    std::string                 sentence((const char*)data, len);
+    std::string                 key = nmeaKey(sentence);
+    std::lock_guard<std::mutex> lock(nmeaMutex);
+    if (address != WIRE1_SLAVE) {
+        return 2;                                         // NACK: nobody at that address.
+    }
+    i2cSentences++;
+    i2cBytes += len;
+    while ((!nmeaFed.empty()) && (nmeaFed.front().first != key)) {
+        nmeaFed.pop_front();                              // Dropped (checksum, ZED buffer full).
+    }
+    if (nmeaFed.empty()) {
+        i2cUnmatched++;
+        return 0;
+    }
+    zedToI2c.us.push_back(now - nmeaFed.front().second);
+    nmeaOut[sentence] = {nmeaFed.front().second, now};
+    nmeaFed.pop_front();
+    return 0;
+}
+
+static void onWsFrame(uint32_t id, uint8_t opcode, const uint8_t* data, size_t len) {
+    SimHeapOff  sim;
+    int64_t     now = simNowUs();
+    std::string message((const char*)data, len);
+    size_t      at  = message.find("\"NMEA\":\"");
+    (void)id;
+    if (opcode != WS_TEXT) {
+        return;
+    }
+    if (message.find("Resp\"") != std::string::npos) {
+        std::lock_guard<std::mutex> lock(wsMutex);
+        wsMessages.push_back(message);
+    }
+    if (at == std::string::npos) {
+        return;
+    }
+    std::string sentence;
+    if (message[at + 8] == '"') {
+        return;                                           // Nothing sent yet.
+    }
+    for (at += 8; (at < message.size()) && (message[at] != '"'); at++) {
+        if ((message[at] == '\\') && (at + 1 < message.size())) {
+            at++;
+            sentence += (message[at] == 'r') ? '\r' : ((message[at] == 'n') ? '\n' : ((message[at] == 't') ? '\t' : message[at]));
+        } else {
+            sentence += message[at];
+        }
+    }
+    std::lock_guard<std::mutex> lock(nmeaMutex);
+    auto sent = nmeaOut.find(sentence);
+    wsNmeaFrames++;
+    if (sent == nmeaOut.end()) {
+        wsUnmatched++;
+        return;
+    }
+    i2cToWs.us.push_back(now - sent->second.i2cUs);
+    zedToWs.us.push_back(now - sent->second.zedUs);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Browser ("async_tcp" task: AsyncTCP runs the WebSocket & HTTP handlers).
+ * -------------------------------------------------------------------------
+ *
+ * Preferences round trip, echo & the NMEA page, then the operate page with height & position lock,
+ * then HTTP ("/metrics", "/", asset cache).
+ *
+ * @param  void* param Not used.
+ * @return void  No output is returned (endless, ends with simStop()).
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ */
+static std::string browserAsk(uint32_t id, const char* message, const char* reply, uint32_t timeoutMs) {
+    size_t seen = 0;                                      // NULL message: wait for a reply already on its way.
+    if (message != NULL) {
+        {
+            std::lock_guard<std::mutex> lock(wsMutex);
+            seen = wsMessages.size();
+        }
+        ws.simText(id, message);
+    }
+    for (uint32_t waited = 0; waited < timeoutMs; waited += 10) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+        std::lock_guard<std::mutex> lock(wsMutex);
+        for (; seen < wsMessages.size(); seen++) {
+            if (wsMessages[seen].find(reply) != std::string::npos) {
+                return wsMessages[seen];
+            }
+        }
+    }
+    fprintf(stderr, "simRover: no \"%s\" for %s\n", reply, (message != NULL) ? message : "(wait)");
+    return std::string();
+}
+
+static std::string jsonField(const std::string& message, const char* key, bool asText = false) {   // Raw value, or always "text".
+    std::string name = std::string("\"") + key + "\":";
+    size_t      at   = message.find(name);
+    if (at == std::string::npos) {
+        return "\"\"";
+    }
+    size_t end = at += name.size();
+    if (message[at] == '"') {
+        for (end = at + 1; (end < message.size()) && (message[end] != '"'); end += (message[end] == '\\') ? 2 : 1) {
+        }
+        end++;
+    } else {
+        end = message.find_first_of(",}", at);
+        if (asText) {
+            return "\"" + message.substr(at, end - at) + "\"";          // setPrefs takes numbers as text.
+        }
+    }
+    return message.substr(at, end - at);
+}
+
+static void taskBrowser(void* param) {
+    (void)param;
+    char        message[512];
+    uint32_t    id    = ws.simConnect(IPAddress(192, 168, 4, 2));
+    std::string prefs = browserAsk(id, "{\"page\":\"config\",\"sendPrefs\":true}", "sendPrefsResp", 2000);
+    CHECK(!prefs.empty());
+
+    // --- Preferences: NTRIP caster profile, then all (same ZED rates, new instrument height), then read back. ---
+    CHECK(!browserAsk(id, "{\"page\":\"config\",\"setNtripCasterPref\":\"{\\\"43\\\":\\\"1\\\",\\\"44\\\":\\\"sim\\\","
+                          "\\\"45\\\":\\\"caster.invalid\\\",\\\"46\\\":\\\"SIM\\\",\\\"47\\\":\\\"2101\\\",\\\"48\\\":\\\"2\\\","
+                          "\\\"49\\\":\\\"user\\\",\\\"50\\\":\\\"pass\\\",\\\"51\\\":false,\\\"53\\\":\\\"10\\\"}\"}",
+                      "setNtripCasterPrefResp", 5000).empty());
+    snprintf(message, sizeof(message), "{\"page\":\"config\",\"setPrefs\":true,\"1\":%s,\"2\":\"radio\",\"4\":%s,\"5\":%s,"
+             "\"6\":%s,\"7\":%s,\"36\":\"150\",\"42\":%s}", jsonField(prefs, "1", true).c_str(), jsonField(prefs, "4", true).c_str(),
+             jsonField(prefs, "5", true).c_str(), jsonField(prefs, "6", true).c_str(), jsonField(prefs, "7", true).c_str(), jsonField(prefs, "42", true).c_str());
+    CHECK(!browserAsk(id, message, "setPrefsResp", 5000).empty());
+    prefs = browserAsk(id, "{\"page\":\"config\",\"sendPrefs\":true}", "sendPrefsResp", 2000);
+    CHECK(jsonField(prefs, "36") == "150");
+    CHECK(jsonField(prefs, "2") == "\"radio\"");
+    CHECK(jsonField(prefs, "39").find("caster.invalid") != std::string::npos);
+    CHECK(jsonField(browserAsk(id, "{\"echo\":\"sim 1\"}", "echoResp", 2000), "echo") == "\"sim 1\"");
+
+    // --- NMEA page (stage 2), then operate page & locks. ---
+    ws.simText(id, "{\"page\":\"nmea\"}");
+    browserReady = true;
+    while (!lockPhase) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    CHECK(browserAsk(id, "{\"page\":\"operate\",\"heightLock\":true}", "heightLockResp", 2000).find("pending") != std::string::npos);
+    CHECK(browserAsk(id, "{\"page\":\"operate\",\"positionLock\":true}", "positionLockResp", 2000).find("pending") != std::string::npos);
+    CHECK(!browserAsk(id, NULL, "Height locked.", 5000).empty());        // Next GGA with a fix.
+    CHECK(!browserAsk(id, NULL, "Position locked.", 5000).empty());
+
+    // --- HTTP. ---
+    while (!httpPhase) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    AsyncWebServerRequest metrics(HTTP_GET, "/metrics");
+    httpServer.simRequest(&metrics);
+    CHECK(metrics.simResponse()->simCode() == 200);
+    const std::string& text = metrics.simResponse()->simBody();
+    size_t at = text.find("gr_rtcm_frames_total ");
+    relayFrames = (at == std::string::npos) ? 0 : strtoull(text.c_str() + at + 21, NULL, 10);
+    at = text.find("gr_rtcm_crc_bad_total ");
+    relayCrcBad = (at == std::string::npos) ? 0 : strtoull(text.c_str() + at + 22, NULL, 10);
+    AsyncWebServerRequest index(HTTP_GET, "/");
+    httpServer.simRequest(&index);
+    CHECK(index.simResponse()->simCode() == 200);
+    if (SD.exists("/assets.txt")) {
+        AsyncWebServerRequest asset(HTTP_GET, "/global.js");
+        asset.simHeader("Accept-Encoding", "gzip, deflate, br");
+        httpServer.simRequest(&asset);
+        String etag = asset.simResponse()->simHeader("ETag");
+        CHECK(asset.simResponse()->simCode() == 200);
+        CHECK(etag.length() > 0);
+        AsyncWebServerRequest again(HTTP_GET, "/global.js");
+        again.simHeader("Accept-Encoding", "gzip");
+        again.simHeader("If-None-Match", etag);
+        httpServer.simRequest(&again);
+        CHECK(again.simResponse()->simCode() == 304);
+    }
+    ws.simDisconnect(id);
+    httpDone = true;
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Arduino loopTask: setup(), then loop() for ever.
+ * -------------------------------------------------------------------------
+ *
+ * @param  void* param Not used.
+ * @return void  No output is returned (ends with simStop()).
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ */
+static void taskLoop(void* param) {
+    (void)param;
+    setup();
+    simBootDone();
+    booted = true;
+    for (;;) {
+        loop();
+        if (simStopping) {
+            throw SimTaskExit();
+        }
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Report.
+ * -------------------------------------------------------------------------
+ *
+ * report() flags a task whose host stack use is over its ESP-IDF stack size ("OVER") & returns how many:
+ * host frames aren't Xtensa frames, but a task that deep here needs a look on the device.
+ *
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @since  3.2.2 [2026-10-17-03:30pm] Flag stack use over the ESP-IDF stack size.
+ */
+static void printLatency(SimLatency* stage) {
+    std::vector<int64_t>& us = stage->us;
+    size_t                n  = us.size();
+    std::sort(us.begin(), us.end());
+    if (n == 0) {
+        printf("    %-20s no samples\n", stage->name);
+        return;
+    }
+    printf("    %-20s us p50 %lld, p95 %lld, p99 %lld, max %lld (n=%zu)\n", stage->name, (long long)us[n / 2],
+           (long long)us[std::min(n - 1, n * 95 / 100)], (long long)us[std::min(n - 1, n * 99 / 100)], (long long)us[n - 1], n);
+}
+
+static size_t report(double seconds) {
+    SimHeapStats heap = simHeapStats();
+    SimTaskStats tasks[SIM_MAX_TASKS];
+    size_t       numTasks = simTaskStats(tasks, SIM_MAX_TASKS);
+    printf("simRover: %.1f s replayed at %gx (%.1f s), %s, RTCM %s, NMEA %s.\n", seconds * options.speed, options.speed, seconds,
+           options.crcOnly ? "rtcmCrcOnly" : "pass-through",
+           !options.logBase.empty() ? "session log" : (!options.rtcmFile.empty() ? options.rtcmFile.c_str() : "synthetic"),
+           !options.logBase.empty() ? "session log" : (!options.nmeaFile.empty() ? options.nmeaFile.c_str() : "synthetic"));
+    printf("  Stage 1 radio -> ZED: fed %llu frames + %llu other bytes (%llu corrupted frames), %.0f B/s; relay framed %llu, CRC-bad %llu;\n"
+           "    ZED got %llu (%.1f frames/s, %.0f B/s), CRC-bad %llu, unmatched %llu, lost %llu; Serial1 RX overflow %llu bytes.\n",
+           (unsigned long long)fedFrames, (unsigned long long)fedGarbage, (unsigned long long)fedCorrupted, fedBytes / seconds,
+           (unsigned long long)relayFrames, (unsigned long long)relayCrcBad, (unsigned long long)zedFrames, zedFrames / seconds,
+           zedBytes / seconds, (unsigned long long)zedCrcBad, (unsigned long long)zedUnmatched,
+           (unsigned long long)(fedFrames - zedFrames), (unsigned long long)Serial1.simRxDropped);
+    printLatency(&radioToZed);
+    printf("  Stage 2 ZED -> I2C -> browser: fed %llu sentences (%.0f B/s), ZED overflow %llu bytes; I2C %llu (%.1f/s, %.0f B/s), "
+           "unmatched %llu; browser %llu NMEA frames, unmatched %llu.\n",
+           (unsigned long long)fedSentences, fedNmeaBytes / seconds, (unsigned long long)roverGNSS.simZedDropped,
+           (unsigned long long)i2cSentences, i2cSentences / seconds, i2cBytes / seconds, (unsigned long long)i2cUnmatched,
+           (unsigned long long)wsNmeaFrames, (unsigned long long)wsUnmatched);
+    printLatency(&zedToI2c);
+    printLatency(&i2cToWs);
+    printLatency(&zedToWs);
+    printf("  Heap: internal peak %lld bytes (%lld at end) of %zu, PSRAM peak %lld bytes.\n", (long long)heap.peak,
+           (long long)heap.inUse, SIM_HEAP_SIZE, (long long)heap.psramPeak);
+    size_t over = 0;
+    printf("  Stack (host bytes, indicative):");
+    for (size_t i = 0; i < numTasks; i++) {
+        printf("%s %s %u/%u%s", (i == 0) ? "" : ",", tasks[i].name, tasks[i].stackUsed, tasks[i].stackSize,
+               (tasks[i].stackUsed > tasks[i].stackSize) ? " OVER" : "");
+        over += (tasks[i].stackUsed > tasks[i].stackSize) ? 1 : 0;
+    }
+    printf(".\n");
+    return over;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Files.
+ * -------------------------------------------------------------------------
+ *
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ */
+static bool readFile(const std::string& path, std::vector<uint8_t>* data) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == NULL) {
+        return false;
+    }
+    uint8_t chunk[4096];
+    size_t  n;
+    data->clear();
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        data->insert(data->end(), chunk, chunk + n);
+    }
+    fclose(file);
+    return true;
+}
+
+static void loadCard(const std::string& dir) {
+    DIR* found = opendir(dir.c_str());
+    if (found == NULL) {
+        fprintf(stderr, "simRover: no directory %s\n", dir.c_str());
+        hostTestFailures++;
+        return;
+    }
+    std::vector<uint8_t> data;
+    for (struct dirent* entry; (entry = readdir(found)) != NULL; ) {
+        struct stat info;
+        std::string path = dir + "/" + entry->d_name;
+        if ((entry->d_name[0] != '.') && (stat(path.c_str(), &info) == 0) && S_ISREG(info.st_mode) && readFile(path, &data)) {
+            SD.simPut(std::string("/") + entry->d_name, data);
+        }
+    }
+    closedir(found);
+}
+
+static void simCommand(const char* command) {             // USB serial command, consumed by checkSerialUSB().
+    Serial.simRxPush((const uint8_t*)command, strlen(command));
+    while (Serial.available() > 0) {
+        simSleepUntilUs(simNowUs() + 1000);
+    }
+    simSleepUntilUs(simNowUs() + 50000);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Main.
+ * -------------------------------------------------------------------------
+ *
+ * @return int # of failed checks.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ */
+int main(int argc, char** argv) {
+
+    // --- Options. ---
+    for (int i = 1; i < argc; i++) {
+        std::string arg   = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : "";
+        if (arg == "--crc-only") {
+            options.crcOnly = true;
+        } else if (arg == "--console") {
+            options.console = true;
+        } else if ((arg == "--seconds") || (arg == "--speed") || (arg == "--corrupt") || (arg == "--rtcm") || (arg == "--nmea") ||
+                   (arg == "--log") || (arg == "--sd") || (arg == "--save")) {
+            i++;
+            if (arg == "--seconds")      { options.seconds = atof(value); }
+            else if (arg == "--speed")   { options.speed   = atof(value); }
+            else if (arg == "--corrupt") { options.corrupt = (uint32_t)atoi(value); }
+            else if (arg == "--rtcm")    { options.rtcmFile = value; }
+            else if (arg == "--nmea")    { options.nmeaFile = value; }
+            else if (arg == "--log")     { options.logBase  = value; }
+            else if (arg == "--sd")      { options.sdDirs.push_back(value); }
+            else                         { options.saveDir  = value; }
+        } else {
+            fprintf(stderr, "Usage: %s [--seconds S] [--speed N] [--corrupt N] [--crc-only] [--rtcm file] [--nmea file] "
+                            "[--log dir/logNNNN] [--sd dir]... [--save dir] [--console]\n", argv[0]);
+            return 1;
+        }
+    }
+    if ((options.seconds <= 0) || (options.speed <= 0)) {
+        fprintf(stderr, "simRover: --seconds & --speed must be > 0.\n");
+        return 1;
+    }
+
+    // --- Card & captures. ---
+    std::vector<uint8_t>       rtcmData;
+    std::vector<uint8_t>       nmeaData;
+    std::vector<uint8_t>       indexData;
+    std::vector<LogIndexEntry> marks;
+    for (auto& dir : options.sdDirs) {
+        loadCard(dir);
+    }
+    if (!options.logBase.empty()) {
+        options.rtcmFile = options.logBase + ".rtcm";
+        options.nmeaFile = options.logBase + ".nmea";
+        if (readFile(options.logBase + ".idx", &indexData)) {
+            marks.resize(indexData.size() / sizeof(LogIndexEntry));
+            memcpy(marks.data(), indexData.data(), marks.size() * sizeof(LogIndexEntry));
+        }
+    }
+    if ((!options.rtcmFile.empty() && !readFile(options.rtcmFile, &rtcmData)) || (!options.nmeaFile.empty() && !readFile(options.nmeaFile, &nmeaData))) {
+        fprintf(stderr, "simRover: can't read %s / %s\n", options.rtcmFile.c_str(), options.nmeaFile.c_str());
+        return 1;
+    }
+
+    // --- Wires. ---
+    Serial.simTx = [](const uint8_t* data, size_t len, int64_t, int64_t) {
+        if (options.console) {
+            fwrite(data, 1, len, stdout);
+        }
+    };
+    Serial2.simTx = onSerial2;
+    Wire1.simTx   = onWire1;
+    ws.simRx      = onWsFrame;
+
+    // --- Boot. ---
+    simTaskCreate(taskLoop, "loopTask", 8192, NULL);      // Arduino-ESP32 CONFIG_ARDUINO_LOOP_STACK_SIZE.
+    for (int waited = 0; (!booted) && (waited < 3000); waited++) {
+        simSleepUntilUs(simNowUs() + 10000);
+    }
+    CHECK(booted);
+    if (!booted) {
+        return hostTestFailures;
+    }
+    simCommand("logSession\n");
+    if (options.crcOnly) {
+        simCommand("rtcmCrcOnly\n");
+    }
+    simTaskCreate(taskBrowser, "async_tcp", 16384, NULL); // CONFIG_ASYNC_TCP_STACK_SIZE (AsyncTCP 3.x: 8192 x 2).
+    for (int waited = 0; (!browserReady) && (waited < 3000); waited++) {
+        simSleepUntilUs(simNowUs() + 10000);
+    }
+    CHECK(browserReady);
+
+    // --- Replay. ---
+    const int64_t            navUs       = (int64_t)roverGNSS.simNavIntervalMs() * 1000;
+    std::vector<ReplayEpoch> rtcmEpochs  = rtcmData.empty() ? std::vector<ReplayEpoch>() : splitRtcm(rtcmData, marks);
+    std::vector<ReplayEpoch> nmeaEpochs  = nmeaData.empty() ? std::vector<ReplayEpoch>() : splitNmea(nmeaData, marks, navUs);
+    double                   replayUs    = options.seconds * 1000000;
+    if (!nmeaEpochs.empty()) {
+        replayUs = std::min(replayUs, (double)nmeaEpochs.back().atUs);       // Locks need GGAs after them.
+    }
+    feedStartUs          = simNowUs() + 100000;
+    feedersRunning       = 2;
+    std::thread radio(radioFeeder, rtcmEpochs);
+    std::thread zed(zedFeeder, nmeaEpochs);
+    const int64_t endUs  = feedStartUs + (int64_t)(options.seconds * 1000000 / options.speed);
+    const int64_t lockUs = feedStartUs + (int64_t)(replayUs * 0.75 / options.speed);
+    while ((simNowUs() < endUs) && (feedersRunning > 0)) {
+        lockPhase = lockPhase || (simNowUs() >= lockUs);
+        simSleepUntilUs(simNowUs() + 10000);
+    }
+    double seconds = (simNowUs() - feedStartUs) / 1000000.0;
+    feedStop  = true;
+    lockPhase = true;
+    radio.join();
+    zed.join();
+    simSleepUntilUs(simNowUs() + 1500000);                // Drain: relay, ZED UART2, I2C, browser.
+    httpPhase = true;
+    for (int waited = 0; (!httpDone) && (waited < 3000); waited++) {
+        simSleepUntilUs(simNowUs() + 10000);
+    }
+    CHECK(httpDone);
+    simCommand("logSession\n");                           // Close the session log.
+    simSleepUntilUs(simNowUs() + 500000);
+    simStop();
+    simTaskJoinAll();
+
+    // --- Session log. ---
+    std::vector<uint8_t> data;
+    size_t               logFiles = 0;
+    for (auto& path : SD.simList()) {
+        if ((path.compare(0, 4, "/log") != 0) || (!SD.simGet(path, &data))) {
+            continue;
+        }
+        logFiles += (data.size() > 0) ? 1 : 0;
+        if ((path.size() > 4) && (path.compare(path.size() - 4, 4, ".idx") == 0)) {
+            CHECK((data.size() % sizeof(LogIndexEntry)) == 0);
+        }
+        if (!options.saveDir.empty()) {
+            mkdir(options.saveDir.c_str(), 0755);
+            FILE* file = fopen((options.saveDir + path).c_str(), "wb");
+            CHECK(file != NULL);
+            if (file != NULL) {
+                fwrite(data.data(), 1, data.size(), file);
+                fclose(file);
+            }
+        }
+    }
+    CHECK(logFiles >= 3);                                 // .idx, .rtcm, .nmea (.ubx is empty without UBX).
+
+    // --- Report & checks. ---
+    CHECK(report(seconds) == 0);                          // No task deeper than its ESP-IDF stack.
+    CHECK(simRestarts == 0);
+    CHECK(fedFrames > 0);
+    CHECK(zedUnmatched == 0);
+    if (Serial1.simRxDropped == 0) {
+        CHECK(zedFrames == fedFrames);                    // Nothing lost, both modes.
+        CHECK(relayFrames == fedFrames);
+    }
+    if (options.crcOnly) {
+        CHECK(zedCrcBad == 0);                            // Only CRC-valid frames reach the ZED.
+    } else {
+        CHECK(zedCrcBad == relayCrcBad);                  // Every CRC-bad frame the relay saw, passed on.
+    }
+    CHECK((fedGarbage == 0) || (relayCrcBad > 0));    // Bad frames & noise are seen, whatever the mode.
+    CHECK(i2cSentences > 0);
+    CHECK(i2cUnmatched == 0);
+    CHECK(wsNmeaFrames > 0);
+    CHECK(wsUnmatched == 0);
+    return hostTestFailures;
+}
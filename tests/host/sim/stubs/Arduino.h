@@ -0,0 +1,246 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: Arduino-ESP32 core.
+ * *************************************************************************
+ *
+ * Arduino.h
+ *
+ * The part of the arduino-esp32 core the sketch uses: String, Print, HardwareSerial (Serial, Serial1, Serial2),
+ * pins & the RGB LED, timing, IPAddress, ESP, heap_caps_malloc(), esp_timer_get_time().
+ *
+ * HardwareSerial has a sim side: simRxPush() is the wire into the RX buffer (256 bytes, overflow dropped &
+ * counted like the UART driver), simRxEvent() runs the onReceive() callback (FIFO full or RX timeout), and
+ * simTx gets every byte written, with the time it leaves the UART at the set baud rate. write() blocks while
+ * more than SIM_UART_TX_FIFO bytes wait, like uart_write_bytes() with no TX ring buffer.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    sim.h, sim.cpp.
+ * @link   https://github.com/espressif/arduino-esp32/tree/master/cores/esp32.
+ */
+
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <sys/types.h>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include "sim.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+// --- Constants. ---
+#define HIGH            0x1
+#define LOW             0x0
+#define INPUT           0x01
+#define OUTPUT          0x03
+#define INPUT_PULLUP    0x05
+#define LED_BUILTIN     97                                // RGB_BUILTIN (SOC_GPIO_PIN_COUNT + 48).
+#define SERIAL_8N1      0x800001c
+
+const size_t SIM_UART_RX_BUFFER = 256;                    // HardwareSerial RX buffer (arduino-esp32 default).
+const size_t SIM_UART_TX_FIFO   = 128;                    // UART hardware TX FIFO.
+
+// --- C library gaps (glibc < 2.38). ---
+size_t strlcpy(char* dest, const char* src, size_t size);
+size_t strlcat(char* dest, const char* src, size_t size);
+
+/**
+ * -------------------------------------------------------------------------
+ *  String (std::string underneath).
+ * -------------------------------------------------------------------------
+ */
+class String {
+public:
+    String() {}
+    String(const char* text) : text_(text != NULL ? text : "") {}
+    String(const std::string& text) : text_(text) {}
+    String(char c) : text_(1, c) {}
+    explicit String(int value) : text_(std::to_string(value)) {}
+    explicit String(unsigned int value) : text_(std::to_string(value)) {}
+    explicit String(long value) : text_(std::to_string(value)) {}
+    explicit String(unsigned long value) : text_(std::to_string(value)) {}
+
+    const char*  c_str() const                            { return text_.c_str(); }
+    unsigned int length() const                           { return (unsigned int)text_.size(); }
+    bool         isEmpty() const                          { return text_.empty(); }
+    char         operator[](unsigned int i) const         { return (i < text_.size()) ? text_[i] : '\0'; }
+    char         charAt(unsigned int i) const             { return (*this)[i]; }
+    long         toInt() const                            { return atol(text_.c_str()); }
+    float        toFloat() const                          { return (float)atof(text_.c_str()); }
+    bool         endsWith(const String& s) const          { return (text_.size() >= s.text_.size()) && (text_.compare(text_.size() - s.text_.size(), s.text_.size(), s.text_) == 0); }
+    bool         startsWith(const String& s) const        { return text_.compare(0, s.text_.size(), s.text_) == 0; }
+    int          indexOf(char c, unsigned int from = 0) const          { return find(text_.find(c, from)); }
+    int          indexOf(const String& s, unsigned int from = 0) const { return find(text_.find(s.text_, from)); }
+    int          lastIndexOf(char c) const                { return find(text_.rfind(c)); }
+    int          lastIndexOf(const String& s) const       { return find(text_.rfind(s.text_)); }
+    String       substring(unsigned int from) const       { return (from < text_.size()) ? String(text_.substr(from)) : String(); }
+    String       substring(unsigned int from, unsigned int to) const {
+        return (from < to) && (from < text_.size()) ? String(text_.substr(from, to - from)) : String();
+    }
+    void         toLowerCase()                            { for (char& c : text_) { c = (char)tolower(c); } }
+    void         toUpperCase()                            { for (char& c : text_) { c = (char)toupper(c); } }
+    String&      operator+=(const String& s)              { text_ += s.text_; return *this; }
+    String&      operator+=(const char* s)                { text_ += (s != NULL) ? s : ""; return *this; }
+    String&      operator+=(char c)                       { text_ += c; return *this; }
+    bool         operator==(const String& s) const        { return text_ == s.text_; }
+    bool         operator==(const char* s) const          { return text_ == ((s != NULL) ? s : ""); }
+    bool         operator!=(const String& s) const        { return text_ != s.text_; }
+    bool         operator!=(const char* s) const          { return !(*this == s); }
+    bool         operator<(const String& s) const         { return text_ < s.text_; }
+    friend String operator+(const String& a, const String& b)   { return String(a.text_ + b.text_); }
+    friend String operator+(const String& a, const char* b)     { return String(a.text_ + ((b != NULL) ? b : "")); }
+    friend String operator+(const char* a, const String& b)     { return String(((a != NULL) ? a : "") + b.text_); }
+    friend String operator+(const String& a, char b)            { return String(a.text_ + b); }
+
+private:
+    static int find(size_t at)                            { return (at == std::string::npos) ? -1 : (int)at; }
+    std::string text_;
+};
+
+/**
+ * -------------------------------------------------------------------------
+ *  Print.
+ * -------------------------------------------------------------------------
+ */
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* data, size_t len) {
+        size_t n = 0;
+        while ((n < len) && (write(data[n]) == 1)) {
+            n++;
+        }
+        return n;
+    }
+    size_t write(const char* text)                        { return (text == NULL) ? 0 : write((const uint8_t*)text, strlen(text)); }
+    size_t write(const char* data, size_t len)            { return write((const uint8_t*)data, len); }
+
+    size_t print(const char* text)                        { return write(text); }
+    size_t print(const String& text)                      { return write(text.c_str()); }
+    size_t print(char c)                                  { return write((uint8_t)c); }
+    size_t print(int value)                               { return printf("%d", value); }
+    size_t print(unsigned int value)                      { return printf("%u", value); }
+    size_t print(long value)                              { return printf("%ld", value); }
+    size_t print(unsigned long value)                     { return printf("%lu", value); }
+    size_t print(long long value)                         { return printf("%lld", value); }
+    size_t print(unsigned long long value)                { return printf("%llu", value); }
+    size_t print(double value, int digits = 2)            { return printf("%.*f", digits, value); }
+    size_t println()                                      { return write("\r\n"); }
+    template <typename T>
+    size_t println(T value)                               { size_t n = print(value); return n + println(); }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    size_t readBytesUntil(char terminator, char* buffer, size_t length);
+};
+
+/**
+ * -------------------------------------------------------------------------
+ *  HardwareSerial (UART, USB CDC).
+ * -------------------------------------------------------------------------
+ */
+class HardwareSerial : public Stream {
+public:
+    explicit HardwareSerial(const char* name) : name_(name) {}
+    void   begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1);
+    void   end()                                          {}
+    int    available() override;
+    int    read() override;
+    size_t read(uint8_t* buffer, size_t size);
+    size_t read(char* buffer, size_t size)                { return read((uint8_t*)buffer, size); }
+    size_t write(uint8_t c) override                      { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t len) override;
+    using  Print::write;
+    void   flush()                                        {}
+    void   onReceive(std::function<void()> callback, bool onlyOnTimeout = false);
+    operator bool() const                                 { return true; }
+
+    // -- Sim side. --
+    size_t   simRxPush(const uint8_t* data, size_t len);  // Wire -> RX buffer. Returns bytes taken, the rest is dropped (counted).
+    size_t   simRxFree();                                 // RX buffer space (bytes).
+    void     simRxEvent();                                // UART RX interrupt: run the onReceive() callback.
+    uint32_t simBaud()                                    { return baud_; }
+    uint64_t simRxDropped = 0;                            // RX buffer overflow (bytes).
+    std::function<void(const uint8_t* data, size_t len, int64_t firstDoneUs, int64_t byteUs)> simTx;   // TX bytes & when they leave (us).
+
+private:
+    const char*             name_;
+    uint32_t                baud_      = 0;
+    int64_t                 txFreeAt_  = 0;               // Time (us) the last byte written leaves the UART.
+    std::mutex              mutex_;
+    std::deque<uint8_t>     rx_;
+    std::function<void()>   onReceive_;
+};
+
+extern HardwareSerial Serial;                             // USB CDC: console & commands (checkSerialUSB()).
+extern HardwareSerial Serial1;                            // UART1: HC-12 radio.
+extern HardwareSerial Serial2;                            // UART2: ZED-F9P UART2 (RTCM in).
+
+// --- Pins & RGB LED. ---
+struct SimLed {                                           // Last rgbLedWrite().
+    uint8_t red, green, blue;
+    uint32_t writes;
+};
+extern SimLed simLed;
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int  digitalRead(uint8_t pin);
+void rgbLedWrite(uint8_t pin, uint8_t red, uint8_t green, uint8_t blue);
+
+// --- Timing. ---
+static inline void          delay(uint32_t ms)            { simDelayUs((int64_t)ms * 1000); }
+static inline void          delayMicroseconds(uint32_t us) { simBusyUs(us); }
+static inline unsigned long millis()                      { return (unsigned long)(simNowUs() / 1000); }
+static inline unsigned long micros()                      { return (unsigned long)simNowUs(); }
+
+/**
+ * -------------------------------------------------------------------------
+ *  IPAddress (IPv4).
+ * -------------------------------------------------------------------------
+ */
+class IPAddress {
+public:
+    IPAddress() : octet_{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : octet_{a, b, c, d} {}
+    IPAddress(uint32_t address)                           { memcpy(octet_, &address, 4); }
+    uint8_t  operator[](int i) const                      { return octet_[i]; }
+    operator uint32_t() const                             { uint32_t address; memcpy(&address, octet_, 4); return address; }
+    bool     fromString(const char* text) {
+        unsigned int a, b, c, d;
+        char         extra;
+        if ((text == NULL) || (sscanf(text, "%u.%u.%u.%u%c", &a, &b, &c, &d, &extra) != 4) || (a > 255) || (b > 255) || (c > 255) || (d > 255)) {
+            return false;
+        }
+        *this = IPAddress(a, b, c, d);
+        return true;
+    }
+    String   toString() const {
+        char text[16];
+        snprintf(text, sizeof(text), "%u.%u.%u.%u", octet_[0], octet_[1], octet_[2], octet_[3]);
+        return String(text);
+    }
+
+private:
+    uint8_t octet_[4];
+};
+
+#endif
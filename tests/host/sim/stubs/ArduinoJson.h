@@ -0,0 +1,466 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: ArduinoJson 7.
+ * *************************************************************************
+ *
+ * ArduinoJson.h
+ *
+ * The part of ArduinoJson 7 the sketch uses, same results: a document is an object of members in insertion
+ * order, doc["key"] reads (NULL / default if missing) & writes (copies strings & variants in), is<JsonVariant>()
+ * is "key present", as<bool>() is true for a string, serializeJson() truncates & always terminates.
+ * Numbers: integers stay integers, float keeps 7 significant digits, double 15. Memory comes from malloc()
+ * (counted by the sim heap, like the library's default allocator).
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    sim.h.
+ * @link   https://arduinojson.org/v7/api/.
+ */
+
+#ifndef SIM_ARDUINOJSON_H
+#define SIM_ARDUINOJSON_H
+
+#include <Arduino.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+struct JsonNode {                                         // One value.
+    enum Type : uint8_t { NUL, BOOL, INT, UINT, FLOAT, DOUBLE, STRING, OBJECT, ARRAY };
+    Type                     type = NUL;
+    bool                     b    = false;
+    int64_t                  i    = 0;
+    uint64_t                 u    = 0;
+    double                   f    = 0;
+    std::string              s;
+    std::vector<std::string> keys;                        // OBJECT (values[] in step).
+    std::vector<JsonNode>    values;                      // OBJECT, ARRAY.
+
+    JsonNode* member(const char* key) {
+        for (size_t n = 0; n < keys.size(); n++) {
+            if (keys[n] == key) {
+                return &values[n];
+            }
+        }
+        return NULL;
+    }
+};
+
+class JsonDocument;
+
+/**
+ * -------------------------------------------------------------------------
+ *  doc["key"].
+ * -------------------------------------------------------------------------
+ */
+class JsonVariant {
+public:
+    JsonVariant(JsonNode* object, const char* key) : object_(object), key_(key) {}
+    JsonVariant(const JsonVariant& other) = default;
+
+    template <typename T> bool is() const;
+    template <typename T> T    as() const;
+    operator const char*() const;
+    const char* operator|(const char* fallback) const;
+
+    JsonVariant& operator=(const JsonVariant& other) {    // Copies the value (ArduinoJson 7), not the binding.
+        JsonNode* from = other.find();
+        JsonNode  copy = (from != NULL) ? *from : JsonNode();
+        node()         = copy;
+        return *this;
+    }
+    JsonVariant& operator=(const char* value) {
+        JsonNode& n = node();
+        n           = JsonNode();
+        if (value != NULL) {
+            n.type = JsonNode::STRING;
+            n.s    = value;
+        }
+        return *this;
+    }
+    JsonVariant& operator=(const String& value)           { return *this = value.c_str(); }
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value, JsonVariant&>::type operator=(T value) {
+        JsonNode& n = node();
+        n           = JsonNode();
+        if (std::is_same<T, bool>::value) {
+            n.type = JsonNode::BOOL;
+            n.b    = (value != 0);
+        } else if (std::is_floating_point<T>::value) {
+            n.type = std::is_same<T, float>::value ? JsonNode::FLOAT : JsonNode::DOUBLE;
+            n.f    = (double)value;
+        } else if (std::is_signed<T>::value) {
+            n.type = JsonNode::INT;
+            n.i    = (int64_t)value;
+        } else {
+            n.type = JsonNode::UINT;
+            n.u    = (uint64_t)value;
+        }
+        return *this;
+    }
+
+    JsonNode* find() const                                { return (object_->type == JsonNode::OBJECT) ? object_->member(key_.c_str()) : NULL; }
+
+private:
+    JsonNode& node() {
+        JsonNode* found = find();
+        if (found != NULL) {
+            return *found;
+        }
+        if (object_->type != JsonNode::OBJECT) {
+            *object_      = JsonNode();
+            object_->type = JsonNode::OBJECT;
+        }
+        object_->keys.push_back(key_);
+        object_->values.push_back(JsonNode());
+        return object_->values.back();
+    }
+
+    JsonNode*   object_;
+    std::string key_;
+};
+
+template <> inline bool JsonVariant::is<JsonVariant>() const   { return find() != NULL; }
+template <> inline bool JsonVariant::is<const char*>() const   { JsonNode* n = find(); return (n != NULL) && (n->type == JsonNode::STRING); }
+template <> inline const char* JsonVariant::as<const char*>() const {
+    JsonNode* n = find();
+    return ((n != NULL) && (n->type == JsonNode::STRING)) ? n->s.c_str() : NULL;
+}
+template <> inline bool JsonVariant::as<bool>() const {
+    JsonNode* n = find();
+    if (n == NULL) {
+        return false;
+    }
+    switch (n->type) {
+        case JsonNode::BOOL:   return n->b;
+        case JsonNode::INT:    return n->i != 0;
+        case JsonNode::UINT:   return n->u != 0;
+        case JsonNode::FLOAT:
+        case JsonNode::DOUBLE: return n->f != 0;
+        case JsonNode::NUL:    return false;
+        default:               return true;             // String, object, array.
+    }
+}
+template <> inline long JsonVariant::as<long>() const {
+    JsonNode* n = find();
+    if (n == NULL) {
+        return 0;
+    }
+    switch (n->type) {
+        case JsonNode::BOOL:   return n->b ? 1 : 0;
+        case JsonNode::INT:    return (long)n->i;
+        case JsonNode::UINT:   return (long)n->u;
+        case JsonNode::FLOAT:
+        case JsonNode::DOUBLE: return (long)n->f;
+        default:               return 0;
+    }
+}
+template <> inline int JsonVariant::as<int>() const    { return (int)as<long>(); }
+inline JsonVariant::operator const char*() const       { return as<const char*>(); }
+inline const char* JsonVariant::operator|(const char* fallback) const {
+    const char* value = as<const char*>();
+    return (value != NULL) ? value : fallback;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  JsonDocument.
+ * -------------------------------------------------------------------------
+ */
+class JsonDocument {
+public:
+    JsonVariant operator[](const char* key)               { return JsonVariant(&root_, key); }
+    void        clear()                                   { root_ = JsonNode(); }
+    size_t      size() const                              { return root_.values.size(); }
+    JsonNode&   simRoot()                                 { return root_; }
+
+private:
+    JsonNode root_;
+};
+
+/**
+ * -------------------------------------------------------------------------
+ *  Deserialize.
+ * -------------------------------------------------------------------------
+ */
+class DeserializationError {
+public:
+    enum Code { Ok, EmptyInput, IncompleteInput, InvalidInput, NoMemory, TooDeep };
+    DeserializationError(Code code = Ok) : code_(code) {}
+    explicit operator bool() const                        { return code_ != Ok; }
+    Code        code() const                              { return code_; }
+    const char* c_str() const {
+        static const char* NAMES[] = {"Ok", "EmptyInput", "IncompleteInput", "InvalidInput", "NoMemory", "TooDeep"};
+        return NAMES[code_];
+    }
+    const char* f_str() const                             { return c_str(); }
+
+private:
+    Code code_;
+};
+
+class SimJsonParser {
+public:
+    SimJsonParser(const char* text, size_t len) : at_(text), end_(text + len) {}
+
+    DeserializationError parse(JsonNode* out) {
+        skip();
+        if (at_ == end_) {
+            return DeserializationError::EmptyInput;
+        }
+        return value(out, 0);
+    }
+
+private:
+    static const int MAX_DEPTH = 10;                      // ARDUINOJSON_DEFAULT_NESTING_LIMIT.
+
+    void skip()                                           { while ((at_ < end_) && isspace((unsigned char)*at_)) { at_++; } }
+    bool literal(const char* word) {
+        size_t n = strlen(word);
+        if (((size_t)(end_ - at_) < n) || (strncmp(at_, word, n) != 0)) {
+            return false;
+        }
+        at_ += n;
+        return true;
+    }
+
+    DeserializationError string(std::string* out) {
+        at_++;                                            // Opening quote.
+        while (at_ < end_) {
+            char c = *at_++;
+            if (c == '"') {
+                return DeserializationError::Ok;
+            }
+            if (c != '\\') {
+                out->push_back(c);
+                continue;
+            }
+            if (at_ == end_) {
+                break;
+            }
+            c = *at_++;
+            switch (c) {
+                case 'b': out->push_back('\b'); break;
+                case 'f': out->push_back('\f'); break;
+                case 'n': out->push_back('\n'); break;
+                case 'r': out->push_back('\r'); break;
+                case 't': out->push_back('\t'); break;
+                case 'u': {
+                    if (end_ - at_ < 4) {
+                        return DeserializationError::IncompleteInput;
+                    }
+                    unsigned int code = 0;
+                    if (sscanf(std::string(at_, 4).c_str(), "%4x", &code) != 1) {
+                        return DeserializationError::InvalidInput;
+                    }
+                    at_ += 4;
+                    if (code < 0x80) {
+                        out->push_back((char)code);
+                    } else if (code < 0x800) {
+                        out->push_back((char)(0xC0 | (code >> 6)));
+                        out->push_back((char)(0x80 | (code & 0x3F)));
+                    } else {
+                        out->push_back((char)(0xE0 | (code >> 12)));
+                        out->push_back((char)(0x80 | ((code >> 6) & 0x3F)));
+                        out->push_back((char)(0x80 | (code & 0x3F)));
+                    }
+                    break;
+                }
+                default:  out->push_back(c); break;       // \" \\ \/.
+            }
+        }
+        return DeserializationError::IncompleteInput;
+    }
+
+    DeserializationError number(JsonNode* out) {
+        const char* start = at_;
+        bool        real  = false;
+        while ((at_ < end_) && (strchr("+-0123456789.eE", *at_) != NULL)) {
+            real = real || (strchr(".eE", *at_) != NULL);
+            at_++;
+        }
+        std::string text(start, at_);
+        char*       stop = NULL;
+        if (real) {
+            out->type = JsonNode::DOUBLE;
+            out->f    = strtod(text.c_str(), &stop);
+        } else if (text[0] == '-') {
+            out->type = JsonNode::INT;
+            out->i    = strtoll(text.c_str(), &stop, 10);
+        } else {
+            out->type = JsonNode::UINT;
+            out->u    = strtoull(text.c_str(), &stop, 10);
+        }
+        return ((stop == NULL) || (*stop != '\0') || text.empty()) ? DeserializationError::InvalidInput : DeserializationError::Ok;
+    }
+
+    DeserializationError value(JsonNode* out, int depth) {
+        DeserializationError error;
+        skip();
+        if (at_ == end_) {
+            return DeserializationError::IncompleteInput;
+        }
+        if (depth > MAX_DEPTH) {
+            return DeserializationError::TooDeep;
+        }
+        switch (*at_) {
+            case '"':
+                out->type = JsonNode::STRING;
+                return string(&out->s);
+            case '{':
+            case '[': {
+                bool object = (*at_++ == '{');
+                char close  = object ? '}' : ']';
+                out->type   = object ? JsonNode::OBJECT : JsonNode::ARRAY;
+                skip();
+                if ((at_ < end_) && (*at_ == close)) {
+                    at_++;
+                    return DeserializationError::Ok;
+                }
+                for (;;) {
+                    std::string key;
+                    skip();
+                    if (object) {
+                        if ((at_ == end_) || (*at_ != '"')) {
+                            return (at_ == end_) ? DeserializationError::IncompleteInput : DeserializationError::InvalidInput;
+                        }
+                        if ((error = string(&key))) {
+                            return error;
+                        }
+                        skip();
+                        if ((at_ == end_) || (*at_++ != ':')) {
+                            return (at_ >= end_) ? DeserializationError::IncompleteInput : DeserializationError::InvalidInput;
+                        }
+                    }
+                    JsonNode item;
+                    if ((error = value(&item, depth + 1))) {
+                        return error;
+                    }
+                    JsonNode* existing = object ? out->member(key.c_str()) : NULL;
+                    if (existing != NULL) {
+                        *existing = item;                 // Duplicate key: last one wins.
+                    } else {
+                        if (object) {
+                            out->keys.push_back(key);
+                        }
+                        out->values.push_back(item);
+                    }
+                    skip();
+                    if (at_ == end_) {
+                        return DeserializationError::IncompleteInput;
+                    }
+                    if (*at_ == ',') {
+                        at_++;
+                        continue;
+                    }
+                    return (*at_++ == close) ? DeserializationError::Ok : DeserializationError::InvalidInput;
+                }
+            }
+            case 't': out->type = JsonNode::BOOL; out->b = true; return literal("true")  ? DeserializationError::Ok : DeserializationError::InvalidInput;
+            case 'f': out->type = JsonNode::BOOL;                return literal("false") ? DeserializationError::Ok : DeserializationError::InvalidInput;
+            case 'n':                                            return literal("null")  ? DeserializationError::Ok : DeserializationError::InvalidInput;
+            default:  return number(out);
+        }
+    }
+
+    const char* at_;
+    const char* end_;
+};
+
+inline DeserializationError deserializeJson(JsonDocument& doc, const char* input, size_t len) {
+    JsonNode             root;
+    SimJsonParser        parser(input, (input == NULL) ? 0 : strnlen(input, len));
+    DeserializationError error = parser.parse(&root);
+    doc.clear();
+    if (!error) {
+        doc.simRoot() = root;
+    }
+    return error;
+}
+inline DeserializationError deserializeJson(JsonDocument& doc, const char* input) {
+    return deserializeJson(doc, input, (input == NULL) ? 0 : strlen(input));
+}
+inline DeserializationError deserializeJson(JsonDocument& doc, const JsonVariant& input) {
+    return deserializeJson(doc, input.as<const char*>());
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Serialize.
+ * -------------------------------------------------------------------------
+ */
+inline void simJsonWrite(const JsonNode& node, std::string* out) {
+    char number[32];
+    switch (node.type) {
+        case JsonNode::NUL:    *out += "null"; break;
+        case JsonNode::BOOL:   *out += node.b ? "true" : "false"; break;
+        case JsonNode::INT:    snprintf(number, sizeof(number), "%lld", (long long)node.i); *out += number; break;
+        case JsonNode::UINT:   snprintf(number, sizeof(number), "%llu", (unsigned long long)node.u); *out += number; break;
+        case JsonNode::FLOAT:
+        case JsonNode::DOUBLE:
+            if (!isfinite(node.f)) {
+                *out += "null";
+                break;
+            }
+            snprintf(number, sizeof(number), (node.type == JsonNode::FLOAT) ? "%.7g" : "%.15g", node.f);
+            *out += number;
+            break;
+        case JsonNode::STRING:
+            *out += '"';
+            for (char c : node.s) {
+                switch (c) {
+                    case '"':  *out += "\\\""; break;
+                    case '\\': *out += "\\\\"; break;
+                    case '\b': *out += "\\b";  break;
+                    case '\f': *out += "\\f";  break;
+                    case '\n': *out += "\\n";  break;
+                    case '\r': *out += "\\r";  break;
+                    case '\t': *out += "\\t";  break;
+                    default:
+                        if ((unsigned char)c < 0x20) {
+                            snprintf(number, sizeof(number), "\\u%04x", c);
+                            *out += number;
+                        } else {
+                            *out += c;
+                        }
+                }
+            }
+            *out += '"';
+            break;
+        case JsonNode::OBJECT:
+        case JsonNode::ARRAY:
+            *out += (node.type == JsonNode::OBJECT) ? '{' : '[';
+            for (size_t n = 0; n < node.values.size(); n++) {
+                *out += (n > 0) ? "," : "";
+                if (node.type == JsonNode::OBJECT) {
+                    JsonNode key;
+                    key.type = JsonNode::STRING;
+                    key.s    = node.keys[n];
+                    simJsonWrite(key, out);
+                    *out += ':';
+                }
+                simJsonWrite(node.values[n], out);
+            }
+            *out += (node.type == JsonNode::OBJECT) ? '}' : ']';
+            break;
+    }
+}
+
+inline size_t serializeJson(JsonDocument& doc, char* output, size_t size) {
+    std::string text;
+    simJsonWrite(doc.simRoot(), &text);
+    if (size == 0) {
+        return 0;
+    }
+    size_t len = (text.size() < size - 1) ? text.size() : size - 1;
+    memcpy(output, text.data(), len);
+    output[len] = '\0';
+    return len;
+}
+inline size_t serializeJson(JsonDocument& doc, Print& output) {
+    std::string text;
+    simJsonWrite(doc.simRoot(), &text);
+    return output.write((const uint8_t*)text.data(), text.size());
+}
+
+#endif
@@ -0,0 +1,21 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: AsyncTCP.
+ * *************************************************************************
+ *
+ * AsyncTCP.h
+ *
+ * No sockets: the sim calls the web server & WebSocket handlers directly, on its "async_tcp" task.
+ * @see ESPAsyncWebServer.h.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @link   https://github.com/ESP32Async/AsyncTCP.
+ */
+
+#ifndef SIM_ASYNCTCP_H
+#define SIM_ASYNCTCP_H
+
+#include <Arduino.h>
+
+#endif
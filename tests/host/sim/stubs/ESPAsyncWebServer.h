@@ -0,0 +1,427 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: ESPAsyncWebServer.
+ * *************************************************************************
+ *
+ * ESPAsyncWebServer.h
+ *
+ * Routes, requests & responses without sockets. The sim side runs a request straight through the handlers
+ * (simRequest(), simUpload()) & gets back the whole response: a filler or file response is drained at send(),
+ * in TCP sized chunks. Handler order, prefix routes (trailing "*"), filters & serveStatic() (".gz" first) match the
+ * library.
+ *
+ * AsyncWebSocket: simConnect(), simDisconnect() & simText() raise the events the sketch handles (one text
+ * frame = one WS_EVT_DATA, final, index 0). Frames sent to clients go to simRx, with the client ID & opcode.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    sim.h, FS.h.
+ * @link   https://github.com/ESP32Async/ESPAsyncWebServer.
+ */
+
+#ifndef SIM_ESPASYNCWEBSERVER_H
+#define SIM_ESPASYNCWEBSERVER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define DEFAULT_MAX_WS_CLIENTS  4
+const size_t SIM_TCP_CHUNK = 1436;                        // Filler maxLen (TCP MSS, lwIP).
+
+typedef enum {
+    HTTP_GET  = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_ANY  = 0b11111111
+} WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebServerRequest;
+typedef std::function<void(AsyncWebServerRequest* request)>                                         ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, const String& filename, size_t index,
+                           uint8_t* data, size_t len, bool final)>                                  ArUploadHandlerFunction;
+typedef std::function<bool(AsyncWebServerRequest* request)>                                         ArRequestFilterFunction;
+typedef std::function<size_t(uint8_t* buffer, size_t maxLen, size_t index)>                         AwsResponseFiller;
+
+/**
+ * -------------------------------------------------------------------------
+ *  Responses.
+ * -------------------------------------------------------------------------
+ */
+class AsyncWebServerResponse {
+public:
+    AsyncWebServerResponse(int code, const String& contentType) : code_(code), contentType_(contentType) {}
+    virtual ~AsyncWebServerResponse() {}
+    void          addHeader(const String& name, const String& value) { headers_.push_back(std::make_pair(name, value)); }
+
+    // -- Sim side. --
+    int           simCode() const                         { return code_; }
+    const String& simContentType() const                  { return contentType_; }
+    String        simHeader(const char* name) const {
+        for (auto& header : headers_) {
+            if (header.first == name) {
+                return header.second;
+            }
+        }
+        return String();
+    }
+    std::string&  simBody()                               { return body_; }
+
+protected:
+    int                                   code_;
+    String                                contentType_;
+    std::vector<std::pair<String, String>> headers_;
+    std::string                           body_;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+public:
+    explicit AsyncResponseStream(const String& contentType) : AsyncWebServerResponse(200, contentType) {}
+    size_t write(uint8_t c) override                      { body_.push_back((char)c); return 1; }
+    size_t write(const uint8_t* data, size_t len) override { body_.append((const char*)data, len); return len; }
+    using  Print::write;
+};
+
+/**
+ * -------------------------------------------------------------------------
+ *  Requests.
+ * -------------------------------------------------------------------------
+ */
+class AsyncWebParameter {
+public:
+    AsyncWebParameter(const String& name, const String& value) : name_(name), value_(value) {}
+    const String& name() const                            { return name_; }
+    const String& value() const                           { return value_; }
+
+private:
+    String name_;
+    String value_;
+};
+
+class AsyncWebServerRequest {
+public:
+    AsyncWebServerRequest(WebRequestMethod method, const String& url) : method_(method), url_(url) {}
+    WebRequestMethod         method() const               { return method_; }
+    const String&            url() const                  { return url_; }
+    bool                     hasParam(const char* name) const { return getParam(name) != NULL; }
+    const AsyncWebParameter* getParam(const char* name) const {
+        for (auto& param : params_) {
+            if (param.name() == name) {
+                return &param;
+            }
+        }
+        return NULL;
+    }
+    bool   hasHeader(const char* name) const              { return headers_.count(name) > 0; }
+    String header(const char* name) const                 { auto found = headers_.find(name); return (found == headers_.end()) ? String() : found->second; }
+
+    AsyncWebServerResponse* beginResponse(int code, const String& contentType = String(), const String& content = String()) {
+        AsyncWebServerResponse* response = new AsyncWebServerResponse(code, contentType);
+        response->simBody() = content.c_str();
+        return response;
+    }
+    AsyncWebServerResponse* beginResponse(const String& contentType, size_t len, AwsResponseFiller filler) {
+        AsyncWebServerResponse* response = new AsyncWebServerResponse(200, contentType);
+        uint8_t                 chunk[SIM_TCP_CHUNK];
+        size_t                  n;
+        while ((response->simBody().size() < len) && ((n = filler(chunk, sizeof(chunk), response->simBody().size())) > 0)) {
+            response->simBody().append((const char*)chunk, n);
+        }
+        return response;
+    }
+    AsyncResponseStream* beginResponseStream(const String& contentType) { return new AsyncResponseStream(contentType); }
+
+    void send(AsyncWebServerResponse* response)           { response_.reset(response); }
+    void send(int code, const String& contentType = String(), const String& content = String()) { send(beginResponse(code, contentType, content)); }
+    void send(fs::FS& fs, const String& path, const String& contentType = String(), bool download = false) {
+        String   file = path;
+        bool     gzip = false;
+        if ((!fs.exists(file)) && fs.exists(path + ".gz")) {
+            file = path + ".gz";
+            gzip = true;
+        }
+        fs::File f = fs.open(file, "r");
+        if (!f) {
+            send(404);
+            return;
+        }
+        AsyncWebServerResponse* response = new AsyncWebServerResponse(200, contentType);
+        response->simBody().resize(f.size());
+        f.read((uint8_t*)&response->simBody()[0], f.size());
+        f.close();
+        if (gzip) {
+            response->addHeader("Content-Encoding", "gzip");
+        }
+        if (download) {
+            response->addHeader("Content-Disposition", "attachment");
+        }
+        send(response);
+    }
+
+    // -- Sim side. --
+    void                    simParam(const String& name, const String& value) { params_.push_back(AsyncWebParameter(name, value)); }
+    void                    simHeader(const String& name, const String& value) { headers_[name] = value; }
+    AsyncWebServerResponse* simResponse()                 { return response_.get(); }
+
+private:
+    WebRequestMethod                        method_;
+    String                                  url_;
+    std::vector<AsyncWebParameter>          params_;
+    std::map<String, String>                headers_;
+    std::unique_ptr<AsyncWebServerResponse> response_;
+};
+
+/**
+ * -------------------------------------------------------------------------
+ *  Handlers & server.
+ * -------------------------------------------------------------------------
+ */
+class AsyncWebHandler {
+public:
+    virtual ~AsyncWebHandler() {}
+    AsyncWebHandler& setFilter(ArRequestFilterFunction filter) { filter_ = filter; return *this; }
+    bool             filter(AsyncWebServerRequest* request) { return (!filter_) || filter_(request); }
+    virtual bool     canHandle(AsyncWebServerRequest* request) { (void)request; return false; }
+    virtual void     handleRequest(AsyncWebServerRequest* request) { (void)request; }
+    virtual void     handleUpload(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data, size_t len, bool final) {
+        (void)request; (void)filename; (void)index; (void)data; (void)len; (void)final;
+    }
+
+private:
+    ArRequestFilterFunction filter_;
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+public:
+    AsyncCallbackWebHandler(const String& uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload)
+        : uri_(uri), method_(method), onRequest_(onRequest), onUpload_(onUpload) {}
+    bool canHandle(AsyncWebServerRequest* request) override {
+        if ((method_ & request->method()) == 0) {
+            return false;
+        }
+        if (uri_.endsWith("*")) {
+            return request->url().startsWith(uri_.substring(0, uri_.length() - 1));
+        }
+        return (request->url() == uri_) || request->url().startsWith(uri_ + "/");
+    }
+    void handleRequest(AsyncWebServerRequest* request) override { if (onRequest_) { onRequest_(request); } }
+    void handleUpload(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data, size_t len, bool final) override {
+        if (onUpload_) {
+            onUpload_(request, filename, index, data, len, final);
+        }
+    }
+
+private:
+    String                    uri_;
+    WebRequestMethodComposite method_;
+    ArRequestHandlerFunction  onRequest_;
+    ArUploadHandlerFunction   onUpload_;
+};
+
+class AsyncStaticWebHandler : public AsyncWebHandler {
+public:
+    AsyncStaticWebHandler(const String& uri, fs::FS& fs, const String& path) : uri_(uri), fs_(fs), path_(path) {}
+    bool canHandle(AsyncWebServerRequest* request) override {
+        return (request->method() == HTTP_GET) && request->url().startsWith(uri_);
+    }
+    void handleRequest(AsyncWebServerRequest* request) override {
+        String path = path_ + request->url().substring(uri_.length());
+        request->send(fs_, path.endsWith("/") ? path + "index.htm" : path);
+    }
+
+private:
+    String   uri_;
+    fs::FS&  fs_;
+    String   path_;
+};
+
+class AsyncWebServer {
+public:
+    explicit AsyncWebServer(uint16_t port) : port_(port) {}
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                                ArUploadHandlerFunction onUpload = NULL) {
+        AsyncCallbackWebHandler* handler = new AsyncCallbackWebHandler(uri, method, onRequest, onUpload);
+        handlers_.push_back(handler);
+        return *handler;
+    }
+    AsyncStaticWebHandler& serveStatic(const char* uri, fs::FS& fs, const char* path) {
+        AsyncStaticWebHandler* handler = new AsyncStaticWebHandler(uri, fs, path);
+        handlers_.push_back(handler);
+        return *handler;
+    }
+    AsyncWebHandler& addHandler(AsyncWebHandler* handler) { handlers_.push_back(handler); return *handler; }
+    void             begin()                              { begun_ = true; }
+
+    // -- Sim side. Request through the first handler that takes it; 404 if none (or before begin()). --
+    void simRequest(AsyncWebServerRequest* request) {
+        AsyncWebHandler* handler = find(request);
+        if (handler != NULL) {
+            handler->handleRequest(request);
+        }
+        if (request->simResponse() == NULL) {
+            request->send(404);
+        }
+    }
+    void simUpload(AsyncWebServerRequest* request, const String& filename, const uint8_t* data, size_t len) {
+        AsyncWebHandler*     handler = find(request);
+        std::vector<uint8_t> copy(data, data + len);
+        for (size_t index = 0; (handler != NULL) && ((index < len) || (index == 0)); index += SIM_TCP_CHUNK) {
+            size_t chunk = ((len - index) < SIM_TCP_CHUNK) ? (len - index) : SIM_TCP_CHUNK;
+            handler->handleUpload(request, filename, index, copy.data() + index, chunk, (index + chunk) >= len);
+            if (request->simResponse() != NULL) {                          // Upload handler answered (error).
+                return;
+            }
+        }
+        simRequest(request);
+    }
+
+private:
+    AsyncWebHandler* find(AsyncWebServerRequest* request) {
+        for (AsyncWebHandler* handler : handlers_) {
+            if (begun_ && handler->canHandle(request) && handler->filter(request)) {
+                return handler;
+            }
+        }
+        return NULL;
+    }
+    uint16_t                      port_;
+    bool                          begun_ = false;
+    std::vector<AsyncWebHandler*> handlers_;
+};
+
+/**
+ * -------------------------------------------------------------------------
+ *  WebSocket.
+ * -------------------------------------------------------------------------
+ */
+typedef enum {
+    WS_EVT_CONNECT,
+    WS_EVT_DISCONNECT,
+    WS_EVT_PING,
+    WS_EVT_PONG,
+    WS_EVT_ERROR,
+    WS_EVT_DATA
+} AwsEventType;
+
+#define WS_CONTINUATION 0x00
+#define WS_TEXT         0x01
+#define WS_BINARY       0x02
+
+typedef struct {
+    uint8_t  message_opcode;
+    uint32_t num;
+    uint8_t  final;
+    uint8_t  masked;
+    uint8_t  opcode;
+    uint64_t len;
+    uint8_t  mask[4];
+    uint64_t index;
+} AwsFrameInfo;
+
+class AsyncWebSocket;
+
+class AsyncWebSocketClient {
+public:
+    AsyncWebSocketClient(uint32_t id, IPAddress remote) : id_(id), remote_(remote) {}
+    uint32_t  id() const                                  { return id_; }
+    IPAddress remoteIP() const                            { return remote_; }
+
+private:
+    uint32_t  id_;
+    IPAddress remote_;
+};
+
+typedef std::function<void(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type, void* arg,
+                           uint8_t* data, size_t len)> AwsEventHandler;
+
+class AsyncWebSocket : public AsyncWebHandler {
+public:
+    explicit AsyncWebSocket(const char* url) : url_(url) {}
+    void   onEvent(AwsEventHandler handler)               { handler_ = handler; }
+    bool   text(uint32_t id, const char* message, size_t len)         { return send(id, WS_TEXT, (const uint8_t*)message, len); }
+    bool   textAll(const char* message, size_t len)                   { return send(0, WS_TEXT, (const uint8_t*)message, len); }
+    bool   binary(uint32_t id, const uint8_t* message, size_t len)    { return send(id, WS_BINARY, message, len); }
+    bool   binaryAll(const uint8_t* message, size_t len)              { return send(0, WS_BINARY, message, len); }
+    size_t count()                                        { std::lock_guard<std::mutex> lock(mutex_); return clients_.size(); }
+    void   cleanupClients(uint16_t maxClients = DEFAULT_MAX_WS_CLIENTS) {
+        uint32_t oldest = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (clients_.size() > maxClients) {
+                oldest = clients_.front().id();
+            }
+        }
+        if (oldest != 0) {
+            simDisconnect(oldest);
+        }
+    }
+
+    // -- Sim side. Events run the handler on the calling (sim) thread. --
+    std::function<void(uint32_t id, uint8_t opcode, const uint8_t* data, size_t len)> simRx;   // Frames to the browser.
+    uint32_t simConnect(IPAddress remote) {
+        AsyncWebSocketClient client(0, remote);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            client = AsyncWebSocketClient(++lastId_, remote);
+            clients_.push_back(client);
+        }
+        event(&client, WS_EVT_CONNECT, NULL, NULL, 0);
+        return client.id();
+    }
+    void simDisconnect(uint32_t id) {
+        AsyncWebSocketClient client(id, IPAddress());
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto at = clients_.begin(); at != clients_.end(); at++) {
+                if (at->id() == id) {
+                    client = *at;
+                    clients_.erase(at);
+                    break;
+                }
+            }
+        }
+        event(&client, WS_EVT_DISCONNECT, NULL, NULL, 0);
+    }
+    void simText(uint32_t id, const char* message) {
+        AsyncWebSocketClient client(id, IPAddress());
+        AwsFrameInfo         info = {};
+        std::string          data(message);
+        info.message_opcode = WS_TEXT;
+        info.final          = 1;
+        info.opcode         = WS_TEXT;
+        info.len            = data.size();
+        event(&client, WS_EVT_DATA, &info, (uint8_t*)&data[0], data.size());
+    }
+
+private:
+    bool send(uint32_t id, uint8_t opcode, const uint8_t* message, size_t len) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        bool sent = false;
+        for (auto& client : clients_) {
+            if (((id == 0) || (client.id() == id)) && simRx) {
+                simRx(client.id(), opcode, message, len);
+                sent = true;
+            }
+        }
+        return sent;
+    }
+    void event(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t len) {
+        if (handler_) {
+            handler_(this, client, type, arg, data, len);
+        }
+    }
+
+    String                            url_;
+    AwsEventHandler                   handler_;
+    std::mutex                        mutex_;
+    std::vector<AsyncWebSocketClient> clients_;
+    uint32_t                          lastId_ = 0;
+};
+
+#endif
@@ -0,0 +1,190 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: FS (file system & File).
+ * *************************************************************************
+ *
+ * FS.h
+ *
+ * A flat file system in memory: "/name" -> bytes, one directory ("/"). Files opened by two tasks share the
+ * bytes, like FAT on the card; each File has its own position. No card timing: writes & reads are memcpy.
+ * The sim side (simPut(), simGet(), simList()) loads the card before setup() & reads back what was written.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    SD.h, sim.h.
+ * @link   https://github.com/espressif/arduino-esp32/tree/master/libraries/FS.
+ */
+
+#ifndef SIM_FS_H
+#define SIM_FS_H
+
+#include <Arduino.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define FILE_READ       "r"
+#define FILE_WRITE      "w"
+#define FILE_APPEND     "a"
+
+namespace fs {
+
+class FS;
+
+class File : public Stream {
+public:
+    File() {}
+    operator bool() const                                 { return fs_ != NULL; }
+    int         available() override;
+    int         read() override                           { uint8_t c; return (read(&c, 1) == 1) ? c : -1; }
+    size_t      read(uint8_t* buffer, size_t size);
+    size_t      write(uint8_t c) override                 { return write(&c, 1); }
+    size_t      write(const uint8_t* data, size_t len) override;
+    using       Print::write;
+    size_t      size() const;
+    bool        seek(uint32_t pos)                        { pos_ = pos; return fs_ != NULL; }
+    size_t      position() const                          { return pos_; }
+    void        flush()                                   {}
+    void        close()                                   { fs_ = NULL; data_.reset(); entries_.clear(); }
+    const char* path() const                              { return path_.c_str(); }
+    const char* name() const                              { size_t at = path_.rfind('/'); return path_.c_str() + ((at == std::string::npos) ? 0 : at + 1); }
+    bool        isDirectory() const                       { return (fs_ != NULL) && (data_ == NULL); }
+    File        openNextFile(const char* mode = FILE_READ);
+
+private:
+    friend class FS;
+    FS*                                   fs_  = NULL;
+    std::string                           path_;
+    std::shared_ptr<std::vector<uint8_t>> data_;          // NULL: directory.
+    std::vector<std::string>              entries_;       // Directory: names left to list.
+    size_t                                pos_ = 0;
+};
+
+class FS {
+public:
+    File open(const char* path, const char* mode = FILE_READ, bool create = false) {
+        (void)create;
+        SimHeapOff                  card;
+        File                        file;
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (strcmp(path, "/") == 0) {
+            file.fs_   = this;
+            file.path_ = "/";
+            for (auto& entry : files_) {
+                file.entries_.push_back(entry.first);
+            }
+            return file;
+        }
+        auto found = files_.find(path);
+        if (mode[0] == 'w') {
+            files_[path] = std::make_shared<std::vector<uint8_t>>();
+            found        = files_.find(path);
+        } else if ((mode[0] == 'a') && (found == files_.end())) {
+            found = files_.emplace(path, std::make_shared<std::vector<uint8_t>>()).first;
+        }
+        if (found == files_.end()) {
+            return file;
+        }
+        file.fs_   = this;
+        file.path_ = path;
+        file.data_ = found->second;
+        file.pos_  = (mode[0] == 'a') ? found->second->size() : 0;
+        return file;
+    }
+    File open(const String& path, const char* mode = FILE_READ, bool create = false) { return open(path.c_str(), mode, create); }
+    bool exists(const char* path)                         { std::lock_guard<std::mutex> lock(mutex_); return files_.count(path) > 0; }
+    bool exists(const String& path)                       { return exists(path.c_str()); }
+    bool remove(const char* path)                         { std::lock_guard<std::mutex> lock(mutex_); return files_.erase(path) > 0; }
+    bool remove(const String& path)                       { return remove(path.c_str()); }
+
+    // -- Sim side. --
+    void simPut(const std::string& path, const std::vector<uint8_t>& data) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        files_[path] = std::make_shared<std::vector<uint8_t>>(data);
+    }
+    bool simGet(const std::string& path, std::vector<uint8_t>* data) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto found = files_.find(path);
+        if (found == files_.end()) {
+            return false;
+        }
+        *data = *found->second;
+        return true;
+    }
+    std::vector<std::string> simList() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<std::string> paths;
+        for (auto& entry : files_) {
+            paths.push_back(entry.first);
+        }
+        return paths;
+    }
+
+private:
+    friend class File;
+    std::mutex                                                   mutex_;
+    std::map<std::string, std::shared_ptr<std::vector<uint8_t>>> files_;
+};
+
+inline int File::available() {
+    if (data_ == NULL) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(fs_->mutex_);
+    return (pos_ < data_->size()) ? (int)(data_->size() - pos_) : 0;
+}
+
+inline size_t File::read(uint8_t* buffer, size_t size) {
+    if (data_ == NULL) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(fs_->mutex_);
+    size_t n = (pos_ < data_->size()) ? data_->size() - pos_ : 0;
+    n        = (n > size) ? size : n;
+    memcpy(buffer, data_->data() + pos_, n);
+    pos_    += n;
+    return n;
+}
+
+inline size_t File::write(const uint8_t* data, size_t len) {
+    if (data_ == NULL) {
+        return 0;
+    }
+    SimHeapOff                  card;
+    std::lock_guard<std::mutex> lock(fs_->mutex_);
+    if (data_->size() < pos_ + len) {
+        data_->resize(pos_ + len);
+    }
+    memcpy(data_->data() + pos_, data, len);
+    pos_ += len;
+    return len;
+}
+
+inline size_t File::size() const {
+    if (data_ == NULL) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(fs_->mutex_);
+    return data_->size();
+}
+
+inline File File::openNextFile(const char* mode) {
+    while (isDirectory() && (!entries_.empty())) {
+        std::string path = entries_.front();
+        entries_.erase(entries_.begin());
+        File file = fs_->open(path.c_str(), mode);
+        if (file) {
+            return file;
+        }
+    }
+    return File();
+}
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif
@@ -0,0 +1,110 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: Preferences (NVS).
+ * *************************************************************************
+ *
+ * Preferences.h
+ *
+ * NVS in memory, kept across begin()/end() for the whole run (a reboot of the sketch keeps its preferences).
+ * Same rules as the library: begin() while open fails & keeps the open namespace, a read only begin() of a
+ * namespace never written fails, puts fail read only, gets of a missing key return the default.
+ * freeEntries() counts one 32 byte entry per key & per 32 bytes of string (approx.) of SIM_NVS_ENTRIES.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    sim.h.
+ * @link   https://github.com/espressif/arduino-esp32/tree/master/libraries/Preferences.
+ */
+
+#ifndef SIM_PREFERENCES_H
+#define SIM_PREFERENCES_H
+
+#include <Arduino.h>
+#include <map>
+#include <mutex>
+#include <string>
+
+const size_t SIM_NVS_ENTRIES = 630;                       // 20 KB "nvs" partition: 5 pages x 126 entries.
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false, const char* partition = NULL) {
+        (void)partition;
+        std::lock_guard<std::mutex> lock(simMutex());
+        if (open_ != NULL) {
+            return false;
+        }
+        if (readOnly && (simNvs().count(name) == 0)) {
+            return false;
+        }
+        open_     = &simNvs()[name];
+        readOnly_ = readOnly;
+        return true;
+    }
+    void   end()                                          { std::lock_guard<std::mutex> lock(simMutex()); open_ = NULL; }
+    bool   clear()                                        { std::lock_guard<std::mutex> lock(simMutex()); return writable() && (open_->clear(), true); }
+    bool   remove(const char* key)                        { std::lock_guard<std::mutex> lock(simMutex()); return writable() && (open_->erase(key) > 0); }
+    bool   isKey(const char* key)                         { std::lock_guard<std::mutex> lock(simMutex()); return (open_ != NULL) && (open_->count(key) > 0); }
+    size_t freeEntries() {
+        std::lock_guard<std::mutex> lock(simMutex());
+        size_t used = 0;
+        for (auto& space : simNvs()) {
+            for (auto& entry : space.second) {
+                used += 1 + (entry.second.size() + 31) / 32;
+            }
+        }
+        return (open_ == NULL) ? 0 : SIM_NVS_ENTRIES - used;
+    }
+
+    size_t putString(const char* key, const char* value)  { return put(key, value, strlen(value)); }
+    size_t putString(const char* key, const String& value) { return putString(key, value.c_str()); }
+    size_t putUShort(const char* key, uint16_t value)     { return put(key, &value, sizeof(value)); }
+
+    size_t getString(const char* key, char* value, size_t maxLen) {
+        std::string found;
+        if ((!get(key, &found)) || (found.size() + 1 > maxLen)) {
+            return 0;
+        }
+        memcpy(value, found.c_str(), found.size() + 1);
+        return found.size() + 1;
+    }
+    String getString(const char* key, const String defaultValue = String()) {
+        std::string found;
+        return get(key, &found) ? String(found) : defaultValue;
+    }
+    uint16_t getUShort(const char* key, uint16_t defaultValue = 0) {
+        std::string found;
+        uint16_t    value = defaultValue;
+        if (get(key, &found) && (found.size() == sizeof(value))) {
+            memcpy(&value, found.data(), sizeof(value));
+        }
+        return value;
+    }
+
+private:
+    typedef std::map<std::string, std::string> Namespace;
+    static std::map<std::string, Namespace>& simNvs()     { static std::map<std::string, Namespace> nvs; return nvs; }
+    static std::mutex&                       simMutex()   { static std::mutex mutex; return mutex; }
+    bool   writable()                                     { return (open_ != NULL) && (!readOnly_); }
+    size_t put(const char* key, const void* value, size_t len) {
+        std::lock_guard<std::mutex> lock(simMutex());
+        if (!writable()) {
+            return 0;
+        }
+        (*open_)[key] = std::string((const char*)value, len);
+        return len;
+    }
+    bool get(const char* key, std::string* value) {
+        std::lock_guard<std::mutex> lock(simMutex());
+        if ((open_ == NULL) || (open_->count(key) == 0)) {
+            return false;
+        }
+        *value = (*open_)[key];
+        return true;
+    }
+
+    Namespace* open_     = NULL;
+    bool       readOnly_ = false;
+};
+
+#endif
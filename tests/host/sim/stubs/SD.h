@@ -0,0 +1,28 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: SD.
+ * *************************************************************************
+ *
+ * SD.h
+ *
+ * The card is always there & mounts. @see FS.h.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @link   https://github.com/espressif/arduino-esp32/tree/master/libraries/SD.
+ */
+
+#ifndef SIM_SD_H
+#define SIM_SD_H
+
+#include "FS.h"
+
+class SDFS : public fs::FS {
+public:
+    bool begin(uint8_t ssPin = 5)                         { (void)ssPin; return true; }
+    void end()                                            {}
+};
+
+extern SDFS SD;
+
+#endif
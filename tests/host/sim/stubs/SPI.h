@@ -0,0 +1,27 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: SPI.
+ * *************************************************************************
+ *
+ * SPI.h
+ *
+ * Bus for the SD card. Nothing on it: SD.h works without it.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @link   https://github.com/espressif/arduino-esp32/tree/master/libraries/SPI.
+ */
+
+#ifndef SIM_SPI_H
+#define SIM_SPI_H
+
+#include <stdint.h>
+
+class SPIClass {
+public:
+    bool begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) { (void)sck; (void)miso; (void)mosi; (void)ss; return true; }
+};
+
+extern SPIClass SPI;
+
+#endif
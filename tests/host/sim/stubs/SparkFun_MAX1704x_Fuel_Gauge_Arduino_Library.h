@@ -0,0 +1,41 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: SparkFun MAX1704x fuel gauge.
+ * *************************************************************************
+ *
+ * SparkFun_MAX1704x_Fuel_Gauge_Arduino_Library.h
+ *
+ * MAX17048 on Wire: always found, battery at simSoc (%), not charging or draining.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @link   https://github.com/sparkfun/SparkFun_MAX1704x_Fuel_Gauge_Arduino_Library.
+ */
+
+#ifndef SIM_SPARKFUN_MAX1704X_H
+#define SIM_SPARKFUN_MAX1704X_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+typedef enum {
+    MAX1704X_MAX17043 = 0,
+    MAX1704X_MAX17044,
+    MAX1704X_MAX17048,
+    MAX1704X_MAX17049
+} sfe_max1704x_devices_e;
+
+class SFE_MAX1704X {
+public:
+    explicit SFE_MAX1704X(sfe_max1704x_devices_e device = MAX1704X_MAX17043) { (void)device; }
+    bool    begin(TwoWire& wirePort = Wire)               { (void)wirePort; return true; }
+    uint8_t quickStart()                                  { return 0; }
+    float   getSOC()                                      { return simSoc; }
+    float   getChangeRate()                               { return 0.0f; }
+    void    enableDebugging(Stream& port = Serial)        { (void)port; }
+    void    disableDebugging()                            {}
+
+    float   simSoc = 87.5f;
+};
+
+#endif
@@ -0,0 +1,213 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: SparkFun u-blox GNSS v3 (ZED-F9P on I2C).
+ * *************************************************************************
+ *
+ * SparkFun_u-blox_GNSS_v3.h
+ *
+ * The ZED's I2C side. The sim puts what the ZED sends into its I2C output buffer (simZedPush(): NMEA bytes,
+ * simZedEpoch(): one NAV-PVT & NAV-HPPOSLLH pair). checkUblox() reads the buffer like the library does,
+ * bytes-available then 32 byte reads, each taking its bus time on the TwoWire passed to begin(), & hands
+ * every NMEA byte to DevUBLOXGNSS::processNMEA() (defined by the sketch). NAV-PVT & NAV-HPPOSLLH cost their
+ * UBX frame bytes of bus time & go to the callbacks at the next checkCallbacks() once read.
+ * The configured output interval (setNavigationRate() x setMeasurementRate()) is simNavIntervalMs().
+ * No RXM-RAWX / RXM-SFRBX: the file buffer stays empty.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    sim.h, Wire.h.
+ * @link   https://github.com/sparkfun/SparkFun_u-blox_GNSS_v3.
+ */
+
+#ifndef SIM_SPARKFUN_UBLOX_GNSS_V3_H
+#define SIM_SPARKFUN_UBLOX_GNSS_V3_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <deque>
+#include <mutex>
+
+// --- Configuration layers & keys (u-blox F9 interface description). ---
+const uint8_t  VAL_LAYER_RAM                    = (1 << 0);
+const uint8_t  VAL_LAYER_BBR                    = (1 << 1);
+const uint8_t  VAL_LAYER_RAM_BBR                = VAL_LAYER_RAM | VAL_LAYER_BBR;
+const uint32_t UBLOX_CFG_NMEA_HIGHPREC          = 0x10930006;
+const uint32_t UBLOX_CFG_MSGOUT_UBX_NAV_PVT_I2C = 0x20910006;
+const uint32_t UBLOX_CFG_UART1_ENABLED          = 0x10520005;
+const uint32_t UBLOX_CFG_UART2INPROT_UBX        = 0x10750001;
+const uint32_t UBLOX_CFG_UART2INPROT_SPARTN     = 0x10750005;
+const uint32_t UBLOX_CFG_UART2OUTPROT_UBX       = 0x10760001;
+const uint32_t UBLOX_CFG_UART2OUTPROT_RTCM3X    = 0x10760004;
+const uint32_t UBLOX_CFG_I2CINPROT_NMEA         = 0x10710002;
+const uint32_t UBLOX_CFG_I2CINPROT_RTCM3X       = 0x10710004;
+const uint32_t UBLOX_CFG_I2COUTPROT_NMEA        = 0x10720002;
+const uint32_t UBLOX_CFG_I2COUTPROT_RTCM3X      = 0x10720004;
+const uint32_t UBLOX_CFG_USBINPROT_RTCM3X       = 0x10770004;
+const uint32_t UBLOX_CFG_USBOUTPROT_RTCM3X      = 0x10780004;
+const uint32_t UBLOX_CFG_MSGOUT_NMEA_ID_GLL_I2C = 0x209100c9;
+const uint32_t UBLOX_CFG_MSGOUT_NMEA_ID_GSA_I2C = 0x209100bf;
+const uint32_t UBLOX_CFG_MSGOUT_NMEA_ID_GST_I2C = 0x209100d3;
+const uint32_t UBLOX_CFG_MSGOUT_NMEA_ID_GSV_I2C = 0x209100c4;
+const uint32_t UBLOX_CFG_MSGOUT_NMEA_ID_VTG_I2C = 0x209100b0;
+
+const size_t   SIM_ZED_I2C_BUFFER = 4096;                 // ZED I2C output buffer (bytes, approx.). Overflow dropped & counted.
+const size_t   SIM_ZED_I2C_CHUNK  = 32;                   // Library i2cTransactionSize.
+const size_t   SIM_UBX_NAV_PVT    = 100;                  // UBX frame bytes (92 payload + 8).
+const size_t   SIM_UBX_HPPOSLLH   = 44;                   // UBX frame bytes (36 payload + 8).
+
+// --- UBX message copies. ---
+typedef struct {
+    uint32_t iTOW;
+    uint16_t year;
+    uint8_t  month, day, hour, min, sec;
+    uint8_t  fixType;
+    union {
+        uint8_t all;
+        struct {
+            uint8_t gnssFixOK : 1;
+            uint8_t diffSoln  : 1;
+            uint8_t psmState  : 3;
+            uint8_t headVehValid : 1;
+            uint8_t carrSoln  : 2;
+        } bits;
+    } flags;
+    uint8_t  numSV;
+    int32_t  lon, lat, height, hMSL;
+    uint32_t hAcc, vAcc;
+} UBX_NAV_PVT_data_t;
+
+typedef struct {
+    uint8_t  version;
+    uint32_t iTOW;
+    int32_t  lon, lat, height, hMSL;
+    int8_t   lonHp, latHp, heightHp, hMSLHp;
+    uint32_t hAcc, vAcc;
+} UBX_NAV_HPPOSLLH_data_t;
+
+class DevUBLOXGNSS {
+public:
+    void processNMEA(char incoming);                      // Defined by the sketch.
+
+    bool checkUblox() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        size_t available = zed_.size();
+        lock.unlock();
+        busTime(2);                                       // 0xFD/0xFE: bytes available.
+        while (available > 0) {
+            size_t  chunk = (available < SIM_ZED_I2C_CHUNK) ? available : SIM_ZED_I2C_CHUNK;
+            uint8_t nmea[SIM_ZED_I2C_CHUNK];
+            size_t  numNmea = 0;
+            busTime(chunk);
+            lock.lock();
+            for (size_t n = 0; n < chunk; n++) {
+                int16_t item = zed_.front();
+                zed_.pop_front();
+                if (item >= 0) {
+                    nmea[numNmea++] = (uint8_t)item;
+                } else if (item == SIM_UBX_END) {         // Last byte of an epoch's UBX frames.
+                    ready_.push_back(epochs_.front());
+                    epochs_.pop_front();
+                }
+            }
+            lock.unlock();
+            for (size_t n = 0; n < numNmea; n++) {
+                processNMEA((char)nmea[n]);
+            }
+            available -= chunk;
+        }
+        return true;
+    }
+    void checkCallbacks() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!ready_.empty()) {
+            SimEpoch epoch = ready_.front();
+            ready_.pop_front();
+            lock.unlock();
+            if (pvtCallback_ != NULL) {
+                pvtCallback_(&epoch.pvt);
+            }
+            if (hpCallback_ != NULL) {
+                hpCallback_(&epoch.hp);
+            }
+            lock.lock();
+        }
+    }
+
+    bool     setNavigationRate(uint16_t rate, uint8_t layer = VAL_LAYER_RAM_BBR, uint16_t maxWait = 1100)    { (void)layer; (void)maxWait; navRate_ = rate; return true; }
+    bool     setMeasurementRate(uint16_t rate, uint8_t layer = VAL_LAYER_RAM_BBR, uint16_t maxWait = 1100)   { (void)layer; (void)maxWait; measRate_ = rate; return true; }
+    bool     softwareResetGNSSOnly()                      { return true; }
+    bool     newCfgValset(uint8_t layer = VAL_LAYER_RAM_BBR) { (void)layer; return true; }
+    bool     addCfgValset(uint32_t key, uint64_t value)   { (void)key; (void)value; return true; }
+    uint8_t  sendCfgValset(uint16_t maxWait = 1100)       { (void)maxWait; return true; }
+    bool     setAutoPVTcallbackPtr(void (*callback)(UBX_NAV_PVT_data_t*), uint8_t layer = VAL_LAYER_RAM_BBR, uint16_t maxWait = 1100) {
+        (void)layer; (void)maxWait; pvtCallback_ = callback; return true;
+    }
+    bool     setAutoHPPOSLLHcallbackPtr(void (*callback)(UBX_NAV_HPPOSLLH_data_t*), uint8_t layer = VAL_LAYER_RAM_BBR, uint16_t maxWait = 1100) {
+        (void)layer; (void)maxWait; hpCallback_ = callback; return true;
+    }
+    bool     setAutoRXMRAWX(bool enable, bool implicit, uint8_t layer = VAL_LAYER_RAM_BBR)  { (void)enable; (void)implicit; (void)layer; return true; }
+    bool     setAutoRXMSFRBX(bool enable, bool implicit, uint8_t layer = VAL_LAYER_RAM_BBR) { (void)enable; (void)implicit; (void)layer; return true; }
+    void     logRXMRAWX(bool enable = true)               { (void)enable; }
+    void     logRXMSFRBX(bool enable = true)              { (void)enable; }
+    void     setFileBufferSize(uint16_t size)             { (void)size; }
+    uint16_t fileBufferAvailable()                        { return 0; }
+    uint16_t extractFileBufferData(uint8_t* destination, uint16_t numBytes) { (void)destination; (void)numBytes; return 0; }
+    void     enableDebugging(Stream& port = Serial, bool printLimited = false) { (void)port; (void)printLimited; }
+    void     disableDebugging()                           {}
+
+    // -- Sim side (the ZED). --
+    size_t simZedPush(const uint8_t* data, size_t len) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t n = 0;
+        for (; (n < len) && (zed_.size() < SIM_ZED_I2C_BUFFER); n++) {
+            zed_.push_back(data[n]);
+        }
+        simZedDropped += len - n;
+        return n;
+    }
+    bool simZedEpoch(const UBX_NAV_PVT_data_t& pvt, const UBX_NAV_HPPOSLLH_data_t& hp) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (zed_.size() + SIM_UBX_NAV_PVT + SIM_UBX_HPPOSLLH > SIM_ZED_I2C_BUFFER) {
+            simZedDropped += SIM_UBX_NAV_PVT + SIM_UBX_HPPOSLLH;
+            return false;
+        }
+        zed_.insert(zed_.end(), SIM_UBX_NAV_PVT + SIM_UBX_HPPOSLLH - 1, SIM_UBX_BYTE);
+        zed_.push_back(SIM_UBX_END);
+        epochs_.push_back({pvt, hp});
+        return true;
+    }
+    uint32_t simNavIntervalMs()                           { return (uint32_t)navRate_ * measRate_; }
+    uint64_t simZedDropped = 0;                           // ZED I2C buffer overflow (bytes).
+
+protected:
+    TwoWire* wire_ = &Wire;
+
+private:
+    struct SimEpoch {
+        UBX_NAV_PVT_data_t      pvt;
+        UBX_NAV_HPPOSLLH_data_t hp;
+    };
+    static constexpr int16_t SIM_UBX_BYTE = -1;              // zed_[]: UBX frame byte (not NMEA).
+    static constexpr int16_t SIM_UBX_END  = -2;              // zed_[]: last UBX byte of an epoch.
+    void busTime(size_t bytes)                            { simBusyUs(((int64_t)(bytes + 2) * 9 * 1000000) / wire_->simClock()); }
+
+    std::mutex                  mutex_;
+    std::deque<int16_t>         zed_;                     // I2C output buffer: NMEA bytes (0-255) & UBX placeholders.
+    std::deque<SimEpoch>        epochs_;                  // In zed_[], not read yet.
+    std::deque<SimEpoch>        ready_;                   // Read, callbacks not run yet.
+    uint16_t                    navRate_    = 1;
+    uint16_t                    measRate_   = 1000;
+    void (*pvtCallback_)(UBX_NAV_PVT_data_t*)      = NULL;
+    void (*hpCallback_)(UBX_NAV_HPPOSLLH_data_t*)  = NULL;
+};
+
+class SFE_UBLOX_GNSS : public DevUBLOXGNSS {
+public:
+    bool begin(TwoWire& wirePort = Wire, uint8_t deviceAddress = 0x42, uint16_t maxWait = 1100, bool assumeSuccess = false) {
+        (void)deviceAddress; (void)maxWait; (void)assumeSuccess;
+        wire_ = &wirePort;
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,90 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: WiFi.
+ * *************************************************************************
+ *
+ * WiFi.h
+ *
+ * Soft AP comes up at the address asked for, the hotspot (STA) never connects & WiFiClient::connect()
+ * fails, so the NTRIP client idles & RTCM comes in by radio (Serial1), as the sim feeds it.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    sim.h.
+ * @link   https://github.com/espressif/arduino-esp32/tree/master/libraries/WiFi.
+ */
+
+#ifndef SIM_WIFI_H
+#define SIM_WIFI_H
+
+#include <Arduino.h>
+
+typedef enum {
+    ARDUINO_EVENT_WIFI_READY = 0,
+    ARDUINO_EVENT_WIFI_SCAN_DONE,
+    ARDUINO_EVENT_WIFI_STA_START,
+    ARDUINO_EVENT_WIFI_STA_STOP,
+    ARDUINO_EVENT_WIFI_STA_CONNECTED,
+    ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+    ARDUINO_EVENT_WIFI_STA_AUTHMODE_CHANGE,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP6,
+    ARDUINO_EVENT_WIFI_STA_LOST_IP,
+    ARDUINO_EVENT_WIFI_AP_START,
+    ARDUINO_EVENT_WIFI_AP_STOP,
+    ARDUINO_EVENT_WIFI_AP_STACONNECTED,
+    ARDUINO_EVENT_WIFI_AP_STADISCONNECTED,
+    ARDUINO_EVENT_WIFI_AP_STAIPASSIGNED,
+    ARDUINO_EVENT_WIFI_AP_PROBEREQRECVED,
+    ARDUINO_EVENT_WIFI_AP_GOT_IP6
+} WiFiEvent_t;
+
+typedef enum {
+    WIFI_OFF = 0,
+    WIFI_STA,
+    WIFI_AP,
+    WIFI_AP_STA
+} wifi_mode_t;
+
+typedef enum {
+    WL_IDLE_STATUS     = 0,
+    WL_NO_SSID_AVAIL   = 1,
+    WL_CONNECTED       = 3,
+    WL_CONNECT_FAILED  = 4,
+    WL_DISCONNECTED    = 6
+} wl_status_t;
+
+typedef void (*WiFiEventCb)(WiFiEvent_t event);
+
+class WiFiClass {
+public:
+    bool        mode(wifi_mode_t mode)                    { (void)mode; return true; }
+    bool        softAPConfig(IPAddress local, IPAddress gateway, IPAddress subnet) { (void)gateway; (void)subnet; apIp_ = local; return true; }
+    bool        softAP(const char* ssid, const char* password = NULL) { (void)ssid; (void)password; return true; }
+    bool        softAPsetHostname(const char* name)       { (void)name; return true; }
+    IPAddress   softAPIP()                                { return apIp_; }
+    uint8_t     softAPgetStationNum()                     { return 1; }
+    int         onEvent(WiFiEventCb callback)             { (void)callback; return 0; }
+    bool        config(IPAddress local)                   { (void)local; return true; }
+    wl_status_t begin(const char* ssid, const char* password = NULL) { (void)ssid; (void)password; return WL_DISCONNECTED; }
+    wl_status_t status()                                  { return WL_DISCONNECTED; }
+    IPAddress   localIP()                                 { return IPAddress(); }
+
+private:
+    IPAddress apIp_;
+};
+
+extern WiFiClass WiFi;
+
+class WiFiClient {                                        // No Internet: connect() fails.
+public:
+    int     connect(const char* host, uint16_t port, int32_t timeoutMs = 0) { (void)host; (void)port; (void)timeoutMs; return 0; }
+    void    stop()                                        {}
+    void    setNoDelay(bool noDelay)                      { (void)noDelay; }
+    size_t  write(const uint8_t* data, size_t len)        { (void)data; (void)len; return 0; }
+    int     available()                                   { return 0; }
+    int     read(uint8_t* data, size_t len)               { (void)data; (void)len; return -1; }
+    uint8_t connected()                                   { return 0; }
+};
+
+#endif
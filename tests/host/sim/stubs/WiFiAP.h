@@ -0,0 +1,20 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: WiFi soft AP.
+ * *************************************************************************
+ *
+ * WiFiAP.h
+ *
+ * Soft AP calls live on WiFiClass. @see WiFi.h.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @link   https://github.com/espressif/arduino-esp32/tree/master/libraries/WiFi.
+ */
+
+#ifndef SIM_WIFIAP_H
+#define SIM_WIFIAP_H
+
+#include "WiFi.h"
+
+#endif
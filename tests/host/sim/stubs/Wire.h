@@ -0,0 +1,62 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: Wire (I2C master).
+ * *************************************************************************
+ *
+ * Wire.h
+ *
+ * Wire (I2C0: LiPo gauge) & Wire1 (I2C1: GR-MCU2). endTransmission() blocks for the bus time at the set
+ * clock (address + data, 9 bits a byte), then hands the bytes to simTx, whose return value is the
+ * endTransmission() status (0 = ACK). No simTx = nothing on the bus (2, address NACK).
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    sim.h.
+ * @link   https://github.com/espressif/arduino-esp32/blob/master/libraries/Wire/src/Wire.h.
+ */
+
+#ifndef SIM_WIRE_H
+#define SIM_WIRE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <functional>
+#include "sim.h"
+
+const size_t SIM_I2C_BUFFER = 128;                        // I2C_BUFFER_LENGTH.
+
+class TwoWire {
+public:
+    bool    begin()                                       { return true; }
+    bool    begin(int sda, int scl, uint32_t frequency = 0) { (void)sda; (void)scl; clock_ = (frequency != 0) ? frequency : clock_; return true; }
+    void    setClock(uint32_t frequency)                  { clock_ = frequency; }
+    void    beginTransmission(uint16_t address)           { address_ = address; txLen_ = 0; }
+    size_t  write(uint8_t c)                              { return write(&c, 1); }
+    size_t  write(const uint8_t* data, size_t len) {
+        len = (len > SIM_I2C_BUFFER - txLen_) ? SIM_I2C_BUFFER - txLen_ : len;
+        memcpy(&tx_[txLen_], data, len);
+        txLen_ += len;
+        return len;
+    }
+    uint8_t endTransmission(bool sendStop = true) {
+        (void)sendStop;
+        simBusyUs(((int64_t)(txLen_ + 1) * 9 * 1000000) / clock_);
+        return simTx ? simTx(address_, tx_, txLen_) : 2;
+    }
+    uint32_t simClock()                                   { return clock_; }
+
+    // -- Sim side. --
+    std::function<uint8_t(uint16_t address, const uint8_t* data, size_t len)> simTx;
+
+private:
+    uint32_t clock_   = 100000;
+    uint16_t address_ = 0;
+    size_t   txLen_   = 0;
+    uint8_t  tx_[SIM_I2C_BUFFER];
+};
+
+extern TwoWire Wire;
+extern TwoWire Wire1;
+
+#endif
@@ -0,0 +1,31 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: ESP-IDF chip info.
+ * *************************************************************************
+ *
+ * esp_chip_info.h
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ */
+
+#ifndef SIM_ESP_CHIP_INFO_H
+#define SIM_ESP_CHIP_INFO_H
+
+#include <stdint.h>
+
+typedef struct {
+    int      model;
+    uint32_t features;
+    uint16_t revision;
+    uint8_t  cores;
+} esp_chip_info_t;
+
+static inline void esp_chip_info(esp_chip_info_t* info) {
+    info->model    = 9;                                   // CHIP_ESP32S3.
+    info->features = 0;
+    info->revision = 2;
+    info->cores    = 2;
+}
+
+#endif
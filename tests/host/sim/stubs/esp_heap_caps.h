@@ -0,0 +1,35 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: ESP-IDF heap_caps.
+ * *************************************************************************
+ *
+ * esp_heap_caps.h
+ *
+ * MALLOC_CAP_SPIRAM allocations are counted as PSRAM, everything else as internal RAM. Freed with free().
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    simPsramAlloc() in sim.h.
+ */
+
+#ifndef SIM_ESP_HEAP_CAPS_H
+#define SIM_ESP_HEAP_CAPS_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "sim.h"
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+
+static inline void* heap_caps_malloc(size_t size, uint32_t caps) {
+    return (caps & MALLOC_CAP_SPIRAM) ? simPsramAlloc(size) : malloc(size);
+}
+
+static inline void heap_caps_free(void* ptr) {
+    free(ptr);
+}
+
+#endif
@@ -0,0 +1,40 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: ESP-IDF system & the ESP object.
+ * *************************************************************************
+ *
+ * esp_system.h
+ *
+ * esp_restart() ends the calling task (SimTaskExit) & is counted; the driver reports it. Heap numbers come
+ * from the sim heap counters (sim.h).
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    sim.h.
+ */
+
+#ifndef SIM_ESP_SYSTEM_H
+#define SIM_ESP_SYSTEM_H
+
+#include <stdint.h>
+#include <atomic>
+#include "sim.h"
+
+extern std::atomic<uint32_t> simRestarts;                 // # of esp_restart() calls.
+
+[[noreturn]] void esp_restart();
+
+class EspClass {
+public:
+    uint32_t    getFreeHeap()                             { SimHeapStats heap = simHeapStats(); return (uint32_t)(SIM_HEAP_SIZE - heap.inUse); }
+    uint32_t    getMinFreeHeap()                          { SimHeapStats heap = simHeapStats(); return (uint32_t)(SIM_HEAP_SIZE - heap.peak); }
+    uint32_t    getHeapSize()                             { return (uint32_t)SIM_HEAP_SIZE; }
+    uint32_t    getFreePsram()                            { SimHeapStats heap = simHeapStats(); return (uint32_t)(SIM_PSRAM_SIZE - heap.psramInUse); }
+    uint32_t    getPsramSize()                            { return (uint32_t)SIM_PSRAM_SIZE; }
+    const char* getChipModel()                            { return "ESP32-S3 (host sim)"; }
+    uint64_t    getEfuseMac()                             { return 0x0000A1B2C3D4E5F6ULL; }
+    void        restart()                                 { esp_restart(); }
+};
+extern EspClass ESP;
+
+#endif
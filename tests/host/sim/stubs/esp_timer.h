@@ -0,0 +1,23 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: ESP-IDF esp_timer.
+ * *************************************************************************
+ *
+ * esp_timer.h
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    simNowUs() in sim.h.
+ */
+
+#ifndef SIM_ESP_TIMER_H
+#define SIM_ESP_TIMER_H
+
+#include <stdint.h>
+#include "sim.h"
+
+static inline int64_t esp_timer_get_time() {
+    return simNowUs();
+}
+
+#endif
@@ -0,0 +1,89 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: FreeRTOS (ESP-IDF flavour).
+ * *************************************************************************
+ *
+ * FreeRTOS.h
+ *
+ * Tasks, notifications, queues & critical sections the sketch uses, on host threads (sim.cpp).
+ * 1 tick = 1 ms (CONFIG_FREERTOS_HZ 1000). Stack sizes are in bytes, as in ESP-IDF. No run time stats.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    sim.h, sim.cpp.
+ * @link   https://docs.espressif.com/projects/esp-idf/en/stable/esp32s3/api-reference/system/freertos_idf.html.
+ */
+
+#ifndef SIM_FREERTOS_H
+#define SIM_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sim.h"
+
+// --- Types & config. ---
+typedef uint32_t          TickType_t;
+typedef int               BaseType_t;
+typedef unsigned int      UBaseType_t;
+typedef SimTask*          TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+struct SimQueue;
+typedef SimQueue*         QueueHandle_t;
+
+#define pdTRUE                          1
+#define pdFALSE                         0
+#define pdPASS                          1
+#define pdFAIL                          0
+#define portMAX_DELAY                   ((TickType_t)0xFFFFFFFF)
+#define portTICK_PERIOD_MS              1
+#define pdMS_TO_TICKS(ms)               ((TickType_t)(ms))
+#define configTICK_RATE_HZ              1000
+#define configMAX_TASK_NAME_LEN         16
+#define configGENERATE_RUN_TIME_STATS   0
+#define tskNO_AFFINITY                  0x7FFFFFFF
+
+// --- Critical sections: spinlock across threads (no interrupts to mask on a host). ---
+typedef struct {
+    int lock;
+} portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED    {0}
+
+static inline void simMuxEnter(portMUX_TYPE* mux) {
+    while (__atomic_exchange_n(&mux->lock, 1, __ATOMIC_ACQUIRE) != 0) {
+        while (__atomic_load_n(&mux->lock, __ATOMIC_RELAXED) != 0) {
+        }
+    }
+}
+
+static inline void simMuxExit(portMUX_TYPE* mux) {
+    __atomic_store_n(&mux->lock, 0, __ATOMIC_RELEASE);
+}
+
+#define portENTER_CRITICAL(mux)         simMuxEnter(mux)
+#define portEXIT_CRITICAL(mux)          simMuxExit(mux)
+#define portENTER_CRITICAL_ISR(mux)     simMuxEnter(mux)
+#define portEXIT_CRITICAL_ISR(mux)      simMuxExit(mux)
+
+// --- Tasks. ---
+BaseType_t   xTaskCreate(TaskFunction_t function, const char* name, uint32_t stackSize, void* param, UBaseType_t priority, TaskHandle_t* handle);
+BaseType_t   xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackSize, void* param, UBaseType_t priority,
+                                     TaskHandle_t* handle, BaseType_t core);
+void         vTaskDelay(TickType_t ticks);
+void         vTaskDelete(TaskHandle_t task);
+void         vTaskSuspend(TaskHandle_t task);
+void         taskYIELD();
+uint32_t     ulTaskNotifyTake(BaseType_t clear, TickType_t wait);
+BaseType_t   xTaskNotifyGive(TaskHandle_t task);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+TaskHandle_t xTaskGetHandle(const char* name);
+char*        pcTaskGetName(TaskHandle_t task);
+UBaseType_t  uxTaskGetStackHighWaterMark(TaskHandle_t task);
+TickType_t   xTaskGetTickCount();
+
+// --- Queues (copy by value, FIFO). ---
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t    xQueueSend(QueueHandle_t queue, const void* item, TickType_t wait);
+BaseType_t    xQueueReceive(QueueHandle_t queue, void* item, TickType_t wait);
+UBaseType_t   uxQueueMessagesWaiting(QueueHandle_t queue);
+
+#endif
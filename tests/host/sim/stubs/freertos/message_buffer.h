@@ -0,0 +1,32 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Host stand-in: FreeRTOS message buffers.
+ * *************************************************************************
+ *
+ * message_buffer.h
+ *
+ * Variable length messages, each stored with a 4 byte length (sizeof(size_t) on ESP32), so a buffer of
+ * N bytes holds the same messages as on the device. Blocking waits end with SimTaskExit after simStop().
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-12:00pm] New.
+ * @see    sim.cpp.
+ * @link   https://www.freertos.org/Documentation/02-Kernel/04-API-references/10-Message-buffers/00-Message-buffers.
+ */
+
+#ifndef SIM_MESSAGE_BUFFER_H
+#define SIM_MESSAGE_BUFFER_H
+
+#include "freertos/FreeRTOS.h"
+
+struct SimMessageBuffer;
+typedef SimMessageBuffer* MessageBufferHandle_t;
+
+MessageBufferHandle_t xMessageBufferCreate(size_t size);
+size_t     xMessageBufferSend(MessageBufferHandle_t buffer, const void* data, size_t len, TickType_t wait);
+size_t     xMessageBufferReceive(MessageBufferHandle_t buffer, void* data, size_t maxLen, TickType_t wait);
+BaseType_t xMessageBufferReset(MessageBufferHandle_t buffer);
+size_t     xMessageBufferSpacesAvailable(MessageBufferHandle_t buffer);
+BaseType_t xMessageBufferIsEmpty(MessageBufferHandle_t buffer);
+
+#endif
@@ -0,0 +1,179 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - metrics.h host test.
+ * *************************************************************************
+ *
+ * test_metrics.cpp
+ *
+ * Seqlock: a writer thread against a reader thread (no torn copy is ever accepted), a write left open
+ * (every try fails, copy unchanged, METRIC_READ_YIELD() between tries). Histogram: bucket edges (0, 1,
+ * 2^n, 2^19 us & above), percentiles since boot & over a window (hist - prev), empty window, throughput
+ * (ns/record, ns/read).
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-04:00pm] New.
+ * @see    metrics.h, metricsSampleLoop(), metricsToBrowser().
+ * @link   http://dougfoster.me.
+ */
+
+#include "hostTest.h"
+
+#include <atomic>
+#include <thread>
+
+static std::atomic<uint32_t> readYields{0};               // METRIC_READ_YIELD() calls.
+#define METRIC_READ_YIELD() readYields++
+
+#include "metrics.h"
+
+// --- Seqlock snapshot. ---
+struct Snapshot {                                         // Every word is the write #, so a torn copy mixes two.
+    uint32_t word[256];
+};
+MetricSeqlock snapshotLock = {};
+Snapshot      snapshot     = {};
+
+/**
+ * -------------------------------------------------------------------------
+ *  Copy is whole: every word the same.
+ * -------------------------------------------------------------------------
+ *
+ * @param  const Snapshot* copy Copy.
+ * @return bool                 true if not torn.
+ */
+static bool whole(const Snapshot* copy) {
+    for (size_t i = 1; i < sizeof(copy->word) / sizeof(copy->word[0]); i++) {
+        if (copy->word[i] != copy->word[0]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+
+    // --- Seqlock: writer thread vs reader thread. ---
+    const uint32_t    WRITES   = 200000;
+    std::atomic<bool> done{false};
+    Snapshot          copy     = {};
+    Snapshot          scratch  = {};
+    uint32_t          accepted = 0;
+    uint32_t          stale    = 0;
+    uint32_t          torn     = 0;
+    uint32_t          backward = 0;
+    uint32_t          last     = 0;
+    std::thread writer([&]() {
+        for (uint32_t n = 1; n <= WRITES; n++) {
+            metricWriteBegin(&snapshotLock);
+            for (size_t i = 0; i < sizeof(snapshot.word) / sizeof(snapshot.word[0]); i++) {
+                snapshot.word[i] = n;
+            }
+            metricWriteEnd(&snapshotLock);
+            int64_t until = hostTestNowNs() + 500;        // Writers publish once per pass, not back to back.
+            while (hostTestNowNs() < until) {
+            }
+        }
+        done = true;
+    });
+    while (!done) {
+        if (!metricRead(&snapshotLock, &snapshot, &copy, sizeof(copy), &scratch)) {
+            stale++;
+            continue;
+        }
+        accepted++;
+        torn     += whole(&copy) ? 0 : 1;
+        backward += (copy.word[0] < last) ? 1 : 0;        // One writer: copies never go back in time.
+        last      = copy.word[0];
+    }
+    writer.join();
+    CHECK(torn == 0);
+    CHECK(backward == 0);
+    CHECK(accepted > 0);
+    CHECK(metricRead(&snapshotLock, &snapshot, &copy, sizeof(copy), &scratch));
+    CHECK(whole(&copy) && (copy.word[0] == WRITES));
+    printf("metrics: seqlock %u writes, %u reads accepted, %u stale, %u retries, 0 torn\n",
+           WRITES, accepted, stale, readYields.load());
+
+    // --- Seqlock: write left open (reader preempted the writer). Stale, copy unchanged. ---
+    readYields = 0;
+    metricWriteBegin(&snapshotLock);
+    snapshot.word[0] = 0;
+    memset(&copy, 0xA5, sizeof(copy));
+    CHECK(!metricRead(&snapshotLock, &snapshot, &copy, sizeof(copy), &scratch));
+    CHECK(readYields == METRIC_READ_TRIES);
+    CHECK(whole(&copy) && (copy.word[0] == 0xA5A5A5A5));
+    snapshot.word[0] = WRITES;
+    metricWriteEnd(&snapshotLock);
+    CHECK(metricRead(&snapshotLock, &snapshot, &copy, sizeof(copy), &scratch) && whole(&copy));
+
+    // --- Buckets: 0 & 1 -> 0, 2^n -> n, 2^n - 1 -> n - 1, 2^19 & above -> last. ---
+    MetricHistogram hist = {};
+    metricHistRecord(&hist, -5);
+    metricHistRecord(&hist, 0);
+    metricHistRecord(&hist, 1);
+    CHECK(hist.bucket[0] == 3);
+    CHECK((hist.maxUs == 1) && (hist.sumUs == 1));
+    for (uint8_t n = 1; n < METRIC_BUCKETS; n++) {
+        hist = {};
+        metricHistRecord(&hist, (int64_t)1 << n);
+        metricHistRecord(&hist, ((int64_t)1 << n) - 1);
+        CHECK(hist.bucket[n] == 1);
+        CHECK(hist.bucket[n - 1] == 1);
+        CHECK(metricHistBucketMax(n - 1) == ((uint32_t)1 << n) - 1);
+    }
+    hist = {};
+    metricHistRecord(&hist, (int64_t)1 << 19);
+    metricHistRecord(&hist, (int64_t)1 << 25);
+    metricHistRecord(&hist, (int64_t)1 << 40);            // Capped at UINT32_MAX.
+    CHECK(hist.bucket[METRIC_BUCKETS - 1] == 3);
+    CHECK(hist.count == 3);
+    CHECK(hist.maxUs == UINT32_MAX);
+    CHECK(hist.sumUs == ((uint64_t)1 << 19) + ((uint64_t)1 << 25) + UINT32_MAX);
+    CHECK(metricHistBucketMax(METRIC_BUCKETS - 1) == UINT32_MAX);
+
+    // --- Percentiles since boot: bucket upper bound, capped at maxUs. ---
+    hist = {};
+    CHECK(metricHistPercentile(&hist, NULL, 95) == 0);    // No samples.
+    for (int64_t us = 1; us <= 100; us++) {
+        metricHistRecord(&hist, us);
+    }
+    CHECK(metricHistPercentile(&hist, NULL, 1) == 1);     // Rank 1: bucket 0.
+    CHECK(metricHistPercentile(&hist, NULL, 50) == 63);   // Rank 50: 32 .. 63.
+    CHECK(metricHistPercentile(&hist, NULL, 95) == 100);  // Rank 95: 64 .. 127, capped at maxUs.
+    CHECK(metricHistPercentile(&hist, NULL, 100) == 100);
+
+    // --- Percentiles over a window (hist - prev). ---
+    MetricHistogram prev = hist;
+    CHECK(metricHistPercentile(&hist, &prev, 95) == 0);   // Empty window.
+    for (int i = 0; i < 10; i++) {
+        metricHistRecord(&hist, 10);
+    }
+    CHECK(metricHistPercentile(&hist, &prev, 50) == 15);  // Window only: 8 .. 15, not the boot samples.
+    CHECK(metricHistPercentile(&hist, &prev, 100) == 15);
+    CHECK(metricHistPercentile(&hist, NULL, 50) == 63);   // Since boot: 110 samples, rank 55 in 32 .. 63.
+    metricHistRecord(&hist, 5000);
+    CHECK(metricHistPercentile(&hist, &prev, 95) == 5000);
+    prev = hist;
+    CHECK(metricHistPercentile(&hist, &prev, 50) == 0);   // Empty again.
+
+    // --- Throughput: record (random latencies) & read (uncontended). ---
+    const int ROUNDS = 2000000;
+    uint32_t  seed   = 0x1234567;
+    double    nsPerRecord;
+    double    nsPerRead;
+    hist = {};
+    int64_t start = hostTestNowNs();
+    for (int round = 0; round < ROUNDS; round++) {
+        metricHistRecord(&hist, hostTestRandom(&seed) >> (12 + (hostTestRandom(&seed) & 15)));   // 0 .. ~1 s, every bucket.
+    }
+    nsPerRecord = (double)(hostTestNowNs() - start) / ROUNDS;
+    CHECK(hist.count == (uint32_t)ROUNDS);
+    start = hostTestNowNs();
+    for (int round = 0; round < ROUNDS / 10; round++) {
+        accepted += metricRead(&snapshotLock, &snapshot, &copy, sizeof(copy), &scratch) ? 1 : 0;
+    }
+    nsPerRead = (double)(hostTestNowNs() - start) / (ROUNDS / 10);
+    printf("metrics: %.2f ns/record, %.1f ns/read (%zu byte snapshot), p95 %u us\n",
+           nsPerRecord, nsPerRead, sizeof(Snapshot), metricHistPercentile(&hist, NULL, 95));
+    return hostTestFailures;
+}
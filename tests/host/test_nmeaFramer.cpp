@@ -0,0 +1,131 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - nmeaFramer.h host test.
+ * *************************************************************************
+ *
+ * test_nmeaFramer.cpp
+ *
+ * Checksum round trip, bad checksum/overflow/restart handling, type lookup, throughput (ns/byte).
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-09:30am] New.
+ * @see    nmeaFramer.h.
+ * @link   http://dougfoster.me.
+ */
+
+#include "hostTest.h"
+#include "nmeaFramer.h"
+
+#include <string.h>
+#include <string>
+
+// --- Test sentences (UBLOX_CFG_NMEA_HIGHPREC), without checksum. ---
+const char* const BODIES[] = {
+    "GNGGA,172814.00,3723.4658394,N,12202.2695291,W,4,12,0.60,23.456,M,-32.100,M,1.0,0000",
+    "GNRMC,172814.00,A,3723.4658394,N,12202.2695291,W,0.012,,161026,,,R,V",
+    "GNGSA,A,3,02,05,13,15,18,20,23,24,29,,,,1.10,0.60,0.92,1",
+    "GPGSV,3,1,11,02,43,236,45,05,37,297,43,13,62,051,47,15,31,104,42,1",
+    "GNGST,172814.00,12,0.010,0.008,42.1,0.009,0.009,0.016",
+    "GNTXT,01,01,02,ANTSTATUS=OK",
+    "GNGLL,3723.4658394,N,12202.2695291,W,172814.00,A,R",
+    "GNVTG,,T,,M,0.012,N,0.022,K,R",
+    "GNZDA,172814.00,16,10,2026,00,00",
+    "GNGNS,172814.00,3723.4658394,N,12202.2695291,W,RRRN,12,0.60,23.456,-32.100,1.0,0000,V",
+    "PUBX,00,172814.00,3723.46584,N,12202.26953,W,23.456,R2,0.01,0.01,0.012,0.0,0.0,,0.60,0.92,0.40,12,0,0"
+};
+const uint8_t TYPES[] = {NMEA_TYPE_GGA, NMEA_TYPE_RMC, NMEA_TYPE_GSA, NMEA_TYPE_GSV, NMEA_TYPE_GST, NMEA_TYPE_TXT,
+                         NMEA_TYPE_GLL, NMEA_TYPE_VTG, NMEA_TYPE_ZDA, NMEA_TYPE_GNS, NMEA_TYPE_OTHER};
+const uint8_t NUM_BODIES = sizeof(BODIES) / sizeof(BODIES[0]);
+
+/**
+ * -------------------------------------------------------------------------
+ *  Build "$<body>*hh[CR][LF]".
+ * -------------------------------------------------------------------------
+ *
+ * @param  array  body  Sentence between '$' & '*'.
+ * @param  bool   lower Lower case checksum digits.
+ * @return string       Sentence.
+ */
+static std::string sentence(const char* body, bool lower) {
+    uint8_t checksum = 0;
+    for (const char* p = body; *p != '\0'; p++) {
+        checksum ^= (uint8_t)*p;
+    }
+    char tail[8];
+    snprintf(tail, sizeof(tail), lower ? "*%02x\r\n" : "*%02X\r\n", checksum);
+    return std::string("$") + body + tail;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Push a string, return the last non-pending status.
+ * -------------------------------------------------------------------------
+ *
+ * @param  NmeaFramer* framer Framer.
+ * @param  string      bytes  Bytes.
+ * @return int                Last status other than NMEA_FRAME_PENDING, -1 = none.
+ */
+static int pushAll(NmeaFramer* framer, const std::string& bytes) {
+    int last = -1;
+    for (char c : bytes) {
+        NmeaFrameStatus status = nmeaFramerPush(framer, c);
+        if (status != NMEA_FRAME_PENDING) {
+            last = status;
+        }
+    }
+    return last;
+}
+
+int main() {
+    NmeaFramer framer = {};
+
+    // --- Round trip: every type, upper & lower case checksum, buf holds the sentence as received. ---
+    for (uint8_t i = 0; i < NUM_BODIES; i++) {
+        for (int lower = 0; lower < 2; lower++) {
+            std::string s = sentence(BODIES[i], lower);
+            CHECK(pushAll(&framer, s) == NMEA_FRAME_OK);
+            CHECK(framer.len == s.size());
+            CHECK(strcmp(framer.buf, s.c_str()) == 0);
+            CHECK(framer.type == TYPES[i]);
+        }
+    }
+    CHECK(framer.sentencesOk == 2u * NUM_BODIES);
+
+    // --- Every single byte change in the body is caught by the checksum. ---
+    std::string gga = sentence(BODIES[0], false);
+    uint32_t    bad = 0;
+    for (size_t at = 1; gga[at] != '*'; at++) {
+        std::string s = gga;
+        s[at] = (s[at] == '0') ? '1' : '0';
+        bad  += (pushAll(&framer, s) == NMEA_FRAME_BAD_CHECKSUM);
+    }
+    CHECK(bad == gga.find('*') - 1);
+    CHECK(pushAll(&framer, "$GNTXT,01*ZZ\r\n") == NMEA_FRAME_BAD_CHECKSUM);
+
+    // --- Garbage between sentences, a sentence cut short by '$', overflow. ---
+    framer = {};
+    CHECK(pushAll(&framer, "\xB5\x62 noise " + sentence(BODIES[1], false)) == NMEA_FRAME_OK);
+    CHECK(pushAll(&framer, "$GNGGA,1728" + sentence(BODIES[0], false)) == NMEA_FRAME_OK);
+    CHECK(framer.restarts == 1);
+    CHECK(pushAll(&framer, "$" + std::string(NMEA_MAX_LEN, 'A')) == NMEA_FRAME_OVERFLOW);
+    CHECK(framer.overflows == 1);
+    CHECK(pushAll(&framer, sentence(BODIES[2], false)) == NMEA_FRAME_OK);
+
+    // --- Throughput. ---
+    std::string stream;
+    for (uint8_t i = 0; i < NUM_BODIES; i++) {
+        stream += sentence(BODIES[i], false);
+    }
+    const int ROUNDS = 20000;
+    uint32_t  ok     = 0;
+    int64_t   start  = hostTestNowNs();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (char c : stream) {
+            ok += (nmeaFramerPush(&framer, c) == NMEA_FRAME_OK);
+        }
+    }
+    double nsPerByte = (double)(hostTestNowNs() - start) / ((double)stream.size() * ROUNDS);
+    CHECK(ok == (uint32_t)NUM_BODIES * ROUNDS);
+    printf("nmeaFramer: %u sentences, %.2f ns/byte (push + checksum + classify), 400 kHz I2C = ~22500 ns/byte\n", ok, nsPerByte);
+    return hostTestFailures;
+}
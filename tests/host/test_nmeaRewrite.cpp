@@ -0,0 +1,182 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - nmeaRewrite.h host test.
+ * *************************************************************************
+ *
+ * test_nmeaRewrite.cpp
+ *
+ * Instrument height, position & height lock on every rewritten type, checksum re-framing (each output goes
+ * back through nmeaFramer.h), altitude text edge cases, untouched types, throughput (ns/sentence).
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-01:00pm] New.
+ * @see    nmeaRewrite.h, nmeaFramer.h.
+ * @link   http://dougfoster.me.
+ */
+
+#include "hostTest.h"
+#include "nmeaRewrite.h"
+
+#include <string.h>
+#include <string>
+
+// --- Test sentences (UBLOX_CFG_NMEA_HIGHPREC), without checksum. ---
+const char* const GGA       = "GNGGA,123519.00,4807.0381234,N,01131.0001234,E,4,12,0.60,545.4123,M,46.9000,M,1.0,0000";
+const char* const GGA_SOUTH = "GNGGA,123521.00,4807.0381999,S,01131.0001999,W,1,08,1.0,0.0500,M,-12.3,M,,";
+const char* const GGA_NOFIX = "GNGGA,123520.00,,,,,0,00,99.99,,,,,,";
+const char* const RMC       = "GNRMC,123519.00,A,4807.0381234,N,01131.0001234,E,0.010,,161026,,,R,V";
+const char* const GLL       = "GNGLL,4807.0381234,N,01131.0001234,E,123519.00,A,R";
+const char* const GNS       = "GNGNS,123519.00,4807.0381234,N,01131.0001234,E,RRRR,12,0.60,545.4123,46.9000,1.0,0000,V";
+const char* const GSV       = "GPGSV,3,1,12,01,40,083,46,02,17,308,41,12,07,344,39,14,22,228,45";
+const char* const GSA       = "GNGSA,A,3,01,02,12,14,,,,,,,,,1.20,0.60,1.00,1";
+
+/**
+ * -------------------------------------------------------------------------
+ *  Build "$<body>*hh[CR][LF]".
+ * -------------------------------------------------------------------------
+ *
+ * @param  array  body Sentence between '$' & '*'.
+ * @return string      Sentence.
+ */
+static std::string sentence(const char* body) {
+    uint8_t checksum = 0;
+    for (const char* p = body; *p != '\0'; p++) {
+        checksum ^= (uint8_t)*p;
+    }
+    char tail[8];
+    snprintf(tail, sizeof(tail), "*%02X\r\n", checksum);
+    return std::string("$") + body + tail;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Field text.
+ * -------------------------------------------------------------------------
+ *
+ * @param  string  s     Sentence.
+ * @param  uint8_t field Field # (0 = address).
+ * @return string        Field text, "<none>" if missing.
+ */
+static std::string field(const std::string& s, uint8_t field) {
+    uint16_t start;
+    int16_t  len = nmeaFieldFind(s.c_str(), (uint16_t)s.size(), field, &start);
+    return (len < 0) ? "<none>" : s.substr(start, len);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Frame, capture pending locks, rewrite, re-frame - like DevUBLOXGNSS::processNMEA().
+ * -------------------------------------------------------------------------
+ *
+ * @param  NmeaRewriter* rw       Rewriter.
+ * @param  array         body     Sentence between '$' & '*'.
+ * @param  int32_t       heightMm Instrument height (mm).
+ * @return string                 Rewritten sentence, "" if it didn't frame again (bad checksum or length).
+ */
+static std::string rewrite(NmeaRewriter* rw, const char* body, int32_t heightMm) {
+    NmeaFramer  framer = {};
+    std::string in     = sentence(body);
+    for (char c : in) {
+        nmeaFramerPush(&framer, c);
+    }
+    if ((framer.type == NMEA_TYPE_GGA) && (rw->lockPending != 0)) {
+        nmeaLockCapture(rw, framer.buf, framer.len);
+    }
+    uint16_t    len = nmeaRewrite(rw, framer.buf, framer.len, framer.type, heightMm);
+    std::string out(framer.buf, len);
+    NmeaFramer  again = {};
+    NmeaFrameStatus status = NMEA_FRAME_PENDING;
+    for (char c : out) {
+        status = nmeaFramerPush(&again, c);
+    }
+    CHECK(strlen(framer.buf) == len);
+    return ((status == NMEA_FRAME_OK) && (again.len == len)) ? out : std::string();
+}
+
+int main() {
+    NmeaRewriter rw = {};
+    std::string  s;
+
+    // --- Instrument height: GGA & GNS altitude, other fields as received. ---
+    s = rewrite(&rw, GGA, 128);
+    CHECK(field(s, 9) == "545.2843");
+    CHECK(field(s, 2) == "4807.0381234");
+    CHECK(field(s, 11) == "46.9000");
+    CHECK(field(rewrite(&rw, GNS, 128), 9) == "545.2843");
+    CHECK(field(rewrite(&rw, GGA_SOUTH, 128), 9) == "-0.0780");
+    CHECK(rewrite(&rw, GGA, 0) == sentence(GGA));              // No height, no lock: unchanged.
+    CHECK(rewrite(&rw, GGA_NOFIX, 128) == sentence(GGA_NOFIX));  // Empty altitude stays empty.
+    CHECK(rewrite(&rw, GSV, 128) == sentence(GSV));
+    CHECK(rewrite(&rw, GSA, 128) == sentence(GSA));
+
+    // --- Locks wait for a GGA with a fix, then apply to every type with the fields. ---
+    rw.lockPending = NMEA_LOCK_POSITION | NMEA_LOCK_HEIGHT;
+    rewrite(&rw, GGA_NOFIX, 0);
+    CHECK(rw.lockPending == (NMEA_LOCK_POSITION | NMEA_LOCK_HEIGHT));
+    CHECK(rw.locked == 0);
+    rewrite(&rw, GGA, 128);
+    CHECK(rw.lockPending == 0);
+    CHECK(rw.locked == (NMEA_LOCK_POSITION | NMEA_LOCK_HEIGHT));
+    s = rewrite(&rw, GGA_SOUTH, 128);
+    CHECK(field(s, 1) == "123521.00");                          // Time as received.
+    CHECK(field(s, 2) == "4807.0381234");
+    CHECK(field(s, 3) == "N");
+    CHECK(field(s, 4) == "01131.0001234");
+    CHECK(field(s, 5) == "E");
+    CHECK(field(s, 9) == "545.2843");                           // Locked altitude - instrument height.
+    CHECK(field(s, 11) == "46.9000");
+    s = rewrite(&rw, GGA_NOFIX, 0);
+    CHECK(field(s, 4) == "01131.0001234");
+    CHECK(field(s, 9) == "545.4123");
+    rw.locked = NMEA_LOCK_POSITION;
+    rw.lat    = {"4807.1111111", 12};
+    CHECK(field(rewrite(&rw, RMC, 0), 3) == "4807.1111111");
+    CHECK(field(rewrite(&rw, GLL, 0), 1) == "4807.1111111");
+    s = rewrite(&rw, GNS, 2000);
+    CHECK(field(s, 2) == "4807.1111111");
+    CHECK(field(s, 9) == "543.4123");
+    CHECK(field(s, 10) == "46.9000");
+
+    // --- Checksum re-framing: every rewrite above framed again (rewrite() returns "" otherwise). ---
+    CHECK(!rewrite(&rw, GGA, 128).empty());
+    CHECK(!rewrite(&rw, GGA_SOUTH, -128).empty());
+    CHECK(rw.skipped == 0);
+
+    // --- Altitude text. ---
+    NmeaField out;
+    CHECK(nmeaAltitudeShift("12.3", 4, 128, &out) && (strcmp(out.text, "12.2") == 0));
+    CHECK(nmeaAltitudeShift("12", 2, 600, &out) && (strcmp(out.text, "11") == 0));
+    CHECK(nmeaAltitudeShift("0.100", 5, 128, &out) && (strcmp(out.text, "-0.028") == 0));
+    CHECK(nmeaAltitudeShift("-5.000", 6, 128, &out) && (strcmp(out.text, "-5.128") == 0));
+    CHECK(!nmeaAltitudeShift("1a", 2, 1, &out));
+    CHECK(!nmeaAltitudeShift("", 0, 1, &out));
+
+    // --- Throughput: copy only vs copy + rewrite (both locks, instrument height). ---
+    const char* const MIX[]  = {GGA, RMC, GSA, GSV, GSV, GSV, GLL, GNS};
+    const uint8_t     NUM    = sizeof(MIX) / sizeof(MIX[0]);
+    const int         ROUNDS = 200000;
+    std::string       mix[NUM];
+    uint8_t           type[NUM];
+    char              buf[NMEA_MAX_LEN];
+    uint32_t          sink   = 0;
+    double            nsPerSentence[2];
+    for (uint8_t i = 0; i < NUM; i++) {
+        mix[i]  = sentence(MIX[i]);
+        type[i] = nmeaClassify(mix[i].c_str(), (uint16_t)mix[i].size());
+    }
+    rw.locked = NMEA_LOCK_POSITION | NMEA_LOCK_HEIGHT;
+    for (int mode = 0; mode < 2; mode++) {
+        int64_t start = hostTestNowNs();
+        for (int round = 0; round < ROUNDS; round++) {
+            const std::string& m = mix[round % NUM];
+            memcpy(buf, m.c_str(), m.size() + 1);
+            sink += (mode == 0) ? (uint8_t)buf[5] : nmeaRewrite(&rw, buf, (uint16_t)m.size(), type[round % NUM], 128);
+        }
+        nsPerSentence[mode] = (double)(hostTestNowNs() - start) / ROUNDS;
+    }
+    CHECK(sink > 0);
+    CHECK(rw.skipped == 0);
+    printf("nmeaRewrite: %u rewritten, %.1f ns/sentence (copy only %.1f), 400 kHz I2C = ~2 ms/sentence\n",
+           rw.rewritten, nsPerSentence[1], nsPerSentence[0]);
+    return hostTestFailures;
+}
@@ -0,0 +1,379 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - ntripClient.h host test.
+ * *************************************************************************
+ *
+ * test_ntripClient.cpp
+ *
+ * Base64, v1/v2 requests, backoff, response header & v2 chunked parsing split at every byte boundary,
+ * & a stand-in caster on 127.0.0.1: refused, dropped mid-stream, reconnected. The client loop follows
+ * taskNtripClient() & the RTCM out must match what the caster sent, byte for byte.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-10:30am] New.
+ * @see    ntripClient.h, taskNtripClient().
+ * @link   http://dougfoster.me.
+ */
+
+#include "hostTest.h"
+#include "ntripClient.h"
+#include "rtcm3Framer.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+// --- Stand-in caster. ---
+const char     MOUNT[]      = "GHOST";
+const char     USER[]       = "rover";
+const char     PASS[]       = "secret";
+const uint16_t NUM_FRAMES   = 400;                        // RTCM frames served (half per session).
+const int      NUM_SESSIONS = 3;                          // Refused, dropped mid-stream, completed.
+
+/**
+ * -------------------------------------------------------------------------
+ *  Append one RTCM3 frame (CRC-valid, random payload).
+ * -------------------------------------------------------------------------
+ *
+ * @param  vector    out        Stream.
+ * @param  uint16_t  type       Message type.
+ * @param  uint16_t  payloadLen Message length (>= 2).
+ * @param  uint32_t* seed       Payload bytes.
+ * @return void      No output is returned.
+ */
+static void appendFrame(std::vector<uint8_t>& out, uint16_t type, uint16_t payloadLen, uint32_t* seed) {
+    size_t at = out.size();
+    out.push_back(RTCM3_PREAMBLE);
+    out.push_back((uint8_t)(payloadLen >> 8));
+    out.push_back((uint8_t)payloadLen);
+    out.push_back((uint8_t)(type >> 4));
+    out.push_back((uint8_t)(type << 4));
+    for (uint16_t i = 2; i < payloadLen; i++) {
+        out.push_back((uint8_t)hostTestRandom(seed));
+    }
+    uint32_t crc = rtcm3Crc24q(&out[at], RTCM3_HEADER_LEN + payloadLen);
+    out.push_back((uint8_t)(crc >> 16));
+    out.push_back((uint8_t)(crc >> 8));
+    out.push_back((uint8_t)crc);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  v2 chunked encoding of a byte range, random chunk sizes & an extension now & then.
+ * -------------------------------------------------------------------------
+ *
+ * @param  vector    rtcm  Bytes.
+ * @param  size_t    from  First byte.
+ * @param  size_t    to    Last byte + 1.
+ * @param  bool      last  Append the zero length chunk.
+ * @param  uint32_t* seed  Chunk sizes.
+ * @return string          Encoded body.
+ */
+static std::string chunked(const std::vector<uint8_t>& rtcm, size_t from, size_t to, bool last, uint32_t* seed) {
+    std::string out;
+    char        size[32];
+    for (size_t at = from; at < to;) {
+        size_t n = 1 + hostTestRandom(seed) % 700;
+        if (n > to - at) {
+            n = to - at;
+        }
+        snprintf(size, sizeof(size), ((at % 3) == 0) ? "%zx;ext=1\r\n" : "%zX\r\n", n);
+        out += size;
+        out.append((const char*)&rtcm[at], n);
+        out += "\r\n";
+        at  += n;
+    }
+    if (last) {
+        out += "0\r\n\r\n";
+    }
+    return out;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Parse a whole response split in two at every byte boundary.
+ * -------------------------------------------------------------------------
+ *
+ * @param  string response Header + body.
+ * @param  vector expect   RTCM bytes expected out.
+ * @return bool            true if every split gave expect & NTRIP_STATE_STREAMING.
+ */
+static bool everySplit(const std::string& response, const std::vector<uint8_t>& expect) {
+    static NtripSession session;
+    std::vector<uint8_t> buf;
+    std::vector<uint8_t> out;
+    for (size_t split = 0; split <= response.size(); split++) {
+        ntripSessionReset(&session);
+        out.clear();
+        for (int part = 0; part < 2; part++) {
+            size_t from = (part == 0) ? 0 : split;
+            size_t to   = (part == 0) ? split : response.size();
+            buf.assign(response.begin() + from, response.begin() + to);
+            size_t n = ntripReceive(&session, buf.data(), buf.size());
+            out.insert(out.end(), buf.begin(), buf.begin() + n);
+        }
+        if ((session.state != NTRIP_STATE_STREAMING) || (out != expect)) {
+            fprintf(stderr, "split at %zu: state %u, %zu of %zu bytes\n", split, session.state, out.size(), expect.size());
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Write all bytes in random sized pieces (TCP segments as a caster sends them).
+ * -------------------------------------------------------------------------
+ *
+ * @param  int       fd    Socket.
+ * @param  string    bytes Bytes.
+ * @param  uint32_t* seed  Piece sizes.
+ * @return void      No output is returned.
+ */
+static void sendPieces(int fd, const std::string& bytes, uint32_t* seed) {
+    for (size_t at = 0; at < bytes.size();) {
+        size_t n = 1 + hostTestRandom(seed) % 300;
+        if (n > bytes.size() - at) {
+            n = bytes.size() - at;
+        }
+        ssize_t sent = send(fd, bytes.data() + at, n, MSG_NOSIGNAL);
+        if (sent <= 0) {
+            return;
+        }
+        at += (size_t)sent;
+        if ((hostTestRandom(seed) % 8) == 0) {
+            usleep(200);                                        // Let the client see partial chunks.
+        }
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Stand-in caster: one session per accept().
+ * -------------------------------------------------------------------------
+ *
+ * Session 0 refuses (401). Session 1 streams the first half of the frames then closes without the zero
+ * length chunk (link dropped). Session 2 streams the rest & ends the stream.
+ *
+ * @param  int    listenFd Listening socket.
+ * @param  vector rtcm     RTCM stream.
+ * @param  size_t half     Byte offset of the first frame of the second half.
+ * @param  string requests Requests received (output).
+ * @return void   No output is returned.
+ */
+static void caster(int listenFd, const std::vector<uint8_t>* rtcm, size_t half, std::vector<std::string>* requests) {
+    uint32_t seed = 0xCAFE0001;
+    char     buf[1024];
+    for (int s = 0; s < NUM_SESSIONS; s++) {
+        int fd = accept(listenFd, NULL, NULL);
+        if (fd < 0) {
+            return;
+        }
+        std::string request;
+        while (request.find("\r\n\r\n") == std::string::npos) {
+            ssize_t n = recv(fd, buf, sizeof(buf), 0);
+            if (n <= 0) {
+                break;
+            }
+            request.append(buf, (size_t)n);
+        }
+        requests->push_back(request);
+        if (s == 0) {
+            sendPieces(fd, "HTTP/1.1 401 Unauthorized\r\nWWW-Authenticate: Basic realm=\"/GHOST\"\r\n\r\n", &seed);
+        } else {
+            std::string header = "HTTP/1.1 200 OK\r\nNtrip-Version: Ntrip/2.0\r\nContent-Type: gnss/data\r\nTransfer-Encoding: chunked\r\n\r\n";
+            sendPieces(fd, header + chunked(*rtcm, (s == 1) ? 0 : half, (s == 1) ? half : rtcm->size(), s == 2, &seed), &seed);
+        }
+        close(fd);
+    }
+}
+
+int main() {
+    static NtripSession session;
+    static char         request[NTRIP_REQUEST_MAX];
+    char                out[64];
+    uint32_t            seed = 0x0BADF00D;
+
+    // --- Base64 (RFC 4648 test vectors). ---
+    const char* const B64_IN[]  = {"", "f", "fo", "foo", "foob", "fooba", "foobar", "rover:secret"};
+    const char* const B64_OUT[] = {"", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy", "cm92ZXI6c2VjcmV0"};
+    for (uint8_t i = 0; i < 8; i++) {
+        CHECK(ntripBase64(B64_IN[i], out, sizeof(out)) == strlen(B64_OUT[i]));
+        CHECK(strcmp(out, B64_OUT[i]) == 0);
+    }
+    CHECK(ntripBase64("foobar", out, 8) == 0);                  // No room for '\0'.
+
+    // --- Requests. ---
+    CHECK(ntripBuildRequest(request, sizeof(request), "x.com", 2101, MOUNT, USER, PASS, 2) > 0);
+    CHECK(strncmp(request, "GET /GHOST HTTP/1.1\r\nHost: x.com:2101\r\nNtrip-Version: Ntrip/2.0\r\n", 65) == 0);
+    CHECK(strstr(request, "Authorization: Basic cm92ZXI6c2VjcmV0\r\n") != NULL);
+    CHECK(strcmp(request + strlen(request) - 4, "\r\n\r\n") == 0);
+    CHECK(ntripBuildRequest(request, sizeof(request), "x.com", 2101, MOUNT, "", "", 1) > 0);
+    CHECK(strncmp(request, "GET /GHOST HTTP/1.0\r\n", 21) == 0);
+    CHECK(strstr(request, "Authorization") == NULL);
+    CHECK(ntripBuildRequest(request, 40, "x.com", 2101, MOUNT, USER, PASS, 2) == 0);
+
+    // --- Backoff: 1 s doubling, 60 s cap. ---
+    CHECK(ntripBackoffMs(0) == 1000);
+    CHECK(ntripBackoffMs(1) == 2000);
+    CHECK(ntripBackoffMs(5) == 32000);
+    CHECK(ntripBackoffMs(6) == 60000);
+    CHECK(ntripBackoffMs(1000) == 60000);
+
+    // --- Parsing, every split: v1, v2 plain, v2 chunked (with extensions & the end chunk). ---
+    std::vector<uint8_t> rtcm;
+    for (uint16_t i = 0; i < 6; i++) {
+        appendFrame(rtcm, 1074 + 10 * (i % 3), (uint16_t)(20 + hostTestRandom(&seed) % 200), &seed);
+    }
+    std::string body((const char*)rtcm.data(), rtcm.size());
+    CHECK(everySplit("ICY 200 OK\r\n" + body, rtcm));
+    CHECK(everySplit("HTTP/1.1 200 OK\r\nNtrip-Version: Ntrip/2.0\r\n\r\n" + body, rtcm));
+    CHECK(everySplit("HTTP/1.1 200 OK\r\ntransfer-encoding:  Chunked\r\n\r\n" + chunked(rtcm, 0, rtcm.size(), true, &seed) + "junk", rtcm));
+
+    // --- Parsing, byte at a time. ---
+    std::string          response = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n" + chunked(rtcm, 0, rtcm.size(), false, &seed);
+    std::vector<uint8_t> byteOut;
+    ntripSessionReset(&session);
+    for (char c : response) {
+        uint8_t b = (uint8_t)c;
+        if (ntripReceive(&session, &b, 1) == 1) {
+            byteOut.push_back(b);
+        }
+    }
+    CHECK(byteOut == rtcm);
+
+    // --- Refused. ---
+    const char* const REFUSED[] = {"HTTP/1.1 401 Unauthorized\r\n\r\n", "SOURCETABLE 200 OK\r\nSTR;GHOST;...\r\n", "ICY 401\r\n"};
+    for (uint8_t i = 0; i < 3; i++) {
+        std::vector<uint8_t> buf(REFUSED[i], REFUSED[i] + strlen(REFUSED[i]));
+        ntripSessionReset(&session);
+        CHECK(ntripReceive(&session, buf.data(), buf.size()) == 0);
+        CHECK(session.state == NTRIP_STATE_FAILED);
+    }
+    CHECK(session.status != 200);
+
+    // --- Header too long (not a caster). ---
+    std::vector<uint8_t> longHeader(NTRIP_HEADER_MAX + 10, 'A');
+    ntripSessionReset(&session);
+    CHECK(ntripReceive(&session, longHeader.data(), longHeader.size()) == 0);
+    CHECK(session.state == NTRIP_STATE_FAILED);
+
+    // --- Stand-in caster on 127.0.0.1. ---
+    std::vector<uint8_t> stream;
+    size_t               half = 0;
+    for (uint16_t i = 0; i < NUM_FRAMES; i++) {
+        if (i == NUM_FRAMES / 2) {
+            half = stream.size();
+        }
+        appendFrame(stream, 1005 + (i % 5) * 17, (uint16_t)(2 + hostTestRandom(&seed) % 400), &seed);
+    }
+    int listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr = {};
+    socklen_t          addrLen = sizeof(addr);
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port        = 0;                                   // Any free port.
+    CHECK(bind(listenFd, (struct sockaddr*)&addr, sizeof(addr)) == 0);
+    CHECK(listen(listenFd, 1) == 0);
+    CHECK(getsockname(listenFd, (struct sockaddr*)&addr, &addrLen) == 0);
+    std::vector<std::string> requests;
+    std::thread              casterThread(caster, listenFd, &stream, half, &requests);
+
+    // -- Client, as taskNtripClient(): connect, request, receive, strip, count reconnects on streaming. --
+    static Rtcm3Framer   framer;
+    static uint8_t       frame[RTCM3_MAX_FRAME];
+    uint16_t             frameLen      = 0;
+    uint8_t              chunk[512];                            // NtripChunk.data.
+    std::vector<uint8_t> received;
+    uint32_t             reconnects    = 0;
+    uint32_t             refusals      = 0;
+    uint32_t             failures      = 0;
+    bool                 everStreamed  = false;
+    int64_t              start         = hostTestNowNs();
+    rtcm3FramerReset(&framer);
+    for (int s = 0; s < NUM_SESSIONS; s++) {
+        if (failures > 0) {
+            usleep(ntripBackoffMs(failures - 1));               // ms -> us: same sequence, 1000x faster.
+        }
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+            CHECK(false);
+            break;
+        }
+        size_t requestLen = ntripBuildRequest(request, sizeof(request), "127.0.0.1", ntohs(addr.sin_port), MOUNT, USER, PASS, 2);
+        CHECK(send(fd, request, requestLen, MSG_NOSIGNAL) == (ssize_t)requestLen);
+        ntripSessionReset(&session);
+        bool up = false;
+        for (;;) {
+            ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+            if (n <= 0) {
+                break;                                          // Closed: reconnect.
+            }
+            size_t numBytes = ntripReceive(&session, chunk, (size_t)n);
+            if (session.state == NTRIP_STATE_FAILED) {
+                refusals++;
+                break;
+            }
+            if ((session.state == NTRIP_STATE_STREAMING) && (!up)) {
+                reconnects  += everStreamed ? 1 : 0;
+                everStreamed = true;
+                up           = true;
+            }
+            if (numBytes > 0) {
+                received.insert(received.end(), chunk, chunk + numBytes);
+                rtcm3FramerPush(&framer, chunk, numBytes);
+                while (rtcm3FramerNext(&framer, frame, &frameLen)) {
+                }
+                failures = 0;
+            }
+        }
+        close(fd);
+        failures += up ? 0 : 1;                                 // Refused or no answer: back off.
+    }
+    double elapsedMs = (double)(hostTestNowNs() - start) / 1e6;
+    casterThread.join();
+    close(listenFd);
+
+    // -- Results: refused once, one successful reconnect, RTCM byte exact across the drop. --
+    CHECK(requests.size() == (size_t)NUM_SESSIONS);
+    for (const std::string& r : requests) {
+        CHECK(r.find("GET /GHOST HTTP/1.1\r\n") == 0);
+        CHECK(r.find("Authorization: Basic cm92ZXI6c2VjcmV0\r\n") != std::string::npos);
+    }
+    CHECK(refusals == 1);
+    CHECK(reconnects == 1);
+    CHECK(received == stream);
+    CHECK(framer.framesOk == NUM_FRAMES);
+    CHECK(framer.framesCrcBad == 0);
+    CHECK(session.chunkState == NTRIP_CHUNK_DONE);
+
+    // --- Throughput (ntripReceive() on chunked data). ---
+    std::string big = chunked(stream, 0, stream.size(), false, &seed);
+    const int   ROUNDS = 200;
+    size_t      total  = 0;
+    std::vector<uint8_t> buf;
+    start = hostTestNowNs();
+    for (int round = 0; round < ROUNDS; round++) {
+        ntripSessionReset(&session);
+        session.state      = NTRIP_STATE_STREAMING;             // Header already parsed.
+        session.chunked    = true;
+        session.chunkState = NTRIP_CHUNK_SIZE;
+        for (size_t at = 0; at < big.size(); at += sizeof(chunk)) {
+            size_t n = (big.size() - at < sizeof(chunk)) ? big.size() - at : sizeof(chunk);
+            memcpy(chunk, big.data() + at, n);
+            total += ntripReceive(&session, chunk, n);
+        }
+    }
+    double nsPerByte = (double)(hostTestNowNs() - start) / ((double)big.size() * ROUNDS);
+    CHECK(total == stream.size() * ROUNDS);
+    printf("ntripClient: caster sessions %d (1 refused, 1 reconnect), %zu RTCM bytes in %.1f ms, chunked parse %.2f ns/byte\n",
+           NUM_SESSIONS, received.size(), elapsedMs, nsPerByte);
+    return hostTestFailures;
+}
@@ -0,0 +1,202 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - rtcm3Framer.h host test.
+ * *************************************************************************
+ *
+ * test_rtcm3Framer.cpp
+ *
+ * Clean stream, injected corruption & resync, false preamble lookahead, ring overflow, drain pass longer than
+ * the ring, throughput (ns/byte).
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-09:00am] New.
+ * @since  3.2.2 [2026-10-17-02:00pm] Drain pass > RTCM3_RING_SIZE (ntripRtcmBuffer backlog).
+ * @see    rtcm3Framer.h.
+ * @link   http://dougfoster.me.
+ */
+
+#include "hostTest.h"
+#include "rtcm3Framer.h"
+
+#include <vector>
+
+// --- Test stream. ---
+const uint16_t TYPES[]     = {1005, 1074, 1084, 1094, 1124, 1230};
+const size_t   NTRIP_CHUNK = 512;                         // NTRIP_CHUNK_MAX in DougFoster_Ghost_Rover.ino.
+
+/**
+ * -------------------------------------------------------------------------
+ *  Append one RTCM3 frame.
+ * -------------------------------------------------------------------------
+ *
+ * @param  vector   out        Stream.
+ * @param  uint16_t type       Message type.
+ * @param  uint16_t payloadLen Message length (>= 2).
+ * @param  uint32_t* seed      Payload bytes (0xD3 included on purpose).
+ * @return size_t              Offset of the frame in out.
+ */
+static size_t appendFrame(std::vector<uint8_t>& out, uint16_t type, uint16_t payloadLen, uint32_t* seed) {
+    size_t at = out.size();
+    out.push_back(RTCM3_PREAMBLE);
+    out.push_back((uint8_t)(payloadLen >> 8));
+    out.push_back((uint8_t)payloadLen);
+    out.push_back((uint8_t)(type >> 4));
+    out.push_back((uint8_t)((type << 4) | (hostTestRandom(seed) & 0x0F)));
+    for (uint16_t i = 2; i < payloadLen; i++) {
+        out.push_back(((i % 97) == 0) ? RTCM3_PREAMBLE : (uint8_t)hostTestRandom(seed));
+    }
+    uint32_t crc = rtcm3Crc24q(&out[at], RTCM3_HEADER_LEN + payloadLen);
+    out.push_back((uint8_t)(crc >> 16));
+    out.push_back((uint8_t)(crc >> 8));
+    out.push_back((uint8_t)crc);
+    return at;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Push a stream in random sized chunks, count frames out.
+ * -------------------------------------------------------------------------
+ *
+ * @param  Rtcm3Framer* framer Framer (reset by caller).
+ * @param  vector       stream Bytes.
+ * @param  uint32_t*    seed   Chunk sizes.
+ * @return uint32_t            # of frames returned.
+ */
+static uint32_t feed(Rtcm3Framer* framer, const std::vector<uint8_t>& stream, uint32_t* seed) {
+    static uint8_t frame[RTCM3_MAX_FRAME];
+    uint16_t       frameLen = 0;
+    uint32_t       frames   = 0;
+    for (size_t at = 0; at < stream.size();) {
+        size_t n = 1 + hostTestRandom(seed) % 256;               // Like Serial1.read(rxChunk, ...).
+        if (n > stream.size() - at) {
+            n = stream.size() - at;
+        }
+        rtcm3FramerPush(framer, &stream[at], n);
+        at += n;
+        while (rtcm3FramerNext(framer, frame, &frameLen)) {
+            CHECK(rtcm3Crc24q(frame, frameLen - RTCM3_CRC_LEN) ==
+                  (((uint32_t)frame[frameLen - 3] << 16) | ((uint32_t)frame[frameLen - 2] << 8) | frame[frameLen - 1]));
+            rtcm3TypeStatsRecord(framer, rtcm3MessageType(frame), frameLen, 0);
+            frames++;
+        }
+    }
+    return frames;
+}
+
+int main() {
+    static Rtcm3Framer framer;
+    static uint8_t     frame[RTCM3_MAX_FRAME];
+    uint16_t           frameLen = 0;
+    uint32_t           seed     = 0x12345678;
+
+    // --- CRC-24Q check value ("123456789"). ---
+    CHECK(rtcm3Crc24q((const uint8_t*)"123456789", 9) == 0xCDE703);
+
+    // --- Clean stream: every frame out, nothing discarded. ---
+    std::vector<uint8_t> clean;
+    for (uint16_t i = 0; i < 600; i++) {
+        appendFrame(clean, TYPES[i % 6], (uint16_t)(2 + hostTestRandom(&seed) % RTCM3_MAX_PAYLOAD), &seed);
+    }
+    rtcm3FramerReset(&framer);
+    CHECK(feed(&framer, clean, &seed) == 600);
+    CHECK(framer.framesOk == 600);
+    CHECK(framer.framesCrcBad == 0);
+    CHECK(framer.bytesDiscarded == 0);
+    CHECK(framer.numTypes == 6);
+
+    // --- Injected corruption: only the hit frames are lost, the framer resyncs on the next one. ---
+    std::vector<uint8_t> corrupt;
+    std::vector<size_t>  starts;
+    for (uint16_t i = 0; i < 600; i++) {
+        starts.push_back(appendFrame(corrupt, TYPES[i % 6], (uint16_t)(2 + hostTestRandom(&seed) % 400), &seed));
+    }
+    uint32_t hit = 0;
+    for (uint16_t i = 5; i < 600; i += 10) {
+        size_t end = (i + 1 < 600) ? starts[i + 1] : corrupt.size();
+        corrupt[starts[i] + 3 + hostTestRandom(&seed) % (end - starts[i] - 3)] ^= 0x5A;   // Payload or CRC bit flips.
+        hit++;
+    }
+    rtcm3FramerReset(&framer);
+    CHECK(feed(&framer, corrupt, &seed) == 600 - hit);
+    CHECK(framer.framesCrcBad + framer.framesFalseStart >= hit);
+
+    // --- Truncated frame (radio dropout) then good frames. ---
+    std::vector<uint8_t> dropout;
+    appendFrame(dropout, 1074, 300, &seed);
+    dropout.resize(120);
+    for (uint16_t i = 0; i < 20; i++) {
+        appendFrame(dropout, 1230, 10, &seed);
+    }
+    rtcm3FramerReset(&framer);
+    CHECK(feed(&framer, dropout, &seed) == 20);
+
+    // --- False preamble with a max length: the good frame behind it isn't held for 1029 bytes. ---
+    std::vector<uint8_t> falseStart = {RTCM3_PREAMBLE, 0x03, 0xFF, 0x00, 0x11};
+    size_t goodAt = appendFrame(falseStart, 1005, 19, &seed);
+    rtcm3FramerReset(&framer);
+    rtcm3FramerPush(&framer, falseStart.data(), falseStart.size());
+    CHECK(rtcm3FramerNext(&framer, frame, &frameLen));
+    CHECK(frameLen == falseStart.size() - goodAt);
+    CHECK(rtcm3MessageType(frame) == 1005);
+    CHECK(framer.framesFalseStart == 1);
+    CHECK(framer.bytesDiscarded == goodAt);
+
+    // --- Incomplete real frame is still waited for. ---
+    std::vector<uint8_t> partial;
+    appendFrame(partial, 1074, 500, &seed);
+    rtcm3FramerReset(&framer);
+    rtcm3FramerPush(&framer, partial.data(), 300);
+    CHECK(!rtcm3FramerNext(&framer, frame, &frameLen));
+    rtcm3FramerPush(&framer, partial.data() + 300, partial.size() - 300);
+    CHECK(rtcm3FramerNext(&framer, frame, &frameLen));
+    CHECK(framer.framesFalseStart == 0);
+    CHECK(framer.bytesDiscarded == 0);
+
+    // --- Ring overflow is counted, not written past. ---
+    rtcm3FramerReset(&framer);
+    CHECK(rtcm3FramerPush(&framer, clean.data(), RTCM3_RING_SIZE + 100) == RTCM3_RING_SIZE);
+    CHECK(framer.bytesOverflow == 100);
+
+    // --- Drain pass longer than the ring (full ntripRtcmBuffer): framed per chunk like taskRtcmRelay(), nothing lost. ---
+    std::vector<uint8_t> backlog;
+    uint32_t             backlogFrames = 0;
+    uint32_t             drained       = 0;
+    while (backlog.size() < 2 * RTCM3_RING_SIZE) {
+        appendFrame(backlog, TYPES[backlogFrames % 6], (uint16_t)(2 + hostTestRandom(&seed) % RTCM3_MAX_PAYLOAD), &seed);
+        backlogFrames++;
+    }
+    rtcm3FramerReset(&framer);
+    for (size_t at = 0; at < backlog.size(); at += NTRIP_CHUNK) {
+        rtcm3FramerPush(&framer, &backlog[at], (backlog.size() - at < NTRIP_CHUNK) ? backlog.size() - at : NTRIP_CHUNK);
+        CHECK(framer.head - framer.tail < RTCM3_MAX_FRAME + NTRIP_CHUNK);   // One chunk + an incomplete frame.
+        while (rtcm3FramerNext(&framer, frame, &frameLen)) {
+            drained++;
+        }
+    }
+    CHECK(drained == backlogFrames);
+    CHECK(framer.bytesOverflow == 0);
+
+    // Whole pass pushed before framing: the ring overflows & frames are lost.
+    rtcm3FramerReset(&framer);
+    drained = 0;
+    for (size_t at = 0; at < backlog.size(); at += NTRIP_CHUNK) {
+        rtcm3FramerPush(&framer, &backlog[at], (backlog.size() - at < NTRIP_CHUNK) ? backlog.size() - at : NTRIP_CHUNK);
+    }
+    while (rtcm3FramerNext(&framer, frame, &frameLen)) {
+        drained++;
+    }
+    CHECK(framer.bytesOverflow == backlog.size() - RTCM3_RING_SIZE);
+    CHECK(drained < backlogFrames);
+
+    // --- Throughput. ---
+    const int ROUNDS = 20;
+    int64_t   start  = hostTestNowNs();
+    uint32_t  frames = 0;
+    for (int round = 0; round < ROUNDS; round++) {
+        rtcm3FramerReset(&framer);
+        frames += feed(&framer, corrupt, &seed);
+    }
+    double nsPerByte = (double)(hostTestNowNs() - start) / ((double)corrupt.size() * ROUNDS);
+    printf("rtcm3Framer: %u frames, %.2f ns/byte (push + next + CRC), 9600 baud = 1042000 ns/byte\n", frames, nsPerByte);
+    return hostTestFailures;
+}
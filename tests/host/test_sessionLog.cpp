@@ -0,0 +1,265 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - sessionLog.h host test.
+ * *************************************************************************
+ *
+ * test_sessionLog.cpp
+ *
+ * Ring wrap & all or nothing drops, short sink writes (nothing lost), close with a dead sink (bytesLost),
+ * a slow fake block device with stalls behind a producer thread (byte exact file, sector aligned writes,
+ * push latency, ring high water) & the close handshake (no push after logGateIdle()).
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-11:00am] New.
+ * @see    sessionLog.h, taskSessionLogger().
+ * @link   http://dougfoster.me.
+ */
+
+#include "hostTest.h"
+#include "sessionLog.h"
+
+#include <unistd.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/**
+ * -------------------------------------------------------------------------
+ *  Fake block device: a file in memory, optional short writes & stalls.
+ * -------------------------------------------------------------------------
+ */
+struct FakeDevice {
+    std::vector<uint8_t>  data;                           // File contents.
+    std::vector<uint32_t> writeLens;                      // Length of every write.
+    uint32_t              seed;                           // Short write & stall pattern.
+    uint32_t              shortEvery;                     // 1 in N writes is short, 0 = never.
+    uint32_t              usPerBlock;                     // Write time per LOG_BLOCK_SIZE (us), 0 = none.
+    uint32_t              stallEvery;                     // 1 in N writes stalls, 0 = never.
+    uint32_t              stallUs;                        // Stall time (us), like SD wear leveling.
+    bool                  dead;                           // Card gone: every write returns 0.
+};
+
+/**
+ * -------------------------------------------------------------------------
+ *  LogSink for FakeDevice.
+ * -------------------------------------------------------------------------
+ *
+ * @param  void*  context FakeDevice*.
+ * @param  array  data    Bytes.
+ * @param  size_t len     # of bytes.
+ * @return size_t         # of bytes taken.
+ */
+static size_t fakeSink(void* context, const uint8_t* data, size_t len) {
+    FakeDevice* device = (FakeDevice*)context;
+    if (device->dead) {
+        return 0;
+    }
+    if ((device->shortEvery > 0) && ((hostTestRandom(&device->seed) % device->shortEvery) == 0)) {
+        len = hostTestRandom(&device->seed) % len;                 // 0 .. len - 1 bytes.
+    }
+    if (device->usPerBlock > 0) {
+        usleep((useconds_t)((uint64_t)device->usPerBlock * len / LOG_BLOCK_SIZE + 1));
+    }
+    if ((device->stallEvery > 0) && ((hostTestRandom(&device->seed) % device->stallEvery) == 0)) {
+        usleep(device->stallUs);
+    }
+    device->data.insert(device->data.end(), data, data + len);
+    device->writeLens.push_back((uint32_t)len);
+    return len;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Stream with its own storage.
+ * -------------------------------------------------------------------------
+ *
+ * @param  LogStream* stream   Stream.
+ * @param  vector     ring     Ring storage (power of 2 bytes).
+ * @param  vector     block    Block storage (LOG_BLOCK_SIZE).
+ * @return void       No output is returned.
+ */
+static void streamInit(LogStream* stream, std::vector<uint8_t>& ring, std::vector<uint8_t>& block) {
+    memset(stream, 0, sizeof(LogStream));
+    logRingInit(&stream->ring, ring.data(), (uint32_t)ring.size());
+    block.assign(LOG_BLOCK_SIZE, 0);
+    stream->block = block.data();
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Producer record: "$<seq>,<pad>\n", 40 - 120 bytes (NMEA sized).
+ * -------------------------------------------------------------------------
+ *
+ * @param  uint32_t  seq  Sequence #.
+ * @param  uint32_t* seed Length.
+ * @param  array     out  Output (>= 128 bytes).
+ * @return size_t         # of bytes.
+ */
+static size_t record(uint32_t seq, uint32_t* seed, char* out) {
+    int    len = snprintf(out, 128, "$%08u,", seq);
+    size_t pad = 30 + hostTestRandom(seed) % 80;
+    memset(out + len, 'A' + (seq % 26), pad);
+    out[len + pad] = '\n';
+    return (size_t)len + pad + 1;
+}
+
+int main() {
+    static LogStream     stream;
+    std::vector<uint8_t> ring(65536);
+    std::vector<uint8_t> block;
+    std::vector<uint8_t> expect;
+    uint8_t              out[4096];
+    char                 rec[128];
+    uint32_t             seed = 0x600D5EED;
+
+    // --- Ring: wrap, all or nothing. ---
+    std::vector<uint8_t> small(64);
+    LogRing              smallRing;
+    logRingInit(&smallRing, small.data(), 64);
+    for (uint32_t i = 0; i < 1000; i++) {
+        size_t len = 1 + i % 40;
+        memset(out, (int)i, len);
+        CHECK(logRingPush(&smallRing, out, len));
+        CHECK(logRingUsed(&smallRing) == len);
+        CHECK(logRingPop(&smallRing, out + 100, sizeof(out) - 100) == len);
+        CHECK((out[100] == (uint8_t)i) && (out[100 + len - 1] == (uint8_t)i));
+    }
+    CHECK(logRingPush(&smallRing, out, 60));
+    CHECK(!logRingPush(&smallRing, out, 5));                    // Only 4 free: all dropped.
+    CHECK(smallRing.bytesDropped == 5);
+    CHECK(logRingUsed(&smallRing) == 60);
+
+    // --- Short writes: every byte reaches the device, in order. ---
+    FakeDevice shortDevice = {};
+    shortDevice.seed       = 0x51057;
+    shortDevice.shortEvery = 3;
+    streamInit(&stream, ring, block);
+    for (uint32_t seq = 0; seq < 20000; seq++) {
+        size_t len = record(seq, &seed, rec);
+        if (logRingPush(&stream.ring, (const uint8_t*)rec, len)) {
+            expect.insert(expect.end(), rec, rec + len);
+        }
+        if ((seq % 50) == 0) {
+            logStreamWrite(&stream, fakeSink, &shortDevice, ((seq % 1000) == 0) ? LOG_WRITE_SECTORS : LOG_WRITE_BLOCKS);
+        }
+    }
+    shortDevice.shortEvery = 0;
+    CHECK(logStreamFinish(&stream, fakeSink, &shortDevice, true) == 0);
+    CHECK(stream.writeErrors > 0);
+    CHECK(stream.ring.bytesDropped == 0);
+    CHECK(shortDevice.data == expect);
+    CHECK(stream.fileBytes == shortDevice.data.size());
+
+    // --- Finish after a few short writes: retried, nothing lost. ---
+    FakeDevice retryDevice = {};
+    retryDevice.seed       = 0x7E7E7;
+    retryDevice.shortEvery = 1;                                 // Every write short ...
+    streamInit(&stream, ring, block);
+    CHECK(logRingPush(&stream.ring, ring.data(), 3000));
+    logStreamWrite(&stream, fakeSink, &retryDevice, LOG_WRITE_SECTORS);
+    CHECK(stream.writeErrors == 1);
+    retryDevice.shortEvery = 0;                                 // ... until the card catches up.
+    CHECK(logStreamFinish(&stream, fakeSink, &retryDevice, true) == 0);
+    CHECK(retryDevice.data.size() == 3000);
+
+    // --- Dead card at close: counted, dropped, the next session starts clean. ---
+    FakeDevice deadDevice = {};
+    deadDevice.dead       = true;
+    streamInit(&stream, ring, block);
+    CHECK(logRingPush(&stream.ring, ring.data(), 20000));
+    logStreamWrite(&stream, fakeSink, &deadDevice, LOG_WRITE_BLOCKS);
+    CHECK(stream.writeErrors == 1);
+    CHECK(logStreamFinish(&stream, fakeSink, &deadDevice, true) == 20000);
+    CHECK(stream.bytesLost == 20000);
+    CHECK((stream.blockLen == 0) && (logRingUsed(&stream.ring) == 0));
+
+    // --- Slow fake block device behind a producer thread (taskSessionLogger() pacing, 10x faster). ---
+    const uint32_t       NUM_RECORDS = 10000;                   // ~750 KB.
+    FakeDevice           slowDevice  = {};
+    LogGate              gate        = {};
+    std::atomic<bool>    producing(true);
+    std::vector<uint8_t> accepted;
+    int64_t              pushMaxNs   = 0;
+    int64_t              pushTotalNs = 0;
+    slowDevice.seed       = 0x5100;
+    slowDevice.usPerBlock = 1500;                               // ~5.5 MB/s.
+    slowDevice.stallEvery = 40;
+    slowDevice.stallUs    = 30000;                              // 30 ms stalls.
+    streamInit(&stream, ring, block);
+    gate.open = true;
+    std::thread producer([&]() {
+        uint32_t producerSeed = 0xFEED;
+        for (uint32_t seq = 0; seq < NUM_RECORDS; seq++) {
+            size_t  len   = record(seq, &producerSeed, rec);
+            int64_t start = hostTestNowNs();
+            bool    added = logGatePush(&gate, &stream.ring, (const uint8_t*)rec, len);
+            int64_t ns    = hostTestNowNs() - start;
+            pushTotalNs  += ns;
+            pushMaxNs     = (ns > pushMaxNs) ? ns : pushMaxNs;
+            if (added) {
+                accepted.insert(accepted.end(), rec, rec + len);
+            }
+            usleep(100);                                        // ~0.5 MB/s offered, 10x NMEA + UBX.
+        }
+        producing = false;
+    });
+    int64_t  writeStart = hostTestNowNs();
+    int64_t  passMaxNs  = 0;
+    uint32_t passes     = 0;
+    while (producing) {
+        usleep(10000);                                          // LOG_WAIT / 10.
+        int64_t start = hostTestNowNs();
+        logStreamWrite(&stream, fakeSink, &slowDevice, ((++passes % 10) == 0) ? LOG_WRITE_SECTORS : LOG_WRITE_BLOCKS);
+        passMaxNs = ((hostTestNowNs() - start) > passMaxNs) ? (hostTestNowNs() - start) : passMaxNs;
+    }
+    producer.join();
+    logGateClose(&gate);
+    CHECK(logGateIdle(&gate));
+    CHECK(logStreamFinish(&stream, fakeSink, &slowDevice, true) == 0);
+    double writeMs = (double)(hostTestNowNs() - writeStart) / 1e6;
+    CHECK(slowDevice.data == accepted);
+    CHECK(stream.ring.bytesIn == accepted.size());
+    CHECK(stream.writeErrors == 0);
+    uint32_t offset    = 0;
+    uint32_t unaligned = 0;
+    for (size_t i = 0; i + 1 < slowDevice.writeLens.size(); i++) {  // Every write but the last starts & ends on a sector.
+        unaligned += ((offset % LOG_SECTOR_SIZE) != 0) || ((slowDevice.writeLens[i] % LOG_SECTOR_SIZE) != 0);
+        offset    += slowDevice.writeLens[i];
+    }
+    CHECK(unaligned == 0);
+    printf("sessionLog: slow device %.1f ms, %zu of %zu bytes accepted (dropped %lu), ring high water %lu/%zu, "
+           "push avg %.0f ns max %.1f us, slowest write pass %.1f ms, %zu writes\n",
+           writeMs, accepted.size(), accepted.size() + stream.ring.bytesDropped, (unsigned long)stream.ring.bytesDropped,
+           (unsigned long)stream.ring.highWater, ring.size(), (double)pushTotalNs / NUM_RECORDS, pushMaxNs / 1000.0,
+           passMaxNs / 1e6, slowDevice.writeLens.size());
+
+    // --- Close handshake: once logGateIdle(), no producer touches the ring. ---
+    uint32_t lateRounds = 0;
+    for (int round = 0; round < 200; round++) {
+        std::atomic<bool> started(false);
+        std::atomic<bool> stop(false);
+        streamInit(&stream, ring, block);
+        gate.open = true;
+        std::thread hammer([&]() {
+            uint8_t bytes[64] = {0};
+            while (!stop) {
+                logGatePush(&gate, &stream.ring, bytes, sizeof(bytes));
+                started = true;
+                stream.ring.tail = stream.ring.head;            // Stand-in writer: keep the ring from filling.
+            }
+        });
+        while (!started) {
+        }
+        logGateClose(&gate);
+        while (!logGateIdle(&gate)) {
+        }
+        uint32_t head = __atomic_load_n(&stream.ring.head, __ATOMIC_ACQUIRE);
+        for (int spin = 0; spin < 2000; spin++) {
+            lateRounds += (__atomic_load_n(&stream.ring.head, __ATOMIC_ACQUIRE) != head);
+        }
+        stop = true;
+        hammer.join();
+    }
+    CHECK(lateRounds == 0);
+    return hostTestFailures;
+}
@@ -0,0 +1,329 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - wsTelemetry.h host test.
+ * *************************************************************************
+ *
+ * test_wsTelemetry.cpp
+ *
+ * Encode -> decode round trip (decoder follows telemetryDecode() in global.js), keyframe size, sequence gap
+ * & keyframe request, one encoder per client, NMEA frames, bytes/s against the JSON GNSS STATUS message,
+ * compact & JSON show the same values with GNSS up & down.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-17-10:00am] New.
+ * @since  3.2.2 [2026-10-17-02:30pm] Compact vs JSON values, GNSS up & down.
+ * @see    wsTelemetry.h, sendTelemetryToBrowser() in DougFoster_Ghost_Rover.ino, telemetryDecode() in global.js.
+ * @link   http://dougfoster.me.
+ */
+
+#include "hostTest.h"
+#include "wsTelemetry.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <string>
+
+// --- Decoder (browser side). ---
+struct Decoder {
+    WsTelemetry value;                                    // Last decoded value of each field.
+    int         sequence;                                 // Sequence # of last K/D frame, -1 = waiting for a keyframe.
+    uint32_t    gaps;                                     // # of keyframe requests.
+};
+
+/**
+ * -------------------------------------------------------------------------
+ *  Decode one frame, like telemetryDecode().
+ * -------------------------------------------------------------------------
+ *
+ * @param  Decoder* decoder Decoder.
+ * @param  array    frame   Frame.
+ * @param  size_t   len     Frame length.
+ * @return bool             true if decoded, false if dropped (waiting for a keyframe or gap).
+ */
+static bool decode(Decoder* decoder, const uint8_t* frame, size_t len) {
+    if (frame[0] == WS_TLM_DELTA) {
+        if (decoder->sequence < 0) {
+            return false;
+        }
+        if (frame[1] != ((decoder->sequence + 1) & 0xFF)) {
+            decoder->sequence = -1;                       // Gap: browser sends {"keyframe":""}.
+            decoder->gaps++;
+            return false;
+        }
+    }
+    decoder->sequence = frame[1];
+    uint32_t mask   = frame[2] | (frame[3] << 8) | (frame[4] << 16) | ((uint32_t)frame[5] << 24);
+    size_t   offset = WS_TLM_HEADER_LEN;
+    for (uint8_t i = 0; i < WS_TLM_NUM_FIELDS; i++) {
+        if (!(mask & ((uint32_t)1 << i))) {
+            continue;
+        }
+        uint64_t v = 0;
+        for (uint8_t b = 0; b < WS_TLM_FIELD_SIZE[i]; b++) {
+            v |= (uint64_t)frame[offset++] << (8 * b);
+        }
+        uint8_t bits = 8 * WS_TLM_FIELD_SIZE[i];
+        if ((bits < 64) && (v & ((uint64_t)1 << (bits - 1)))) {
+            v |= ~(uint64_t)0 << bits;                    // Sign extend (two's complement on the wire).
+        }
+        decoder->value.value[i] = (int64_t)v;
+    }
+    CHECK(offset == len);
+    return true;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  GNSS STATUS JSON, same keys & formats as sendDataToBrowser().
+ * -------------------------------------------------------------------------
+ *
+ * @param  WsTelemetry* t        Values.
+ * @param  bool         gnssDown true = GNSS fields as 0, like sendDataToBrowser() (WS_TLM_JSON_KEY[0 - 7]).
+ * @param  array        json     Output, 1024 bytes.
+ * @return size_t                JSON length.
+ */
+static size_t jsonText(const WsTelemetry* t, bool gnssDown, char* json) {
+    const size_t   SIZE = 1024;
+    const int64_t* v    = t->value;
+    int            len  = 0;
+    if (gnssDown) {
+        json[len++] = '{';
+        for (uint8_t i = 0; i < WS_TLM_NUM_GNSS; i++) {
+            len += snprintf(json + len, SIZE - len, "\"%s\":0,", WS_TLM_JSON_KEY[i]);
+        }
+    } else {
+        len = snprintf(json, SIZE,
+            "{\"8\":%lld,\"9\":%lld,\"10\":\"%.2f\",\"11\":\"%.2f\",\"12\":\"%.8f\",\"13\":\"%.8f\",\"14\":\"%.3f\",\"15\":\"%.3f\",",
+            (long long)v[WS_TLM_FIX], (long long)v[WS_TLM_SIV], v[WS_TLM_HEIGHT_ELLIPSOID] / 100.0, v[WS_TLM_HEIGHT_ORTHOMETRIC] / 100.0,
+            v[WS_TLM_LAT] / 1e8, v[WS_TLM_LON] / 1e8, v[WS_TLM_ACCURACY_H] / 1000.0, v[WS_TLM_ACCURACY_V] / 1000.0);
+    }
+    len += snprintf(json + len, SIZE - len,
+        "\"16\":\"%s\",\"17\":\"%s\",\"18\":\"%.2f\",\"19\":\"%.1f\",\"20\":\"%lldh %lldm %llds\","
+        "\"23\":%lld,\"24\":%lld,\"25\":%lld,\"26\":%lld,\"27\":%lld,\"28\":%lld,\"29\":%lld,\"30\":%lld,\"31\":%lld,"
+        "\"32\":\"%c\",\"33\":\"192.168.1.23\",\"34\":\"192.168.4.1\",\"37\":%lld,\"38\":%.2f,\"52\":%lld,\"54\":%.1f,\"55\":%lld,\"56\":%lld}",
+        v[WS_TLM_RTCM_IN] ? "u" : "d", v[WS_TLM_NMEA_OUT] ? "u" : "d", v[WS_TLM_BATTERY_SOC] / 100.0, v[WS_TLM_BATTERY_RATE] / 10.0,
+        (long long)(v[WS_TLM_UPTIME] / 3600), (long long)(v[WS_TLM_UPTIME] / 60 % 60), (long long)(v[WS_TLM_UPTIME] % 60),
+        (long long)v[WS_TLM_NMEA_GGA], (long long)v[WS_TLM_NMEA_RMC], (long long)v[WS_TLM_NMEA_GSA], (long long)v[WS_TLM_NMEA_GSV],
+        (long long)v[WS_TLM_NMEA_GST], (long long)v[WS_TLM_NMEA_TXT], (long long)v[WS_TLM_NMEA_OTHER], (long long)v[WS_TLM_NMEA_ALL],
+        (long long)v[WS_TLM_NMEA_RATE], (char)v[WS_TLM_OPER_MODE], (long long)v[WS_TLM_RTCM_COUNT], v[WS_TLM_RTCM_KBPS] / 100.0,
+        (long long)v[WS_TLM_EPOCH], v[WS_TLM_NTRIP_LATENCY] / 10.0, (long long)v[WS_TLM_NTRIP_BPS], (long long)v[WS_TLM_NTRIP_RECONNECTS]);
+    return (size_t)len;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  GNSS STATUS JSON length.
+ * -------------------------------------------------------------------------
+ *
+ * @param  WsTelemetry* t Values.
+ * @return size_t         JSON length.
+ */
+static size_t jsonLength(const WsTelemetry* t) {
+    char json[1024];
+    return jsonText(t, false, json);
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Flat JSON object -> key, value text (quotes removed).
+ * -------------------------------------------------------------------------
+ *
+ * @param  array json JSON from jsonText().
+ * @return map        Key -> value.
+ */
+static std::map<std::string, std::string> jsonFields(const char* json) {
+    std::map<std::string, std::string> fields;
+    const char* p = json + 1;
+    while ((*p == '"') && (strchr(p + 1, '"') != NULL)) {
+        const char* keyEnd = strchr(p + 1, '"');
+        std::string key(p + 1, keyEnd);
+        p = keyEnd + 2;                                   // Past '"' & ':'.
+        bool        quoted   = (*p == '"');
+        const char* valueEnd = quoted ? strchr(p + 1, '"') : p + strcspn(p, ",}");
+        fields[key] = std::string(p + (quoted ? 1 : 0), valueEnd);
+        p = valueEnd + (quoted ? 1 : 0);
+        p += (*p == ',') ? 1 : 0;
+    }
+    return fields;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Same key set & values (numbers compared as numbers, "0" == "0.00").
+ * -------------------------------------------------------------------------
+ *
+ * @param  array json    JSON path (sendDataToBrowser()).
+ * @param  array compact Decoded compact frame, shown with the JSON formats.
+ * @return bool          true if the page would show the same values.
+ */
+static bool jsonSame(const char* json, const char* compact) {
+    std::map<std::string, std::string> a = jsonFields(json);
+    std::map<std::string, std::string> b = jsonFields(compact);
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (const auto& field : a) {
+        auto other = b.find(field.first);
+        if (other == b.end()) {
+            return false;
+        }
+        char*  endA = NULL;
+        char*  endB = NULL;
+        double numA = strtod(field.second.c_str(), &endA);
+        double numB = strtod(other->second.c_str(), &endB);
+        bool   numeric = (*endA == '\0') && (*endB == '\0') && (!field.second.empty());
+        if (numeric ? (numA != numB) : (field.second != other->second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Next epoch (5 Hz): position jitter, counters, slow fields now & then.
+ * -------------------------------------------------------------------------
+ *
+ * @param  WsTelemetry* t     Values, updated.
+ * @param  uint32_t     epoch Epoch #.
+ * @param  uint32_t*    seed  Random state.
+ */
+static void step(WsTelemetry* t, uint32_t epoch, uint32_t* seed) {
+    int64_t* v = t->value;
+    v[WS_TLM_LAT]               += (int64_t)(hostTestRandom(seed) % 41) - 20;
+    v[WS_TLM_LON]               += (int64_t)(hostTestRandom(seed) % 41) - 20;
+    v[WS_TLM_HEIGHT_ELLIPSOID]  += (int64_t)(hostTestRandom(seed) % 3) - 1;
+    v[WS_TLM_HEIGHT_ORTHOMETRIC] = v[WS_TLM_HEIGHT_ELLIPSOID] + 3210;
+    v[WS_TLM_ACCURACY_H]         = 10 + hostTestRandom(seed) % 5;
+    v[WS_TLM_ACCURACY_V]         = 14 + hostTestRandom(seed) % 5;
+    v[WS_TLM_UPTIME]             = epoch / 5;
+    for (uint8_t i = WS_TLM_NMEA_GGA; i <= WS_TLM_NMEA_ALL; i++) {
+        v[i] += (i == WS_TLM_NMEA_GSV) ? 4 : 1;
+    }
+    v[WS_TLM_RTCM_COUNT]        += 1 + hostTestRandom(seed) % 2;
+    v[WS_TLM_RTCM_KBPS]          = 380 + hostTestRandom(seed) % 40;
+    v[WS_TLM_EPOCH]             += 200;
+    if ((epoch % 50) == 0) {
+        v[WS_TLM_SIV]            = 28 + hostTestRandom(seed) % 4;
+        v[WS_TLM_BATTERY_SOC]   -= 1;
+    }
+}
+
+int main() {
+    static uint8_t frame[WS_TLM_MAX_FRAME];
+    uint32_t       seed = 0xC0FFEE;
+
+    // --- Keyframe size: header + every field. ---
+    size_t keyframeLen = WS_TLM_HEADER_LEN;
+    for (uint8_t i = 0; i < WS_TLM_NUM_FIELDS; i++) {
+        keyframeLen += WS_TLM_FIELD_SIZE[i];
+    }
+    CHECK(keyframeLen == 119);
+    CHECK(keyframeLen <= WS_TLM_MAX_FRAME);
+
+    // --- Start values, incl. negatives & 64 bit lat/lon. ---
+    WsTelemetry truth = {};
+    int64_t*    v     = truth.value;
+    v[WS_TLM_FIX] = 3;  v[WS_TLM_SIV] = 30;
+    v[WS_TLM_HEIGHT_ELLIPSOID] = -1234;   v[WS_TLM_LAT] = 3739109732LL;   v[WS_TLM_LON] = -12203782548LL;
+    v[WS_TLM_RTCM_IN] = 1;  v[WS_TLM_NMEA_OUT] = 1;  v[WS_TLM_BATTERY_SOC] = 9850;  v[WS_TLM_BATTERY_RATE] = -12;
+    v[WS_TLM_OPER_MODE] = 'R';  v[WS_TLM_LOCAL_IP] = 0x1701A8C0;  v[WS_TLM_HOTSPOT_IP] = 0x0104A8C0;
+    v[WS_TLM_NTRIP_LATENCY] = 853;  v[WS_TLM_NTRIP_BPS] = 612;  v[WS_TLM_NTRIP_RECONNECTS] = 2;
+
+    // --- Round trip, 1 hour at 5 Hz, keyframe every 5 s (as WS_TLM_KEYFRAME_INTERVAL). ---
+    const uint32_t EPOCHS     = 5 * 3600;
+    WsTlmEncoder   encoder    = {};
+    Decoder        browser    = {{}, -1, 0};
+    uint64_t       jsonBytes  = 0;
+    for (uint32_t epoch = 0; epoch < EPOCHS; epoch++) {
+        step(&truth, epoch, &seed);
+        size_t len = wsTlmEncode(&encoder, &truth, (epoch % 25) == 0, frame);
+        CHECK(len > 0);
+        CHECK(((epoch % 25) == 0) == (frame[0] == WS_TLM_KEYFRAME));
+        if ((epoch % 25) == 0) {
+            CHECK(len == keyframeLen);
+        }
+        CHECK(decode(&browser, frame, len));
+        CHECK(memcmp(&browser.value, &truth, sizeof(truth)) == 0);
+        jsonBytes += jsonLength(&truth);
+    }
+    double seconds = EPOCHS / 5.0;
+    printf("wsTelemetry: compact %.0f bytes/s (keyframes=%u, deltas=%u, avg delta %.1f bytes), JSON %.0f bytes/s, %.1fx less\n",
+        encoder.bytesOut / seconds, encoder.keyframes, encoder.deltas,
+        (double)(encoder.bytesOut - (uint64_t)encoder.keyframes * keyframeLen) / encoder.deltas, jsonBytes / seconds,
+        (double)jsonBytes / encoder.bytesOut);
+    CHECK(encoder.bytesOut * 3 < jsonBytes);
+
+    // --- Compact & JSON show the same values, GNSS up & down (JSON zeros WS_TLM_JSON_KEY[0 - 7], compact wsTlmGnssDown()). ---
+    char json[1024];
+    char shown[1024];
+    for (int gnssDown = 0; gnssDown < 2; gnssDown++) {
+        WsTelemetry now = truth;
+        if (gnssDown) {
+            wsTlmGnssDown(&now);
+        }
+        size_t frameLen = wsTlmEncode(&encoder, &now, true, frame);
+        CHECK(decode(&browser, frame, frameLen));
+        jsonText(&truth, gnssDown, json);
+        jsonText(&browser.value, false, shown);
+        CHECK(jsonSame(json, shown));
+    }
+    CHECK(browser.value.value[WS_TLM_ACCURACY_H] == 0);
+    CHECK(browser.value.value[WS_TLM_RTCM_KBPS] == truth.value[WS_TLM_RTCM_KBPS]);
+    size_t upLen = wsTlmEncode(&encoder, &truth, false, frame);    // GNSS back up.
+    CHECK(decode(&browser, frame, upLen));
+    CHECK(memcmp(&browser.value, &truth, sizeof(truth)) == 0);
+
+    // --- Nothing changed: no frame. ---
+    CHECK(wsTlmEncode(&encoder, &truth, false, frame) == 0);
+
+    // --- Dropped delta (client queue full): gap seen, keyframe request, back in sync. ---
+    step(&truth, 1, &seed);
+    wsTlmEncode(&encoder, &truth, false, frame);              // Never delivered.
+    step(&truth, 2, &seed);
+    size_t len = wsTlmEncode(&encoder, &truth, false, frame);
+    CHECK(!decode(&browser, frame, len));
+    CHECK(browser.gaps == 1);
+    len = wsTlmEncode(&encoder, &truth, true, frame);         // {"keyframe":""} -> keyframePending.
+    CHECK(decode(&browser, frame, len));
+    CHECK(memcmp(&browser.value, &truth, sizeof(truth)) == 0);
+
+    // --- Two clients, one encoder each: a late joiner starts with a keyframe, the first client's deltas are unaffected. ---
+    WsTlmEncoder first  = {};
+    WsTlmEncoder second = {};
+    Decoder      a      = {{}, -1, 0};
+    Decoder      b      = {{}, -1, 0};
+    for (uint32_t epoch = 0; epoch < 100; epoch++) {
+        step(&truth, epoch, &seed);
+        len = wsTlmEncode(&first, &truth, false, frame);
+        CHECK(decode(&a, frame, len));
+        if (epoch >= 40) {
+            len = wsTlmEncode(&second, &truth, false, frame);
+            CHECK((epoch != 40) || (frame[0] == WS_TLM_KEYFRAME));
+            CHECK(decode(&b, frame, len));
+            CHECK(memcmp(&b.value, &truth, sizeof(truth)) == 0);
+        }
+        CHECK(memcmp(&a.value, &truth, sizeof(truth)) == 0);
+    }
+    CHECK(first.keyframes == 1);
+    CHECK((second.keyframes == 1) && (second.deltas == 59));
+    CHECK((a.gaps == 0) && (b.gaps == 0));
+
+    // --- NMEA frame. ---
+    const char gga[] = "$GNGGA,172814.00,3723.4658394,N,12202.2695291,W,4,12,0.60,23.456,M,-32.100,M,1.0,0000*4F\r\n";
+    len = wsTlmEncodeNmea(&encoder, gga, strlen(gga), frame);
+    CHECK((len == strlen(gga) + 2) && (frame[0] == WS_TLM_NMEA) && (memcmp(frame + 2, gga, strlen(gga)) == 0));
+    CHECK(wsTlmEncodeNmea(&encoder, std::string(WS_TLM_MAX_FRAME, 'A').c_str(), WS_TLM_MAX_FRAME, frame) == 0);
+
+    // --- Encode cost. ---
+    const int ROUNDS = 1000000;
+    int64_t   start  = hostTestNowNs();
+    size_t    bytes  = 0;
+    for (int round = 0; round < ROUNDS; round++) {
+        truth.value[WS_TLM_EPOCH] += 200;
+        bytes += wsTlmEncode(&encoder, &truth, false, frame);
+    }
+    printf("wsTelemetry: %.1f ns/delta frame (%zu bytes)\n", (double)(hostTestNowNs() - start) / ROUNDS, bytes);
+    return hostTestFailures;
+}
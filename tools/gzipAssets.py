@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""
+ * *************************************************************************
+ *  Ghost Rover 3 - Pre-gzipped UI assets.
+ * *************************************************************************
+
+ gzipAssets.py
+
+ Build step for the asset cache in startHttpServer() (assetCacheLoad()).
+ For each ui/*.html, *.css & *.js file, write <name>.gz (gzip -9, no timestamp, so the
+ same input always gives the same bytes) & one manifest line:
+
+     <name> <hash> <gzip bytes> <raw bytes>
+
+ hash = first 16 hex digits of SHA-256 over the .gz bytes. GR-MCU1 checks it at boot & uses
+ it as the ETag, so a browser only downloads an asset again when its content changed.
+
+ Usage:
+     python3 tools/gzipAssets.py [ui dir] [output dir]     (default: ui, build/sd)
+
+ Then copy (or upload on the files page) everything in the output dir to the SD root,
+ next to the plain ui files. assets.txt last: uploading it reloads the cache.
+
+ @author D. Foster <doug@dougfoster.me>.
+ @since  3.2.2 [2026-10-16-10:00pm] New.
+ @see    assetCacheLoad(), startHttpServer(), onHttpFileUpload() in DougFoster_Ghost_Rover.ino.
+ @link   http://dougfoster.me.
+"""
+
+import gzip
+import hashlib
+import os
+import sys
+
+# --- Global vars. ---
+ASSET_EXTENSIONS = ('.html', '.css', '.js')             # Text assets. Images are already compressed.
+ASSET_CACHE_MAX  = 24                                    # Must match ASSET_CACHE_MAX in DougFoster_Ghost_Rover.ino.
+ASSET_NAME_MAX   = 30                                    # AssetCacheEntry.path[32] holds "/" + name + '\0'.
+HASH_LEN         = 16                                    # Hex digits of SHA-256 kept.
+MANIFEST         = 'assets.txt'
+
+
+def main():
+    root   = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    uiDir  = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, 'ui')
+    outDir = sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, 'build', 'sd')
+    os.makedirs(outDir, exist_ok=True)
+
+    # --- Compress & hash. ---
+    lines    = []
+    rawTotal = 0
+    gzTotal  = 0
+    for name in sorted(os.listdir(uiDir)):
+        path = os.path.join(uiDir, name)
+        if (not os.path.isfile(path)) or (not name.endswith(ASSET_EXTENSIONS)):
+            continue
+        if len(name) > ASSET_NAME_MAX:
+            sys.exit(f'{name}: name longer than {ASSET_NAME_MAX} characters.')
+        with open(path, 'rb') as f:
+            raw = f.read()
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        digest = hashlib.sha256(packed).hexdigest()[:HASH_LEN]
+        with open(os.path.join(outDir, name + '.gz'), 'wb') as f:
+            f.write(packed)
+        lines.append(f'{name} {digest} {len(packed)} {len(raw)}')
+        rawTotal += len(raw)
+        gzTotal  += len(packed)
+        print(f'{name:<16} {len(raw):>7} -> {len(packed):>6} bytes  {digest}')
+
+    # --- Manifest. ---
+    if len(lines) > ASSET_CACHE_MAX:
+        sys.exit(f'{len(lines)} assets, ASSET_CACHE_MAX is {ASSET_CACHE_MAX}.')
+    with open(os.path.join(outDir, MANIFEST), 'w', newline='\n') as f:
+        f.write('\n'.join(lines) + '\n')
+    print(f'{len(lines)} assets, {rawTotal} -> {gzTotal} bytes. Wrote {outDir}/*.gz & {MANIFEST}.')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,258 @@
+#!/usr/bin/env python3
+"""
+ * *************************************************************************
+ *  Ghost Rover 3 - Asset cache TTFB load test.
+ * *************************************************************************
+
+ ttfbLoad.py
+
+ Load test for the asset cache route in startHttpServer(). N clients request every asset in
+ /assets.txt at once, three ways:
+
+     cached   Accept-Encoding: gzip              -> 200 from PSRAM, gzip, ETag = manifest hash.
+     304      + If-None-Match: <ETag>             -> 304 from PSRAM, no body.
+     sd       no Accept-Encoding                  -> 200 from SD (serveStatic()), the uncached path.
+
+ Prints time to first byte (status line & headers in) & total time per request as p50/p95/p99/max,
+ plus requests/s. Every cached body is checked against its hash. Exit status 1 on any error.
+
+ --self-test runs the same load against a stand-in server on 127.0.0.1 (ui/ assets, same route rules)
+ that drops & reloads its table while the clients run, the way an upload does on the rover. A request
+ that finds its asset dropped falls back to the "SD" copy; none may fail. ctest runs this.
+
+ Usage:
+     python3 tools/ttfbLoad.py <rover ip> [--clients 8] [--rounds 5]
+     python3 tools/ttfbLoad.py --self-test
+
+ @author D. Foster <doug@dougfoster.me>.
+ @since  3.2.2 [2026-10-17-11:30am] New.
+ @see    startHttpServer(), assetCacheFind(), assetCacheSwap() in DougFoster_Ghost_Rover.ino, tools/gzipAssets.py.
+ @link   http://dougfoster.me.
+"""
+
+import argparse
+import gzip
+import hashlib
+import http.client
+import http.server
+import os
+import sys
+import threading
+import time
+
+# --- Global vars. ---
+ASSET_EXTENSIONS = ('.html', '.css', '.js')             # Match tools/gzipAssets.py.
+HASH_LEN         = 16
+TIMEOUT          = 10                                    # Socket timeout (s).
+
+
+def percentile(values, p):
+    """p-th percentile (nearest rank) of a list, 0 if empty."""
+    if not values:
+        return 0.0
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(len(ordered) * p / 100))]
+
+
+def fetchManifest(host, port):
+    """Read /assets.txt: {name: hash}."""
+    conn = http.client.HTTPConnection(host, port, timeout=TIMEOUT)
+    conn.request('GET', '/assets.txt')
+    resp = conn.getresponse()
+    body = resp.read().decode()
+    conn.close()
+    if resp.status != 200:
+        sys.exit(f'/assets.txt: HTTP {resp.status}. Upload tools/gzipAssets.py output first.')
+    assets = {}
+    for line in body.splitlines():
+        parts = line.split()
+        if len(parts) == 4:
+            assets[parts[0]] = parts[1]
+    return assets
+
+
+def client(host, port, assets, rounds, results, lock):
+    """One browser: every asset, every way, rounds times. Appends (kind, ttfb ms, total ms, error) to results."""
+    local = []
+    for _ in range(rounds):
+        for name, digest in assets.items():
+            for kind in ('cached', '304', 'sd'):
+                headers = {}
+                if kind != 'sd':
+                    headers['Accept-Encoding'] = 'gzip'
+                if kind == '304':
+                    headers['If-None-Match'] = f'"{digest}"'
+                error = None
+                start = time.perf_counter()
+                try:
+                    conn = http.client.HTTPConnection(host, port, timeout=TIMEOUT)
+                    conn.request('GET', '/' + name, headers=headers)
+                    resp  = conn.getresponse()
+                    ttfb  = time.perf_counter() - start
+                    body  = resp.read()
+                    total = time.perf_counter() - start
+                    conn.close()
+                except OSError as e:
+                    local.append((kind, 0.0, 0.0, f'{name}: {e}'))
+                    continue
+                if (kind == '304') and (resp.status == 304):
+                    pass
+                elif resp.status != 200:
+                    error = f'{name} ({kind}): HTTP {resp.status}'
+                elif resp.getheader('Content-Encoding') == 'gzip':
+                    if kind != 'cached':
+                        error = f'{name} ({kind}): gzip body not expected'
+                    elif hashlib.sha256(body).hexdigest()[:HASH_LEN] != digest:
+                        error = f'{name}: body does not match hash {digest}'
+                    elif resp.getheader('ETag') != f'"{digest}"':
+                        error = f'{name}: ETag {resp.getheader("ETag")}'
+                elif kind != 'sd':
+                    kind = 'fallback'                    # Dropped since the filter ran (or not cached): served from SD.
+                local.append((kind, ttfb * 1000, total * 1000, error))
+    with lock:
+        results.extend(local)
+
+
+def run(host, port, clients, rounds):
+    """Load test. Returns # of errors."""
+    assets  = fetchManifest(host, port)
+    results = []
+    lock    = threading.Lock()
+    threads = [threading.Thread(target=client, args=(host, port, assets, rounds, results, lock)) for _ in range(clients)]
+    start   = time.perf_counter()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    elapsed = time.perf_counter() - start
+
+    # --- Report. ---
+    print(f'{len(assets)} assets, {clients} clients x {rounds} rounds, {len(results)} requests in {elapsed:.2f} s '
+          f'({len(results) / elapsed:.0f} req/s).')
+    print(f'{"kind":<9} {"count":>6}  {"TTFB p50":>9} {"p95":>8} {"p99":>8} {"max":>8}  {"total p50":>9} {"p95":>8}  (ms)')
+    for kind in ('cached', '304', 'sd', 'fallback'):
+        ttfb  = [r[1] for r in results if (r[0] == kind) and (r[3] is None)]
+        total = [r[2] for r in results if (r[0] == kind) and (r[3] is None)]
+        if ttfb:
+            print(f'{kind:<9} {len(ttfb):>6}  {percentile(ttfb, 50):>9.2f} {percentile(ttfb, 95):>8.2f} {percentile(ttfb, 99):>8.2f} '
+                  f'{max(ttfb):>8.2f}  {percentile(total, 50):>9.2f} {percentile(total, 95):>8.2f}')
+    errors = [r[3] for r in results if r[3] is not None]
+    for error in errors[:10]:
+        print('ERROR', error)
+    print(f'{len(errors)} errors.')
+    return len(errors)
+
+
+class StandIn:
+    """Asset table like assetCache: replaced whole under a lock, never changed in place."""
+
+    def __init__(self, uiDir):
+        self.raw    = {}
+        self.cached = {}
+        for name in sorted(os.listdir(uiDir)):
+            path = os.path.join(uiDir, name)
+            if os.path.isfile(path) and name.endswith(ASSET_EXTENSIONS):
+                with open(path, 'rb') as f:
+                    self.raw[name] = f.read()
+        for name, raw in self.raw.items():
+            packed = gzip.compress(raw, compresslevel=9, mtime=0)
+            self.cached[name] = (hashlib.sha256(packed).hexdigest()[:HASH_LEN], packed)
+        self.manifest = ''.join(f'{n} {d} {len(p)} {len(self.raw[n])}\n' for n, (d, p) in self.cached.items())
+        self.table    = dict(self.cached)
+        self.lock     = threading.Lock()
+
+    def find(self, name):                                # assetCacheFind(): copy out under the lock.
+        with self.lock:
+            return self.table.get(name)
+
+    def swap(self, table):                               # assetCacheSwap().
+        with self.lock:
+            self.table = table
+
+
+def selfTest(clients, rounds):
+    """Stand-in server with drops & reloads during the load. Returns # of errors."""
+    root  = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    cache = StandIn(os.path.join(root, 'ui'))
+
+    class Handler(http.server.BaseHTTPRequestHandler):
+        protocol_version = 'HTTP/1.1'
+
+        def log_message(self, *args):
+            pass
+
+        def do_GET(self):
+            name  = self.path.lstrip('/')
+            gz    = 'gzip' in self.headers.get('Accept-Encoding', '')
+            asset = cache.find(name) if gz else None    # Filter.
+            if gz and asset is not None:
+                time.sleep(0.0002)                       # Window for a drop between the filter & the handler.
+                asset = cache.find(name)                 # Handler looks up again.
+            if asset is not None:
+                digest, packed = asset
+                if f'"{digest}"' in self.headers.get('If-None-Match', ''):
+                    self.send_response(304)
+                    body = b''
+                else:
+                    self.send_response(200)
+                    self.send_header('Content-Encoding', 'gzip')
+                    body = packed
+                self.send_header('ETag', f'"{digest}"')
+                self.send_header('Cache-Control', 'no-cache')
+            elif name == 'assets.txt' or name in cache.raw:      # serveStatic() on SD.
+                body = cache.manifest.encode() if name == 'assets.txt' else cache.raw[name]
+                self.send_response(200)
+            else:
+                body = b'File not found'
+                self.send_response(404)
+            self.send_header('Content-Length', str(len(body)))
+            self.send_header('Connection', 'close')
+            self.end_headers()
+            self.wfile.write(body)
+
+    server = http.server.ThreadingHTTPServer(('127.0.0.1', 0), Handler)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+
+    # --- Uploads: drop one asset, then reload everything, over & over. ---
+    stop = threading.Event()
+
+    def churn():
+        names = list(cache.cached)
+        i     = 0
+        while not stop.is_set():
+            table = dict(cache.cached)
+            del table[names[i % len(names)]]
+            cache.swap(table)                            # assetCacheDrop().
+            time.sleep(0.001)
+            cache.swap(dict(cache.cached))               # assetCacheLoad().
+            time.sleep(0.001)
+            i += 1
+
+    churner = threading.Thread(target=churn)
+    churner.start()
+    errors = run('127.0.0.1', server.server_address[1], clients, rounds)
+    stop.set()
+    churner.join()
+    server.shutdown()
+    return errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Asset cache TTFB load test.')
+    parser.add_argument('host', nargs='?', help='Rover IP or name.')
+    parser.add_argument('--port', type=int, default=80)
+    parser.add_argument('--clients', type=int, default=8, help='Concurrent clients (browsers).')
+    parser.add_argument('--rounds', type=int, default=5, help='Passes over every asset per client.')
+    parser.add_argument('--self-test', action='store_true', help='Run against a local stand-in server.')
+    args = parser.parse_args()
+    if args.self_test:
+        errors = selfTest(args.clients, args.rounds)
+    elif args.host:
+        errors = run(args.host, args.port, args.clients, args.rounds)
+    else:
+        parser.error('host or --self-test required.')
+    sys.exit(1 if errors else 0)
+
+
+if __name__ == '__main__':
+    main()
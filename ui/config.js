@@ -26,6 +26,7 @@
  * @since  3.1.2  [2026-07-14-09:45am] Add NTRIP.
  * @since  3.2.1  [2026-07-25-04:00pm] Moved JSON to global.js.
  * @since  3.2.1  [2026-07-28-04:45pm] Removed NMEA out switch & preference.
+ * @since  3.2.2  [2026-10-16-06:00pm] NTRIP GGA interval.
  * @link   http://dougfoster.me.
 */
 
@@ -78,6 +79,7 @@ const ntripVersion            = document.querySelector('#config #ntrip-version')
 const ntripUser               = document.querySelector('#config #ntrip-user');
 const ntripPassword           = document.querySelector('#config #ntrip-password');
 const ntripSendGGA            = document.querySelector('#config #ntrip-send-gga input');
+const ntripGgaInterval        = document.querySelector('#config #ntrip-gga-interval');
 const ntripCasterdup          = document.querySelector('#config #ntrip-caster-dup');
 const switchRtcmInButtons     = document.querySelector('#rtcm-in-buttons');
 const ntripCasterActive       = document.querySelector('#ntrip-caster-active');
@@ -226,6 +228,7 @@ function setHeights(action) {
  * @since  3.1.2 [2026-07-17-09:30pm] New.
  * @since  3.1.2 [2026-07-17-09:30pm] ntripCasterAttributes stored as string, not array.
  * @since  3.2.1 [2026-07-25-04:00pm] Moved JSON to webSocketRcvMessage() & toJson() in global.js.
+ * @since  3.2.2 [2026-10-16-06:00pm] GGA interval.
  * @see    uiPrefs().
  */
 function ntripAttributes(action) {
@@ -258,6 +261,7 @@ function ntripAttributes(action) {
         ntripUser.value      = caster[parseInt(which)].user;
         ntripPassword.value  = caster[parseInt(which)].pass;
         ntripSendGGA.checked = Boolean(caster[parseInt(which)].sendGga);
+        ntripGgaInterval.value = caster[parseInt(which)].ggaInterval;
         clearMessageField();
     }
 }
@@ -26,6 +26,8 @@
  * @since  3.2.1  [2026-07-27-08:30am] Add webSocketNum.
  * @since  3.2.1  [2026-07-28-10:00am] Remove webSocketNum.
  * @since  3.2.1  [2026-07-28-04:45pm] Removed NMEA out switch & preference.
+ * @since  3.2.2  [2026-10-16-02:00pm] Compact telemetry: telemetryDecode().
+ * @since  3.2.2  [2026-10-17-10:00am] KEYFRAME_REQUEST without "page".
  * 
  * @link   http://dougfoster.me.
 */
@@ -43,6 +45,9 @@
  * @since  3.1.1  [2026-06-26-09:30pm] change WS_PREF_GNSS_MESASURE_INTERVAL to WS_PREF_GNSS_MEASURE_INTERVAL.
  * @since  3.1.2  [2026-07-16-10:00am] Add NTRIP.
  * @since  3.2.1  [2026-07-25-04:30pm] Add caster[{}].
+ * @since  3.2.2  [2026-10-16-02:00pm] Add TELEMETRY_FIELDS.
+ * @since  3.2.2  [2026-10-16-04:00pm] Add GNSS epoch to TELEMETRY_FIELDS.
+ * @since  3.2.2  [2026-10-16-06:00pm] Add caster ggaInterval, NTRIP status to TELEMETRY_FIELDS.
  * @see    operateMessage() in operate.js.
  * @see    setHeights() in config.js.
  * @see    Global vars () WebSockets) in DougFoster_Ghost_Rover.ino.
@@ -79,12 +84,52 @@ const versionRoverId          = document.querySelector('#version-rover');
 let   websocket;
 const caster = [
   { },
-  { id:'', name:'', url:'', mount:'', port:'', version:1, user:'', pass:'', sendGga:0 },
-  { id:'', name:'', url:'', mount:'', port:'', version:1, user:'', pass:'', sendGga:0 },
-  { id:'', name:'', url:'', mount:'', port:'', version:1, user:'', pass:'', sendGga:0 },
+  { id:'', name:'', url:'', mount:'', port:'', version:1, user:'', pass:'', sendGga:0, ggaInterval:10 },
+  { id:'', name:'', url:'', mount:'', port:'', version:1, user:'', pass:'', sendGga:0, ggaInterval:10 },
+  { id:'', name:'', url:'', mount:'', port:'', version:1, user:'', pass:'', sendGga:0, ggaInterval:10 },
 ];
 let jsonObj;
 
+// --- Compact telemetry. ---
+// Binary frames from sendTelemetryToBrowser(). @see wsTelemetry.h. Row order must match WsTlmField.
+const KEYFRAME_REQUEST = '{"keyframe":""}';    // No "page": a keyframe request is not a page load.
+const TELEMETRY_FIELDS = [      // [JSON key, bytes, signed, scale, format (# decimals, 'ud', 'uptime', 'char', 'ip', or null = number)].
+  [ '8', 1, false,         1, null    ],    // fixType.
+  [ '9', 1, false,         1, null    ],    // numSatInView.
+  ['10', 4, true,        100, 2       ],    // heightEllipsoid.
+  ['11', 4, true,        100, 2       ],    // heightOrthometric.
+  ['12', 8, true,  100000000, 8       ],    // lat.
+  ['13', 8, true,  100000000, 8       ],    // lon.
+  ['14', 4, false,      1000, 3       ],    // accuracyHorizontal.
+  ['15', 4, false,      1000, 3       ],    // accuracyVertical.
+  ['16', 1, false,         1, 'ud'    ],    // RTCMin.
+  ['17', 1, false,         1, 'ud'    ],    // NMEAout.
+  ['18', 2, false,       100, 2       ],    // batterySoc.
+  ['19', 2, true,         10, 1       ],    // batteryChangeRate.
+  ['20', 4, false,         1, 'uptime'],    // Up time (s).
+  ['23', 4, false,         1, null    ],    // NMEA GGA count.
+  ['24', 4, false,         1, null    ],    // NMEA RMC count.
+  ['25', 4, false,         1, null    ],    // NMEA GSA count.
+  ['26', 4, false,         1, null    ],    // NMEA GSV count.
+  ['27', 4, false,         1, null    ],    // NMEA GST count.
+  ['28', 4, false,         1, null    ],    // NMEA TXT count.
+  ['29', 4, false,         1, null    ],    // NMEA other count.
+  ['30', 4, false,         1, null    ],    // NMEA total count.
+  ['31', 4, false,         1, null    ],    // nmeaRate.
+  ['32', 1, false,         1, 'char'  ],    // operMode.
+  ['33', 4, false,         1, 'ip'    ],    // localIp.
+  ['34', 4, false,         1, 'ip'    ],    // hotspotIp.
+  ['37', 4, false,         1, null    ],    // rtcmSentenceCount.
+  ['38', 4, false,       100, null    ],    // rtcmKbps.
+  ['52', 4, false,         1, null    ],    // gnssEpochTow (GPS time of week, ms).
+  ['54', 4, false,        10, null    ],    // ntripLatencyMs.
+  ['55', 4, false,         1, null    ],    // ntripBytesPerSec.
+  ['56', 4, false,         1, null    ],    // ntripReconnects.
+];
+const TELEMETRY_EVERY_FRAME = [0, 8, 9];    // Fix & RTCM/NMEA up/down: passed on every frame (WS stats & status LED flash), as with JSON.
+const telemetryValues       = [];           // Last decoded value of each field.
+let   telemetrySequence     = null;         // Sequence # of last keyframe/delta frame. null = waiting for a keyframe.
+
 // --- Preferences. ---
 // let prfGnsMsrInt = 0;
 // let prfGnsNavRat = 0;
@@ -119,6 +164,7 @@ let heightPole               =    0;    // mm.
  * @since  3.0.3 [2025-10-16-01:45pm].
  * @since  3.1.0 [2026-03-20-11:15am] Update var names.
  * @since  3.2.1 [2026-07-25-04:30pm] add toJson().
+ * @since  3.2.2 [2026-10-16-02:00pm] add telemetryDecode(), telemetryFormat().
  * @see   webSocketInit()       - WebSocket: init.
  * @see   webSocketOpened()     - WebSocket: opened.
  * @see   webSocketClosed()     - WebSocket: closed.
@@ -126,6 +172,8 @@ let heightPole               =    0;    // mm.
  * @see   webSocketStop()       - WebSocket: stopped.
  * @see   webSocketRcvMessage() - WebSocket: message from server. Decode.
  * @see   toJson()              - WebSocket: Encode values into JSON.
+ * @see   telemetryDecode()     - WebSocket: Decode compact telemetry frame.
+ * @see   telemetryFormat()     - WebSocket: Format compact telemetry value.
  */
 
 /**
@@ -136,10 +184,12 @@ let heightPole               =    0;    // mm.
  * @return void  No output is returned.
  * @since  3.0.3 [2025-10-13-02:15pm].
  * @since  3.1.0 [2026-03-20-11:15am] Update var names.
+ * @since  3.2.2 [2026-10-16-02:00pm] binaryType for compact telemetry.
  */
 function webSocketInit() {
     console.log('Opening new WebSocket ...');
-    websocket           = new WebSocket(wsEndpoint);
+    websocket            = new WebSocket(wsEndpoint);
+    websocket.binaryType = 'arraybuffer';   // Compact telemetry. @see telemetryDecode().
     websocket.onopen    = webSocketOpened;
     websocket.onclose   = webSocketClosed;
     websocket.onerror   = webSocketError;
@@ -251,13 +301,13 @@ async function webSocketStop(event) {
  *     20 = Up time                         (char     uptime[20]).
  *     21 = RTCM in count all               Not used?
  *     22 = RTCM in rate                    Not used?
- *     23 = NMEA GGA out sentence count     (size_t   nmeaCountGGA).
- *     24 = NMEA RMC out sentence count     (size_t   nmeaCountRMC).
- *     25 = NMEA GSA out sentence count     (size_t   nmeaCountGSA).
- *     26 = NMEA GSV out sentence count     (size_t   nmeaCountGSV).
- *     27 = NMEA GST out sentence count     (size_t   nmeaCountGST).
- *     28 = NMEA TXT out sentence count     (size_t   nmeaCountTXT).
- *     29 = NMEA other out sentence count   (size_t   nmeaCountOther).
+ *     23 = NMEA GGA out sentence count     (size_t   nmeaCount[NMEA_TYPE_GGA]).
+ *     24 = NMEA RMC out sentence count     (size_t   nmeaCount[NMEA_TYPE_RMC]).
+ *     25 = NMEA GSA out sentence count     (size_t   nmeaCount[NMEA_TYPE_GSA]).
+ *     26 = NMEA GSV out sentence count     (size_t   nmeaCount[NMEA_TYPE_GSV]).
+ *     27 = NMEA GST out sentence count     (size_t   nmeaCount[NMEA_TYPE_GST]).
+ *     28 = NMEA TXT out sentence count     (size_t   nmeaCount[NMEA_TYPE_TXT]).
+ *     29 = NMEA other out sentence count   (size_t   nmeaCountAll - above).
  *     30 = NMEA total out sentence count   (size_t   nmeaCountAll).
  *     31 = NMEA out rate                   (int64_t  nmeaRate).
  *     32 = Operational mode                (char     operMode[2]).
@@ -280,6 +330,17 @@ async function webSocketStop(event) {
  *     49 = NTRIP caster user               (struct ntripCasterProfile caster[1/2/3].user    - char user[48]).
  *     50 = NTRIP caster password           (struct ntripCasterProfile caster[1/2/3].pass    - char user[48]).
  *     51 = NTRIP caster sendGga            (struct ntripCasterProfile caster[1/2/3].sendGga - bool ).
+ *     52 = GNSS epoch time of week (ms)    (uint32_t gnssEpochTow).
+ *     53 = NTRIP caster GGA interval (s)   (struct ntripCasterProfile caster[1/2/3].ggaInterval - uint16_t).
+ *     54 = NTRIP latency (ms)              (float    ntripLatencyMs).
+ *     55 = NTRIP rate (bytes/s)            (uint32_t ntripBytesPerSec).
+ *     56 = NTRIP reconnects                (uint32_t ntripReconnects).
+ *     57 = RTCM in -> ZED p95 (ms)         (float    metricsRelay.rxToZed  - operate page, every 2 s).
+ *     58 = NMEA -> I2C ack p95 (ms)        (float    metricsLoop.nmeaToI2c - operate page, every 2 s).
+ *     59 = Epoch -> WebSocket p95 (ms)     (float    metricsLoop.epochToWs - operate page, every 2 s).
+ *     60 = loop() time p95 (ms)            (float    metricsLoop.loopTime  - operate page, every 2 s).
+ *     61 = I2C restarts                    (uint32_t metricsLoop.i2cRestarts).
+ *     62 = Least free task stack           (char     "task name" + " " + bytes).
  *
  * @return void  No output is returned.
  * @since  3.0.7 [2025-11-15-02:00pm].
@@ -291,18 +352,28 @@ async function webSocketStop(event) {
  * @since  3.2.1  [2026-07-27-08:30am] Refactor, add webSocketNum.
  * @since  3.2.1  [2026-07-28-10:00am] Remove webSocketNum.
  * @since  3.2.1  [2026-07-28-04:45pm] Removed NMEA out switch & preference.
+ * @since  3.2.2  [2026-10-16-02:00pm] Binary (compact telemetry) messages.
+ * @since  3.2.2  [2026-10-16-06:00pm] NTRIP caster GGA interval ("53").
+ * @since  3.2.2  [2026-10-16-11:00pm] Metrics ("57" - "62").
  * @see    operateMessage() in operate.js.
  * @see    filesMessage() in files.js.
+ * @see    telemetryDecode() for binary messages.
  */
 function webSocketRcvMessage(event) {
 
     // --- Process message. ---
-    jsonObj = JSON.parse(event.data);
+    const binary = (event.data instanceof ArrayBuffer);
+    if (binary) {
+        jsonObj               = telemetryDecode(event.data);   // Same keys & values as the JSON message.
+        wsNumBytesThisMessage = event.data.byteLength;         // Bytes per message.
+    } else {
+        jsonObj               = JSON.parse(event.data);
+        wsNumBytesThisMessage = event.data.length;             // Bytes per message.
+    }
     if (null == jsonObj) {
         return;
     }
-    let response = 'browser <-- ' + event.data
-    wsNumBytesThisMessage  = event.data.length;     // Bytes per message.
+    let response = 'browser <-- ' + (binary ? JSON.stringify(jsonObj) + ' (' + wsNumBytesThisMessage + ' bytes binary)' : event.data);
     if (sessionStorage.getItem("displayJsConsoleMessages") == 'on') {
         console.log(response);
     }
@@ -383,6 +454,7 @@ function webSocketRcvMessage(event) {
                 caster[i].user    = (undefined == jsonObj["49"]) ? '' : jsonObj["49"];
                 caster[i].pass    = (undefined == jsonObj["50"]) ? '' : jsonObj["50"];
                 caster[i].sendGga = ntripSendGGA.checked = Boolean(jsonObj["51"]);
+                caster[i].ggaInterval = (undefined == jsonObj["53"]) ? '10' : jsonObj["53"];
             }
         }
 
@@ -417,7 +489,7 @@ function webSocketRcvMessage(event) {
     }
 
     // -- NMEA page. --
-    if (window.location.pathname.includes('nmea')) {
+    if ((window.location.pathname.includes('nmea')) && (undefined !== jsonObj["NMEA"])) {
         displayNmeaMessage(jsonObj["NMEA"]);
     }
 
@@ -443,6 +515,7 @@ function webSocketRcvMessage(event) {
  * @param  which Group of prefs to apply.
  * @return void  No output is returned.
  * @since  3.1.2  [2026-07-25-04:15pm] New.
+ * @since  3.2.2  [2026-10-16-06:00pm] NTRIP caster GGA interval ("53").
  * @see    webSocketRcvMessage() in global.js.
  * @see    ntripAttributes() in config.js.
  * @see    updateConfigBtn.addEventListener() in config.js.
@@ -482,7 +555,8 @@ function toJson(which) {
                                 "48" : ntripVersion.value,                                                     
                                 "49" : ntripUser.value,                                                
                                 "50" : ntripPassword.value,                       
-                                "51" : Number(ntripSendGGA.checked).toString()  // Send "0"/"1", not false/true.                    
+                                "51" : Number(ntripSendGGA.checked).toString(), // Send "0"/"1", not false/true.
+                                "53" : ntripGgaInterval.value
                 })
             });
             break;
@@ -490,6 +564,103 @@ function toJson(which) {
     return jsonString;
 }
 
+/**
+ * -------------------------------------------------------------------------
+ *  WebSocket: Decode compact telemetry frame.
+ * -------------------------------------------------------------------------
+ *
+ * Frame: [type 'K'/'D'/'N'][sequence #][field mask (4, little endian)][fields ...]. @see wsTelemetry.h.
+ * Returns the same keys & values as the JSON message, so operateMessage() & displayNmeaMessage() are unchanged.
+ * A delta frame after a sequence # gap is dropped & a keyframe is requested (once).
+ *
+ * @param  buffer ArrayBuffer from the WebSocket.
+ * @return object JSON style object, or null if waiting for a keyframe.
+ * @since  3.2.2  [2026-10-16-02:00pm] New.
+ * @see    webSocketRcvMessage().
+ * @see    sendTelemetryToBrowser() in DougFoster_Ghost_Rover.ino.
+ */
+function telemetryDecode(buffer) {
+    const frame = new DataView(buffer);
+    const type  = String.fromCharCode(frame.getUint8(0));
+    let   obj   = {};
+
+    // --- NMEA frame. ---
+    if ('N' === type) {
+        obj["NMEA"] = new TextDecoder().decode(new Uint8Array(buffer, 2));
+        return obj;
+    }
+
+    // --- Keyframe or delta frame. Check sequence #. ---
+    const sequence = frame.getUint8(1);
+    if ('D' === type) {
+        if (null === telemetrySequence) {                               // Still waiting for a keyframe.
+            return null;
+        }
+        if (sequence !== ((telemetrySequence + 1) & 0xFF)) {           // Gap: a frame was dropped.
+            telemetrySequence = null;
+            websocket.send(KEYFRAME_REQUEST);
+            console.log('browser --> ' + KEYFRAME_REQUEST);
+            return null;
+        }
+    }
+    telemetrySequence = sequence;
+
+    // --- Fields. ---
+    const mask = frame.getUint32(2, true);
+    let offset = 6;
+    TELEMETRY_FIELDS.forEach(([key, bytes, signed, scale, format], i) => {
+        if (0 === (mask & (1 << i))) {
+            return;
+        }
+        let value;
+        switch (bytes) {
+            case 1: value = signed ? frame.getInt8(offset)         : frame.getUint8(offset);         break;
+            case 2: value = signed ? frame.getInt16(offset, true)  : frame.getUint16(offset, true);  break;
+            case 4: value = signed ? frame.getInt32(offset, true)  : frame.getUint32(offset, true);  break;
+            case 8: value = Number(signed ? frame.getBigInt64(offset, true) : frame.getBigUint64(offset, true)); break;
+        }
+        offset += bytes;
+        telemetryValues[i] = value;
+        obj[key] = telemetryFormat(value, scale, format);
+    });
+    TELEMETRY_EVERY_FRAME.forEach(i => {
+        const [key, , , scale, format] = TELEMETRY_FIELDS[i];
+        obj[key] = telemetryFormat(telemetryValues[i], scale, format);
+    });
+    return obj;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  WebSocket: Format compact telemetry value.
+ * -------------------------------------------------------------------------
+ *
+ * Undo the scaling in sendTelemetryToBrowser() & match the JSON value format (e.g. "%.8f" -> toFixed(8)).
+ *
+ * @param  value  Integer from the frame.
+ * @param  scale  Divisor.
+ * @param  format # of decimals, 'ud', 'uptime', 'char', 'ip', or null (number).
+ * @return Value as it appears in the JSON message.
+ * @since  3.2.2  [2026-10-16-02:00pm] New.
+ * @see    TELEMETRY_FIELDS in global vars.
+ */
+function telemetryFormat(value, scale, format) {
+    switch (format) {
+        case null:
+            return value / scale;
+        case 'ud':                                                      // {"16":"u"}.
+            return value ? 'u' : 'd';
+        case 'uptime':                                                  // {"20":"0h 3m 8s"}.
+            return (Math.floor(value / 3600) % 24) + 'h ' + (Math.floor(value / 60) % 60) + 'm ' + (value % 60) + 's';
+        case 'char':                                                    // {"32":"r"}.
+            return value ? String.fromCharCode(value) : '';
+        case 'ip':                                                      // {"33":"192.168.23.1"}.
+            return value ? [value & 0xFF, (value >>> 8) & 0xFF, (value >>> 16) & 0xFF, value >>> 24].join('.') : '';
+        default:                                                        // {"12":"35.44418163"}.
+            return (value / scale).toFixed(format);
+    }
+}
+
 /**
  * =========================================================================
  *  Event listeners.
@@ -16,6 +16,7 @@
  * @since  3.1.2  [2026-07-05-08:30pm] General cleanup.
  * @since  3.2.1  [2026-07-25-08:45pm] Update JSON messages.
  * @since  3.2.1  [2026-07-26-02:30pm] Update timestamp format.
+ * @since  3.2.2  [2026-10-16-02:00pm] Ask for compact telemetry (binary frames). @see telemetryDecode() in global.js.
  * @link   http://dougfoster.me.
 */
 
@@ -29,8 +30,9 @@
  * @since 3.0.12 [2026-02-08-06:30pm] Removed prfRqsPvtInt.
  * @since 3.0.12 [2026-02-15-01:30pm] Removed summary statistics.
  * @since 3.0.12 [2026-02-25-05:45pm] Websocket send - preserve KV pair order by changing JSON data to array.
+ * @since 3.2.2  [2026-10-16-02:00pm] SEND_PREFS asks for compact telemetry.
  */
-const SEND_PREFS            = '{"page":"nmea","sendPrefs":""}';
+const SEND_PREFS            = '{"page":"nmea","sendPrefs":"","compact":""}';   // "compact": binary NMEA frames. @see telemetryDecode() in global.js.
 const nmeaDisplayArea       = document.querySelector('#nmeaOutput #nmeaDisplay');
 const nmeaMessageLine       = document.querySelector('#nmeaOutput #nmeaMessage')
 const numSolutionsToDisplay = 20;
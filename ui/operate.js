@@ -25,6 +25,8 @@
  * @since  3.1.2  [2026-07-05-05:45pm] Remove clearOperateUi().
  * @since  3.1.2  [2026-07-05-08:45pm] General cleanup.
  * @since  3.2.1  [2026-07-28-10:00am] Move webSocket # & units to status items.
+ * @since  3.2.2  [2026-10-16-02:00pm] Ask for compact telemetry (binary frames). @see telemetryDecode() in global.js.
+ * @since  3.2.2  [2026-10-16-11:00pm] Metrics status items ("57" - "62").
  * @link   http://dougfoster.me.
 */
 
@@ -42,6 +44,10 @@
  * @since  3.0.12 [2026-02-18-11:00pm] Shorten RTCM & NMEA status.
  * @since  3.0.12 [2026-02-25-06:30pm] Copy HAC logic to VAC.
  * @since  3.0.12 [2026-02-27-06:45pm] Add WebSocket #.
+ * @since  3.2.2  [2026-10-16-02:00pm] SEND_PREFS asks for compact telemetry.
+ * @since  3.2.2  [2026-10-16-04:00pm] Add statusSolutionEpochId.
+ * @since  3.2.2  [2026-10-16-06:00pm] Add NTRIP status ids.
+ * @since  3.2.2  [2026-10-16-11:00pm] Add metrics status ids.
  */
 
 // --- Section: Fix. ---
@@ -90,6 +96,7 @@ const tblStatus                    = document.querySelector('.status table');
 const statusUptimeOperateId        = document.querySelector('.status #uptime-operate');
 const statusUptimeRoverId          = document.querySelector('.status #uptime-rover');
 const statusSolutionIntervalId     = document.querySelector('.status #solution-interval');
+const statusSolutionEpochId        = document.querySelector('.status #solution-epoch');
 const statusWebSocketNumId         = document.querySelector('.status #ws-socket-num');
 const statusWsMessageCountId       = document.querySelector('.status #ws-message-count');
 const statusWsMessageIntervalId    = document.querySelector('.status #ws-message-interval');
@@ -98,6 +105,15 @@ const statusWsMessageLengthId      = document.querySelector('.status #ws-message
 const statusRtcmInId               = document.querySelector('.status #rtcm-in');
 const statusRtcmSentenceCountAllId = document.querySelector('.status #rtcm-sentence-count-all');
 const statusRtcmSentenceRateId     = document.querySelector('.status #rtcm-sentence-rate');
+const statusNtripLatencyId         = document.querySelector('.status #ntrip-latency');
+const statusNtripRateId            = document.querySelector('.status #ntrip-rate');
+const statusNtripReconnectsId      = document.querySelector('.status #ntrip-reconnects');
+const statusMetricsRtcmLatencyId   = document.querySelector('.status #metrics-rtcm-latency');
+const statusMetricsNmeaLatencyId   = document.querySelector('.status #metrics-nmea-latency');
+const statusMetricsEpochLatencyId  = document.querySelector('.status #metrics-epoch-latency');
+const statusMetricsLoopTimeId      = document.querySelector('.status #metrics-loop-time');
+const statusMetricsI2cRestartsId   = document.querySelector('.status #metrics-i2c-restarts');
+const statusMetricsStackLowId      = document.querySelector('.status #metrics-stack-low');
 const statusNmeaSentenceCountAllId = document.querySelector('.status #nmea-sentence-count-all');
 const statusNmeaCountGgaId         = document.querySelector('.status #nmea-sentence-count-gga');
 const statusNmeaCountRmcId         = document.querySelector('.status #nmea-sentence-count-rmc');
@@ -115,7 +131,7 @@ const statusWifiMode               = document.querySelector('.status #wifi-mode'
 const statusInstrumentHeight       = document.querySelector('.status #instrument-height');
 
 // --- General. ---
-const SEND_PREFS                   = '{"page":"operate","sendPrefs":""}';
+const SEND_PREFS                   = '{"page":"operate","sendPrefs":"","compact":""}';   // "compact": binary GNSS STATUS/NMEA frames. @see telemetryDecode() in global.js.
 const wsMessageWindowMaxCount      = 10;    // WebSocket message status tracking window (# messages).
 let prfGnsMsrInt                   = 0;
 let prfGnsNavRat                   = 0;
@@ -383,6 +399,9 @@ function battery(which, info) {
  * @since  3.0.12 [2026-02-28-02:15pm] Add WS_SOCKET_NUM.
  * @since  3.1.2  [2026-07-05-05:45pm] Remove clearOperateUi().
  * @since  3.1.2  [2026-07-28-10:30am] Refaactor JSON.
+ * @since  3.2.2  [2026-10-16-04:00pm] Add GNSS epoch.
+ * @since  3.2.2  [2026-10-16-06:00pm] Add NTRIP latency, rate & reconnects.
+ * @since  3.2.2  [2026-10-16-11:00pm] Add metrics: stage latency p95, I2C restarts & lowest task stack.
  * @see    webSocketRcvMessage() in global.js.
  */
 function operateMessage(key, value) {
@@ -553,6 +572,36 @@ function operateMessage(key, value) {
         case "38":                      // {"38":0}.
             statusRtcmSentenceRateId.textContent     = value.toFixed(2);
             break;
+        case "52":                      // {"52":412345000}.
+            statusSolutionEpochId.textContent        = (value / 1000).toFixed(3);
+            break;
+        case "54":                      // {"54":3.2}.
+            statusNtripLatencyId.textContent         = value.toFixed(1);
+            break;
+        case "55":                      // {"55":1180}.
+            statusNtripRateId.textContent            = value.toLocaleString();
+            break;
+        case "56":                      // {"56":0}.
+            statusNtripReconnectsId.textContent      = value.toLocaleString();
+            break;
+        case "57":                      // {"57":1.023}.
+            statusMetricsRtcmLatencyId.textContent   = value.toFixed(1);
+            break;
+        case "58":                      // {"58":0.511}.
+            statusMetricsNmeaLatencyId.textContent   = value.toFixed(1);
+            break;
+        case "59":                      // {"59":4.095}.
+            statusMetricsEpochLatencyId.textContent  = value.toFixed(1);
+            break;
+        case "60":                      // {"60":2.047}.
+            statusMetricsLoopTimeId.textContent      = value.toFixed(1);
+            break;
+        case "61":                      // {"61":0}.
+            statusMetricsI2cRestartsId.textContent   = value.toLocaleString();
+            break;
+        case "62":                      // {"62":"async_tcp 3120"}.
+            statusMetricsStackLowId.textContent      = value;
+            break;
         case 'laser':                   // {"laser":"locked"}.
         case 'height':                  // {"height":"locked"}.
         case 'position':                // {"position":"locked"}.
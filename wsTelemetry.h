@@ -0,0 +1,229 @@
+/**
+ * *************************************************************************
+ *  Ghost Rover 3 - Compact WebSocket telemetry.
+ * *************************************************************************
+ *
+ * wsTelemetry.h
+ *
+ * Binary, delta encoded operate page telemetry used by sendDataToBrowser(). Replaces the ~500 byte
+ * GNSS STATUS JSON message with a frame carrying only the fields that changed since the last frame.
+ * Plain C++ (no Arduino or FreeRTOS calls) so the same code also builds on a host.
+ *
+ * Frame structure (little endian):
+ *   [0]    Frame type   WS_TLM_KEYFRAME ('K'), WS_TLM_DELTA ('D') or WS_TLM_NMEA ('N').
+ *   [1]    Sequence #   Increments on each K/D frame (wraps at 255). 0 for N frames.
+ *   K/D:   [2..5] Field mask (bit n = WsTlmField n present), then each present field in WsTlmField order,
+ *                 WS_TLM_FIELD_SIZE[n] bytes, two's complement, scaled integer.
+ *   N:     [2..]  Raw NMEA sentence ($ ... [CR][LF]), no JSON escaping.
+ *
+ * Operation:
+ *   - Browser asks for compact telemetry with {"page":"operate","sendPrefs":"","compact":""}. Per client: one
+ *     WsTlmEncoder per WebSocket client, so sequence #s & deltas never depend on what another client was sent.
+ *   - A keyframe (all fields) is sent first, every WS_TLM_KEYFRAME_INTERVAL & whenever the browser asks
+ *     for one ({"keyframe":""}) after it sees a sequence # gap (AsyncWebSocket drops messages when a client queue is full).
+ *   - Field scaling & JSON key mapping live in TELEMETRY_FIELDS[] in global.js. Order must match WsTlmField.
+ *   - GNSS down (too few satellites): the GNSS fields (WS_TLM_NUM_GNSS) go out as 0, compact (wsTlmGnssDown())
+ *     & JSON (WS_TLM_JSON_KEY[]) alike, so a page shows the same values whichever mode it negotiated.
+ *
+ * @author D. Foster <doug@dougfoster.me>.
+ * @since  3.2.2 [2026-10-16-02:00pm] New.
+ * @since  3.2.2 [2026-10-16-04:00pm] Add WS_TLM_EPOCH.
+ * @since  3.2.2 [2026-10-16-06:00pm] Add WS_TLM_NTRIP_LATENCY, WS_TLM_NTRIP_BPS, WS_TLM_NTRIP_RECONNECTS.
+ * @since  3.2.2 [2026-10-17-02:30pm] Add WS_TLM_JSON_KEY, WS_TLM_NUM_GNSS & wsTlmGnssDown().
+ * @see    sendDataToBrowser() in DougFoster_Ghost_Rover.ino.
+ * @see    telemetryDecode() in global.js.
+ * @see    tests/host/test_wsTelemetry.cpp.
+ * @link   http://dougfoster.me.
+ */
+
+#ifndef WS_TELEMETRY_H
+#define WS_TELEMETRY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * =========================================================================
+ *  Global vars.
+ * =========================================================================
+ */
+
+// --- Frame. ---
+const uint8_t WS_TLM_KEYFRAME   = 'K';                    // All fields.
+const uint8_t WS_TLM_DELTA      = 'D';                    // Changed fields only.
+const uint8_t WS_TLM_NMEA       = 'N';                    // Raw NMEA sentence.
+const uint8_t WS_TLM_HEADER_LEN = 6;                      // Type (1) + sequence # (1) + field mask (4).
+const uint8_t WS_TLM_MAX_FRAME  = 128;                    // Keyframe is 119 bytes. Also >= 2 + NMEA_MAX_LEN.
+
+// --- Fields. ---
+enum WsTlmField {                                         // Field index. JSON key & scale in ( ).
+    WS_TLM_FIX,                                           //  0. ("8")  fixType.
+    WS_TLM_SIV,                                           //  1. ("9")  numSatInView.
+    WS_TLM_HEIGHT_ELLIPSOID,                              //  2. ("10") heightEllipsoid    x 100.
+    WS_TLM_HEIGHT_ORTHOMETRIC,                            //  3. ("11") heightOrthometric  x 100.
+    WS_TLM_LAT,                                           //  4. ("12") lat                x 10^8.
+    WS_TLM_LON,                                           //  5. ("13") lon                x 10^8.
+    WS_TLM_ACCURACY_H,                                    //  6. ("14") accuracyHorizontal x 1000.
+    WS_TLM_ACCURACY_V,                                    //  7. ("15") accuracyVertical   x 1000.
+    WS_TLM_RTCM_IN,                                       //  8. ("16") RTCMin  (1 = up).
+    WS_TLM_NMEA_OUT,                                      //  9. ("17") NMEAout (1 = up).
+    WS_TLM_BATTERY_SOC,                                   // 10. ("18") batterySoc         x 100.
+    WS_TLM_BATTERY_RATE,                                  // 11. ("19") batteryChangeRate  x 10.
+    WS_TLM_UPTIME,                                        // 12. ("20") Up time (s).
+    WS_TLM_NMEA_GGA,                                      // 13. ("23") nmeaCount[NMEA_TYPE_GGA].
+    WS_TLM_NMEA_RMC,                                      // 14. ("24") nmeaCount[NMEA_TYPE_RMC].
+    WS_TLM_NMEA_GSA,                                      // 15. ("25") nmeaCount[NMEA_TYPE_GSA].
+    WS_TLM_NMEA_GSV,                                      // 16. ("26") nmeaCount[NMEA_TYPE_GSV].
+    WS_TLM_NMEA_GST,                                      // 17. ("27") nmeaCount[NMEA_TYPE_GST].
+    WS_TLM_NMEA_TXT,                                      // 18. ("28") nmeaCount[NMEA_TYPE_TXT].
+    WS_TLM_NMEA_OTHER,                                    // 19. ("29") NMEA other.
+    WS_TLM_NMEA_ALL,                                      // 20. ("30") nmeaCountAll.
+    WS_TLM_NMEA_RATE,                                     // 21. ("31") nmeaRate.
+    WS_TLM_OPER_MODE,                                     // 22. ("32") operMode[0] (char).
+    WS_TLM_LOCAL_IP,                                      // 23. ("33") localIp   (IPv4, 1st octet in low byte).
+    WS_TLM_HOTSPOT_IP,                                    // 24. ("34") hotspotIp (IPv4, 1st octet in low byte).
+    WS_TLM_RTCM_COUNT,                                    // 25. ("37") rtcmSentenceCount.
+    WS_TLM_RTCM_KBPS,                                     // 26. ("38") rtcmKbps           x 100.
+    WS_TLM_EPOCH,                                         // 27. ("52") gnssEpochTow (ms).
+    WS_TLM_NTRIP_LATENCY,                                 // 28. ("54") ntripLatencyMs     x 10.
+    WS_TLM_NTRIP_BPS,                                     // 29. ("55") ntripBytesPerSec.
+    WS_TLM_NTRIP_RECONNECTS,                              // 30. ("56") ntripReconnects.
+    WS_TLM_NUM_FIELDS                                     // 31 = automatic array length (<= 32, one mask bit each).
+};
+const uint8_t WS_TLM_FIELD_SIZE[WS_TLM_NUM_FIELDS] = {    // Bytes on the wire per field; match WsTlmField.
+    1, 1, 4, 4, 8, 8, 4, 4, 1, 1, 2, 2, 4,                // Fix ... up time.
+    4, 4, 4, 4, 4, 4, 4, 4, 4,                            // NMEA counts & rate.
+    1, 4, 4, 4, 4,                                        // Oper mode ... RTCM rate.
+    4,                                                    // GNSS epoch.
+    4, 4, 4                                               // NTRIP.
+};
+const char    WS_TLM_JSON_KEY[WS_TLM_NUM_FIELDS][3] = {   // JSON key per field (sendDataToBrowser()); match WsTlmField.
+    "8", "9", "10", "11", "12", "13", "14", "15", "16", "17", "18", "19", "20",
+    "23", "24", "25", "26", "27", "28", "29", "30", "31",
+    "32", "33", "34", "37", "38",
+    "52",
+    "54", "55", "56"
+};
+const uint8_t WS_TLM_NUM_GNSS   = WS_TLM_ACCURACY_V + 1;  // Fields 0 - 7 (fix ... vertical accuracy) are 0 while GNSS is down.
+
+// --- Encoder. ---
+struct WsTelemetry {                                      // One snapshot of all fields, already scaled to integers.
+    int64_t value[WS_TLM_NUM_FIELDS];
+};
+struct WsTlmEncoder {                                     // Last sent snapshot, sequence # & stats.
+    WsTelemetry last;                                     // Values in the last K/D frame (delta reference).
+    bool        primed;                                   // false until the first keyframe is sent.
+    uint8_t     sequence;                                 // Sequence # of the last K/D frame.
+    uint32_t    keyframes;                                // # of keyframes sent.
+    uint32_t    deltas;                                   // # of delta frames sent.
+    uint64_t    bytesOut;                                 // Total bytes in all frames.
+};
+
+/**
+ * =========================================================================
+ *  Functions.
+ * =========================================================================
+ *
+ * @see wsTlmGnssDown()   - Zero the GNSS fields.
+ * @see wsTlmEncode()     - Encode a keyframe or delta frame.
+ * @see wsTlmEncodeNmea() - Encode a NMEA frame.
+ */
+
+/**
+ * -------------------------------------------------------------------------
+ *  Zero the GNSS fields.
+ * -------------------------------------------------------------------------
+ *
+ * GNSS down: the first WS_TLM_NUM_GNSS fields, the ones sendDataToBrowser() sends as 0 in JSON.
+ *
+ * @param  WsTelemetry* now Snapshot, updated.
+ * @return void         No output is returned.
+ * @since  3.2.2 [2026-10-17-02:30pm] New.
+ */
+static inline void wsTlmGnssDown(WsTelemetry* now) {
+    for (uint8_t i = 0; i < WS_TLM_NUM_GNSS; i++) {
+        now->value[i] = 0;
+    }
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Encode a keyframe or delta frame.
+ * -------------------------------------------------------------------------
+ *
+ * A keyframe is forced until the encoder is primed. A delta with no changed fields is not sent.
+ *
+ * @param  WsTlmEncoder*      encoder  Encoder.
+ * @param  const WsTelemetry* now      Current snapshot.
+ * @param  bool               keyframe true = send all fields.
+ * @param  array              out      Output buffer, >= WS_TLM_MAX_FRAME bytes.
+ * @return size_t             Frame length, 0 = nothing to send.
+ * @since  3.2.2 [2026-10-16-02:00pm] New.
+ */
+static inline size_t wsTlmEncode(WsTlmEncoder* encoder, const WsTelemetry* now, bool keyframe, uint8_t* out) {
+
+    // --- Field mask. ---
+    keyframe = keyframe || !encoder->primed;
+    uint32_t mask = 0;
+    for (uint8_t i = 0; i < WS_TLM_NUM_FIELDS; i++) {
+        if (keyframe || (now->value[i] != encoder->last.value[i])) {
+            mask |= (uint32_t)1 << i;
+        }
+    }
+    if (mask == 0) {
+        return 0;
+    }
+
+    // --- Header. ---
+    encoder->sequence++;
+    out[0] = keyframe ? WS_TLM_KEYFRAME : WS_TLM_DELTA;
+    out[1] = encoder->sequence;
+    for (uint8_t b = 0; b < 4; b++) {
+        out[2 + b] = (uint8_t)(mask >> (8 * b));
+    }
+
+    // --- Fields. ---
+    size_t len = WS_TLM_HEADER_LEN;
+    for (uint8_t i = 0; i < WS_TLM_NUM_FIELDS; i++) {
+        if (mask & ((uint32_t)1 << i)) {
+            uint64_t v = (uint64_t)now->value[i];
+            for (uint8_t b = 0; b < WS_TLM_FIELD_SIZE[i]; b++) {
+                out[len++] = (uint8_t)(v >> (8 * b));
+            }
+            encoder->last.value[i] = now->value[i];
+        }
+    }
+
+    // --- Stats. ---
+    encoder->primed = true;
+    keyframe ? encoder->keyframes++ : encoder->deltas++;
+    encoder->bytesOut += len;
+    return len;
+}
+
+/**
+ * -------------------------------------------------------------------------
+ *  Encode a NMEA frame.
+ * -------------------------------------------------------------------------
+ *
+ * @param  WsTlmEncoder* encoder Encoder (stats only).
+ * @param  array         sentence NMEA sentence.
+ * @param  size_t        len      Sentence length, <= WS_TLM_MAX_FRAME - 2.
+ * @param  array         out      Output buffer, >= WS_TLM_MAX_FRAME bytes.
+ * @return size_t        Frame length, 0 = sentence too long.
+ * @since  3.2.2 [2026-10-16-02:00pm] New.
+ */
+static inline size_t wsTlmEncodeNmea(WsTlmEncoder* encoder, const char* sentence, size_t len, uint8_t* out) {
+    if (len > (size_t)(WS_TLM_MAX_FRAME - 2)) {
+        return 0;
+    }
+    out[0] = WS_TLM_NMEA;
+    out[1] = 0;
+    for (size_t i = 0; i < len; i++) {
+        out[2 + i] = (uint8_t)sentence[i];
+    }
+    encoder->bytesOut += len + 2;
+    return len + 2;
+}
+
+#endif